@@ -306,5 +306,45 @@ class BToDLeptonNeutrinoTest :
                     TEST_CHECK_RELATIVE_ERROR(obs_RD->evaluate(), 1.43554, eps);
                 }
             }
+
+            // Gauss-Legendre integration agrees with the adaptive cubature
+            {
+                Parameters p = Parameters::Defaults();
+                p["B->D::f_+(0)@BCL2008"]  = +0.660;
+                p["B->D::f_T(0)@BCL2008"]  = +0.00;
+                p["B->D::b_+^1@BCL2008"]   = -4.00;
+                p["B->D::b_+^2@BCL2008"]   = -0.80;
+                p["B->D::b_0^1@BCL2008"]   = +0.40;
+                p["B->D::b_0^2@BCL2008"]   = -1.20;
+                p["B->D::b_T^1@BCL2008"]   = +0.00;
+                p["B->D::b_T^2@BCL2008"]   = +0.00;
+
+                for (const auto & l : { "mu"_ov, "tau"_ov })
+                {
+                    Options oo
+                    {
+                        { "model"_ok,        "WET"_ov        },
+                        { "form-factors"_ok, "BCL2008"_ov    },
+                        { "P"_ok,            "D"_ov          },
+                        { "q"_ok,            "d"_ov          },
+                        { "l"_ok,            l               }
+                    };
+                    BToPseudoscalarLeptonNeutrino d_cub(p, oo);
+
+                    oo.declare("integration"_ok, "gauss-legendre"_ov);
+                    BToPseudoscalarLeptonNeutrino d_gl(p, oo);
+
+                    // the adaptive cubature has a relative tolerance of 1e-5 per integral, and the ratios involve two integrals
+                    const double eps = 5e-5;
+                    for (const auto & [q2_min, q2_max] : { std::make_pair(3.2, 5.0), std::make_pair(5.0, 8.25), std::make_pair(8.25, 11.62), std::make_pair(3.2, 11.62) })
+                    {
+                        TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_branching_ratio(q2_min, q2_max),     d_cub.integrated_branching_ratio(q2_min, q2_max),     eps);
+                        TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_a_fb_leptonic(q2_min, q2_max),       d_cub.integrated_a_fb_leptonic(q2_min, q2_max),       eps);
+                        TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_flat_term(q2_min, q2_max),           d_cub.integrated_flat_term(q2_min, q2_max),           eps);
+                        TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_lepton_polarization(q2_min, q2_max), d_cub.integrated_lepton_polarization(q2_min, q2_max), eps);
+                        TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_pdf_q2(q2_min, q2_max),              d_cub.integrated_pdf_q2(q2_min, q2_max),              eps);
+                    }
+                }
+            }
         }
 } b_to_d_l_nu_test;
@@ -25,6 +25,7 @@
 #include <eos/form-factors/form-factors.hh>
 #include <eos/maths/integrate.hh>
 #include <eos/maths/integrate-impl.hh>
+#include <eos/maths/integrate-panels.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/destringify.hh>
@@ -62,6 +63,8 @@ namespace eos
 
         Parameters parameters;
 
+        ParameterUser & parameter_user;
+
         QuarkFlavorOption opt_q;
         RestrictedOption opt_P;
 
@@ -94,8 +97,13 @@ namespace eos
 
         BooleanOption opt_cp_conjugate;
 
+        RestrictedOption opt_integration;
+
         std::shared_ptr<FormFactors<PToP>> form_factors;
 
+        // shared cache of the amplitudes at the q^2 nodes; only used for integration=gauss-legendre
+        std::shared_ptr<PanelIntegrator<BToPseudoscalarLeptonNeutrino, b_to_psd_l_nu::Amplitudes>> panels;
+
         // { q, P } -> { process, U, B_name, P_name, c_I }
         // q: u, d, s: the spectar quark flavor
         // P: D, K, pi, eta, eta_prime: the type of daughter meson
@@ -169,6 +177,7 @@ namespace eos
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model"_ok, "SM"_ov), p, o)),
             parameters(p),
+            parameter_user(u),
             opt_q(o, options, "q"_ok),
             opt_P(o, options, "P"_ok),
             m_B(p["mass::" + _B()], u),
@@ -182,6 +191,7 @@ namespace eos
             mu(p[stringify(_U()) + "b" + opt_l.str() + "nu" + opt_l.str() + "::mu"], u),
             cub_conf(cubature::Config().epsrel(1e-5).epsabs(1.0e-9)),
             opt_cp_conjugate(o, options, "cp-conjugate"_ok),
+            opt_integration(o, options, "integration"_ok),
             form_factors(FormFactorFactory<PToP>::create(_process() + "::" + o.get("form-factors"_ok, "BSZ2015"_ov).str(), p, o))
         {
             Context ctx("When constructing B->Plnu observable");
@@ -207,6 +217,11 @@ namespace eos
 
             u.uses(*form_factors);
             u.uses(*model);
+
+            if ("gauss-legendre" == opt_integration.value())
+            {
+                panels = PanelIntegrator<BToPseudoscalarLeptonNeutrino, b_to_psd_l_nu::Amplitudes>::make(p, o);
+            }
         }
 
         b_to_psd_l_nu::Amplitudes amplitudes(const double & q2) const
@@ -294,8 +309,11 @@ namespace eos
         // normalized to |V_Ub = 1|, obtained using cf. [DDS:2014A], eq. (12), agrees with Sakaki'13 et al cf. [STTW:2013A]
         double normalized_differential_decay_width(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return normalized_differential_decay_width(this->amplitudes(q2));
+        }
 
+        double normalized_differential_decay_width(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        + 3.0 * std::norm(amp.h_tS) * (1.0 - amp.v)
@@ -306,8 +324,11 @@ namespace eos
 
         double normalized_differential_decay_width_p(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return normalized_differential_decay_width_p(this->amplitudes(q2));
+        }
 
+        double normalized_differential_decay_width_p(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        );
@@ -315,8 +336,11 @@ namespace eos
 
         double normalized_differential_decay_width_0(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return normalized_differential_decay_width_0(this->amplitudes(q2));
+        }
 
+        double normalized_differential_decay_width_0(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        3.0 * std::norm(amp.h_t) * (1.0 - amp.v)
                    );
@@ -327,8 +351,11 @@ namespace eos
         // crosschecked against [BFNT:2019A] and [STTW:2013A]
         double numerator_differential_a_fb_leptonic(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return numerator_differential_a_fb_leptonic(this->amplitudes(q2));
+        }
 
+        double numerator_differential_a_fb_leptonic(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return - 4.0 * amp.NF * amp.p * (
                        std::real(amp.h_0 * std::conj(amp.h_tS)) * (1.0 - amp.v)
                        - 4.0 * std::sqrt(1.0 - amp.v) * std::real(amp.h_T * std::conj(amp.h_tS))
@@ -338,8 +365,11 @@ namespace eos
         // obtained using cf. [DDS:2014A], eq. (12) and [BHP:2007A] eq.(1.2)
         double numerator_differential_flat_term(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return numerator_differential_flat_term(this->amplitudes(q2));
+        }
 
+        double numerator_differential_flat_term(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return amp.NF * amp.p * (
                        (std::norm(amp.h_0) + std::norm(amp.h_tS)) * (1.0 - amp.v)
                        + 16.0 * std::norm(amp.h_T)
@@ -350,8 +380,11 @@ namespace eos
         // obtained using cf. [STTW:2013A], eq. (49a - 49b)
         double numerator_differential_lepton_polarization(const double & q2) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(q2));
+            return numerator_differential_lepton_polarization(this->amplitudes(q2));
+        }
 
+        double numerator_differential_lepton_polarization(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             const double dGplus = (std::norm(amp.h_0) + 3.0 * std::norm(amp.h_t)) * (1.0 - amp.v) / 2.0
                                 + 3.0 / 2.0 * std::norm(amp.h_S)
                                 + 8.0 * std::norm(amp.h_T)
@@ -392,14 +425,29 @@ namespace eos
             return normalized_differential_decay_width(q2) * tau_B / hbar;
         }
 
+        // integrate a function of the amplitudes, multiplied by a constant factor, over q^2
+        double integrate_q2(double (Implementation::*g)(const b_to_psd_l_nu::Amplitudes &) const, const double & q2_min, const double & q2_max, const double & factor = 1.0) const
+        {
+            // the fixed-order rule reuses the amplitudes at the nodes across all bins and observables
+            if (panels)
+            {
+                const std::function<b_to_psd_l_nu::Amplitudes (const double &)> f = std::bind(&Implementation::amplitudes, this, std::placeholders::_1);
+
+                return factor * panels->integrate(parameter_user, f, [this, g](const b_to_psd_l_nu::Amplitudes & amp, const double &) { return (this->*g)(amp); }, q2_min, q2_max);
+            }
+
+            std::function<double (const double &)> f = [this, g, factor](const double & q2) { return (this->*g)(this->amplitudes(q2)) * factor; };
+
+            return integrate<1, 1>(f, q2_min, q2_max, cub_conf);
+        }
+
         double pdf_q2(const double & q2) const
         {
             const double q2_min = power_of<2>(m_l());
             const double q2_max = power_of<2>(m_B() - m_P());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
             const double num   = normalized_differential_branching_ratio(q2);
-            const double denom = integrate<1, 1>(f, q2_min, q2_max, cub_conf);
+            const double denom = integrate_q2(&Implementation::normalized_differential_decay_width, q2_min, q2_max, tau_B / hbar);
 
             return num / denom;
         }
@@ -418,9 +466,8 @@ namespace eos
             const double q2_abs_min = power_of<2>(m_l());
             const double q2_abs_max = power_of<2>(m_B() - m_P());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
-            const double num   = integrate<1, 1>(f, q2_min,     q2_max,     cub_conf);
-            const double denom = integrate<1, 1>(f, q2_abs_min, q2_abs_max, cub_conf);
+            const double num   = integrate_q2(&Implementation::normalized_differential_decay_width, q2_min,     q2_max,     tau_B / hbar);
+            const double denom = integrate_q2(&Implementation::normalized_differential_decay_width, q2_abs_min, q2_abs_max, tau_B / hbar);
 
             return num / denom / (q2_max - q2_min);
         }
@@ -463,6 +510,7 @@ namespace eos
         { "cp-conjugate"_ok, { "true"_ov, "false"_ov },                               "false"_ov },
         { "l"_ok,            { "e"_ov, "mu"_ov, "tau"_ov },                             "mu"_ov    },
         { "q"_ok,            { "u"_ov, "d"_ov, "s"_ov },                                "d"_ov     },
+        { "integration"_ok,  { "cubature"_ov, "gauss-legendre"_ov },                   "cubature"_ov },
     };
 
     BToPseudoscalarLeptonNeutrino::BToPseudoscalarLeptonNeutrino(const Parameters & parameters, const Options & options) :
@@ -522,19 +570,13 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_decay_width(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_decay_width,
-                _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max, std::norm(_imp->v_Ub()));
     }
 
     double
     BToPseudoscalarLeptonNeutrino::integrated_branching_ratio(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_branching_ratio,
-                _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max, std::norm(_imp->v_Ub()) * _imp->tau_B / _imp->hbar);
     }
 
     double
@@ -575,38 +617,26 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max, _imp->tau_B / _imp->hbar);
     }
 
     // normalized (|V_Ub|=1) integrated decay_width
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p, q2_min, q2_max);
     }
 
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0, q2_min, q2_max);
     }
 
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
+        return _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max);
     }
 
     double
@@ -618,19 +648,8 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic(const double & q2_min, const double & q2_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
+        const double integrated_numerator   = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic, q2_min, q2_max);
+        const double integrated_denominator = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max);
 
         return integrated_numerator / integrated_denominator;
     }
@@ -644,19 +663,8 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_flat_term(const double & q2_min, const double & q2_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
+        const double integrated_numerator   = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term, q2_min, q2_max);
+        const double integrated_denominator = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max);
 
         return integrated_numerator / integrated_denominator;
     }
@@ -670,19 +678,8 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization(const double & q2_min, const double & q2_max) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<1, 1>(f, q2_min, q2_max, _imp->cub_conf);
-        }
+        const double integrated_numerator   = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization, q2_min, q2_max);
+        const double integrated_denominator = _imp->integrate_q2(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width, q2_min, q2_max);
 
         return integrated_numerator / integrated_denominator;
     }
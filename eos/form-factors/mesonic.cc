@@ -43,15 +43,47 @@
 #include <eos/form-factors/parametric-ksvd2025.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/qualified-name.hh>
+#include <eos/utils/stringify.hh>
 
 #include <cmath>
 #include <limits>
 #include <map>
+#include <utility>
 
 namespace eos
 {
     using namespace std::literals::string_literals;
 
+    namespace
+    {
+        // Check that every requested form factor has one entry per value of q2
+        void
+        check_batch(const std::string & transition, const std::size_t & size, std::initializer_list<std::pair<const char *, const std::vector<double> *>> form_factors)
+        {
+            for (const auto & [name, values] : form_factors)
+            {
+                if (values->empty() || (values->size() == size))
+                {
+                    continue;
+                }
+
+                throw InternalError(transition + " form factor batch: expected " + stringify(size) + " values of " + name + ", got a buffer of size "
+                                    + stringify(values->size()));
+            }
+        }
+
+        // Evaluate a form factor one value of q2 at a time, if it is requested
+        template <typename FormFactors_>
+        void
+        fill_batch(const FormFactors_ & ff, double (FormFactors_::*f)(const double &) const, std::span<const double> q2, std::vector<double> & results)
+        {
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                results[i] = (ff.*f)(q2[i]);
+            }
+        }
+    } // namespace
+
     /* P -> V Processes */
 
     FormFactors<PToV>::~FormFactors()
@@ -155,6 +187,50 @@ namespace eos
         return complex<double>(std::numeric_limits<double>::signaling_NaN());
     }
 
+    void
+    FormFactors<PToV>::evaluate(std::span<const double> q2, Batch & results) const
+    {
+        check_batch("P->V", q2.size(), {
+            { "V",        &results.v        },
+            { "A_0",      &results.a_0      },
+            { "A_1",      &results.a_1      },
+            { "A_2",      &results.a_2      },
+            { "A_12",     &results.a_12     },
+            { "T_1",      &results.t_1      },
+            { "T_2",      &results.t_2      },
+            { "T_3",      &results.t_3      },
+            { "T_23",     &results.t_23     },
+            { "F_perp",   &results.f_perp   },
+            { "F_para",   &results.f_para   },
+            { "F_long",   &results.f_long   },
+            { "F_perp^T", &results.f_perp_T },
+            { "F_para^T", &results.f_para_T },
+            { "F_long^T", &results.f_long_T }
+        });
+
+        _evaluate(q2, results);
+    }
+
+    void
+    FormFactors<PToV>::_evaluate(std::span<const double> q2, Batch & results) const
+    {
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::v,        q2, results.v);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::a_0,      q2, results.a_0);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::a_1,      q2, results.a_1);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::a_2,      q2, results.a_2);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::a_12,     q2, results.a_12);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::t_1,      q2, results.t_1);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::t_2,      q2, results.t_2);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::t_3,      q2, results.t_3);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::t_23,     q2, results.t_23);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_perp,   q2, results.f_perp);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_para,   q2, results.f_para);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_long,   q2, results.f_long);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_perp_T, q2, results.f_perp_T);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_para_T, q2, results.f_para_T);
+        fill_batch<FormFactors<PToV>>(*this, &FormFactors<PToV>::f_long_T, q2, results.f_long_T);
+    }
+
     std::shared_ptr<FormFactors<PToV>>
     FormFactorFactory<PToV>::create(const QualifiedName & name, const Parameters & parameters, const Options & options)
     {
@@ -447,6 +523,28 @@ namespace eos
         return complex<double>(std::numeric_limits<double>::signaling_NaN());
     }
 
+    void
+    FormFactors<PToP>::evaluate(std::span<const double> q2, Batch & results) const
+    {
+        check_batch("P->P", q2.size(), {
+            { "f_+",   &results.f_p      },
+            { "f_0",   &results.f_0      },
+            { "f_T",   &results.f_t      },
+            { "f_+^T", &results.f_plus_T }
+        });
+
+        _evaluate(q2, results);
+    }
+
+    void
+    FormFactors<PToP>::_evaluate(std::span<const double> q2, Batch & results) const
+    {
+        fill_batch<FormFactors<PToP>>(*this, &FormFactors<PToP>::f_p,      q2, results.f_p);
+        fill_batch<FormFactors<PToP>>(*this, &FormFactors<PToP>::f_0,      q2, results.f_0);
+        fill_batch<FormFactors<PToP>>(*this, &FormFactors<PToP>::f_t,      q2, results.f_t);
+        fill_batch<FormFactors<PToP>>(*this, &FormFactors<PToP>::f_plus_T, q2, results.f_plus_T);
+    }
+
     std::shared_ptr<FormFactors<PToP>>
     FormFactorFactory<PToP>::create(const QualifiedName & name, const Parameters & parameters, const Options & options)
     {
@@ -36,7 +36,9 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -78,6 +80,34 @@ namespace eos
             virtual complex<double> t_1(const complex<double> & q2) const;
             virtual complex<double> t_2(const complex<double> & q2) const;
             virtual complex<double> t_23(const complex<double> & q2) const;
+
+            /*!
+             * The form factors for a batch of values of q2, in struct-of-arrays layout.
+             *
+             * Only the form factors whose vectors are non-empty are evaluated. Each
+             * non-empty vector must hold one entry per value of q2.
+             */
+            struct Batch
+            {
+                std::vector<double> v;
+                std::vector<double> a_0, a_1, a_2, a_12;
+                std::vector<double> t_1, t_2, t_3, t_23;
+                std::vector<double> f_perp, f_para, f_long;
+                std::vector<double> f_perp_T, f_para_T, f_long_T;
+            };
+
+            /*!
+             * Evaluate the requested form factors for a batch of values of q2.
+             *
+             * @param q2      The values of q2.
+             * @param results The form factors; only the non-empty vectors are filled.
+             */
+            void evaluate(std::span<const double> q2, Batch & results) const;
+
+        protected:
+            // Evaluate the requested form factors, after the sizes of the vectors have been checked.
+            // The default implementation calls the form factors one value of q2 at a time.
+            virtual void _evaluate(std::span<const double> q2, Batch & results) const;
     };
 
     template <>
@@ -188,6 +218,29 @@ namespace eos
             virtual complex<double> f_0(const complex<double> & q2) const;
             virtual complex<double> f_t(const complex<double> & q2) const;
 
+            /*!
+             * The form factors for a batch of values of q2, in struct-of-arrays layout.
+             *
+             * Only the form factors whose vectors are non-empty are evaluated. Each
+             * non-empty vector must hold one entry per value of q2.
+             */
+            struct Batch
+            {
+                std::vector<double> f_p, f_0, f_t, f_plus_T;
+            };
+
+            /*!
+             * Evaluate the requested form factors for a batch of values of q2.
+             *
+             * @param q2      The values of q2.
+             * @param results The form factors; only the non-empty vectors are filled.
+             */
+            void evaluate(std::span<const double> q2, Batch & results) const;
+
+        protected:
+            // Evaluate the requested form factors, after the sizes of the vectors have been checked.
+            // The default implementation calls the form factors one value of q2 at a time.
+            virtual void _evaluate(std::span<const double> q2, Batch & results) const;
     };
 
     template <>
@@ -21,10 +21,57 @@
 #define EOS_GUARD_EOS_FORM_FACTORS_PARAMETRIC_BCL2008_IMPL_HH 1
 
 #include <eos/form-factors/parametric-bcl2008.hh>
+#include <eos/maths/power-series.hh>
 #include <eos/utils/exception.hh>
 
+#include <array>
+#include <vector>
+
 namespace eos
 {
+    namespace bcl2008
+    {
+        /*
+         * Coefficients c_1, ..., c_K of the series in z for f_+ and f_T, with the last
+         * coefficient b_K fixed by eq. (14) of [BCL:2008A].
+         */
+        template <std::size_t K_>
+        std::array<double, K_ + 1>
+        constrained_coefficients(const std::array<double, K_ - 1> & b)
+        {
+            std::array<double, K_ + 1> result{};
+            for (std::size_t k = 1; k < K_; ++k)
+            {
+                const double sign = ((K_ - k) % 2 == 0) ? -1.0 : +1.0;
+
+                result[k]   = b[k - 1];
+                result[K_] += sign * k / K_ * b[k - 1];
+            }
+
+            return result;
+        }
+
+        /*
+         * Evaluate f(0) / (1 - s / m_R^2) * (1 + sum_k c_k (z^k - z_0^k)) for a batch of values of s.
+         *
+         * The sum is rewritten as P(z) - P(z_0), with the polynomial P evaluated by Horner's scheme.
+         */
+        template <std::size_t n_>
+        void
+        series(const double & f_0, const double & m2_R, std::array<double, n_> c, std::span<const double> s,
+                std::span<const double> z, const double & z_0, std::span<double> results)
+        {
+            c[0] = 0.0;
+            c[0] = 1.0 - power_series(c, z_0);
+
+            power_series(c, z, results);
+            for (std::size_t i = 0; i < s.size(); ++i)
+            {
+                results[i] *= f_0 / (1.0 - s[i] / m2_R);
+            }
+        }
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 3u, false>::_z(const double & s) const
@@ -92,6 +139,40 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 3u, false>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        const double z_0 = _z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = _z(s[i]);
+        }
+
+        if (! results.f_p.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_1m, bcl2008::constrained_coefficients<3u>({ _b_plus_1, _b_plus_2 }), s, z, z_0, results.f_p);
+        }
+
+        if (! results.f_0.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_0p, std::array<double, 4>{ 0.0, _b_zero_1, _b_zero_2, _b_zero_3 }, s, z, z_0, results.f_0);
+        }
+
+        // the tensor form factors are provided by the derived classes, if at all
+        for (std::size_t i = 0; i < results.f_t.size(); ++i)
+        {
+            results.f_t[i] = this->f_t(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_plus_T.size(); ++i)
+        {
+            results.f_plus_T[i] = this->f_plus_T(s[i]);
+        }
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 4u, false>::_z(const double & s) const
@@ -161,6 +242,40 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 4u, false>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        const double z_0 = _z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = _z(s[i]);
+        }
+
+        if (! results.f_p.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_1m, bcl2008::constrained_coefficients<4u>({ _b_plus_1, _b_plus_2, _b_plus_3 }), s, z, z_0, results.f_p);
+        }
+
+        if (! results.f_0.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_0p, std::array<double, 5>{ 0.0, _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4 }, s, z, z_0, results.f_0);
+        }
+
+        // the tensor form factors are provided by the derived classes, if at all
+        for (std::size_t i = 0; i < results.f_t.size(); ++i)
+        {
+            results.f_t[i] = this->f_t(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_plus_T.size(); ++i)
+        {
+            results.f_plus_T[i] = this->f_plus_T(s[i]);
+        }
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 5u, false>::_z(const double & s) const
@@ -233,6 +348,40 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 5u, false>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        const double z_0 = _z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = _z(s[i]);
+        }
+
+        if (! results.f_p.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_1m, bcl2008::constrained_coefficients<5u>({ _b_plus_1, _b_plus_2, _b_plus_3, _b_plus_4 }), s, z, z_0, results.f_p);
+        }
+
+        if (! results.f_0.empty())
+        {
+            bcl2008::series(_f_plus_0, Process_::mR2_0p, std::array<double, 6>{ 0.0, _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4, _b_zero_5 }, s, z, z_0, results.f_0);
+        }
+
+        // the tensor form factors are provided by the derived classes, if at all
+        for (std::size_t i = 0; i < results.f_t.size(); ++i)
+        {
+            results.f_t[i] = this->f_t(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_plus_T.size(); ++i)
+        {
+            results.f_plus_T[i] = this->f_plus_T(s[i]);
+        }
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 3u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 3u, false>(p, o),
@@ -253,6 +402,32 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z3bar / 3.0) + _b_t_2 * (z2bar + 2.0 * z3bar / 3.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 3u, true>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        // the vector and scalar form factors are provided by the base class
+        std::vector<double> f_t_values;
+        f_t_values.swap(results.f_t);
+        BCL2008FormFactorBase<Process_, 3u, false>::_evaluate(s, results);
+        f_t_values.swap(results.f_t);
+
+        if (results.f_t.empty())
+        {
+            return;
+        }
+
+        const double z_0 = this->_z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = this->_z(s[i]);
+        }
+
+        bcl2008::series(_f_t_0, Process_::mR2_1m, bcl2008::constrained_coefficients<3u>({ _b_t_1, _b_t_2 }), s, z, z_0, results.f_t);
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 4u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 4u, false>(p, o),
@@ -275,6 +450,32 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar + z4bar / 4.0) + _b_t_2 * (z2bar - z4bar / 2.0) + _b_t_3 * (z3bar + 3.0 * z4bar / 4.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 4u, true>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        // the vector and scalar form factors are provided by the base class
+        std::vector<double> f_t_values;
+        f_t_values.swap(results.f_t);
+        BCL2008FormFactorBase<Process_, 4u, false>::_evaluate(s, results);
+        f_t_values.swap(results.f_t);
+
+        if (results.f_t.empty())
+        {
+            return;
+        }
+
+        const double z_0 = this->_z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = this->_z(s[i]);
+        }
+
+        bcl2008::series(_f_t_0, Process_::mR2_1m, bcl2008::constrained_coefficients<4u>({ _b_t_1, _b_t_2, _b_t_3 }), s, z, z_0, results.f_t);
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 5u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 5u, false>(p, o),
@@ -298,6 +499,32 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z5bar / 5.0) + _b_t_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_t_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_t_4 * (z4bar + 4.0 * z5bar / 5.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 5u, true>::_evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const
+    {
+        // the vector and scalar form factors are provided by the base class
+        std::vector<double> f_t_values;
+        f_t_values.swap(results.f_t);
+        BCL2008FormFactorBase<Process_, 5u, false>::_evaluate(s, results);
+        f_t_values.swap(results.f_t);
+
+        if (results.f_t.empty())
+        {
+            return;
+        }
+
+        const double z_0 = this->_z(0.0);
+
+        std::vector<double> z(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            z[i] = this->_z(s[i]);
+        }
+
+        bcl2008::series(_f_t_0, Process_::mR2_1m, bcl2008::constrained_coefficients<5u>({ _b_t_1, _b_t_2, _b_t_3, _b_t_4 }), s, z, z_0, results.f_t);
+    }
+
     template <typename Process_, unsigned K_>
     BCL2008FormFactors<Process_, K_>::BCL2008FormFactors(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, K_, Process_::uses_tensor_form_factors>(p, o)
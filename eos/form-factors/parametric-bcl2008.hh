@@ -52,6 +52,9 @@ namespace eos
         protected:
             double _z(const double & s) const;
 
+            // computes z(s) once per value of s
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -80,6 +83,9 @@ namespace eos
         protected:
             double _z(const double & s) const;
 
+            // computes z(s) once per value of s
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -108,6 +114,9 @@ namespace eos
         protected:
             double _z(const double & s) const;
 
+            // computes z(s) once per value of s
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -134,6 +143,9 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2;
 
+        protected:
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
@@ -154,6 +166,9 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3;
 
+        protected:
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
@@ -174,6 +189,9 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3,    _b_t_4;
 
+        protected:
+            virtual void _evaluate(std::span<const double> s, FormFactors<PToP>::Batch & results) const override;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
@@ -20,6 +20,8 @@
 #include <test/test.hh>
 #include <eos/form-factors/parametric-bcl2008-impl.hh>
 
+#include <vector>
+
 using namespace test;
 using namespace eos;
 
@@ -106,6 +108,23 @@ class BCL2008FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff->f_0(10.0), 1.45892, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_0(15.0), 1.91416, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_0(20.0), 2.80533, eps);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    p["B->pi::b_+^1@BCL2008"]  = -0.5;
+                    p["B->pi::b_0^1@BCL2008"]  =  0.3;
+                    p["B->pi::f_T(0)@BCL2008"] =  0.5;
+                    p["B->pi::b_T^1@BCL2008"]  =  0.7;
+
+                    using FF = FormFactors<PToP>;
+                    const std::vector<double> q2{ 0.0, 5.0, 10.0, 15.0, 20.0, 25.0 };
+
+                    auto batch = check_batch_evaluation<FF>(*ff, q2, { { &FF::Batch::f_p, &FF::f_p }, { &FF::Batch::f_0, &FF::f_0 }, { &FF::Batch::f_t, &FF::f_t } });
+
+                    // f_+^T is not available in this parametrization
+                    batch.f_plus_T.resize(q2.size());
+                    TEST_CHECK_THROWS(InternalError, ff->evaluate(q2, batch));
+                }
             }
         }
 } bcl2008_form_factors_test;
@@ -455,6 +474,19 @@ class BCL2008K5FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(10.0), 1.53465, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(15.0), 2.10670, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(20.0), 3.36677, eps);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    p["B->pi::b_+^1@BCL2008"]  = -0.5;
+                    p["B->pi::b_+^3@BCL2008"]  =  0.4;
+                    p["B->pi::b_0^2@BCL2008"]  =  0.3;
+                    p["B->pi::b_T^2@BCL2008"]  =  0.7;
+
+                    using FF = FormFactors<PToP>;
+                    const std::vector<double> q2{ 0.0, 5.0, 10.0, 15.0, 20.0, 25.0 };
+
+                    check_batch_evaluation<FF>(*ff, q2, { { &FF::Batch::f_p, &FF::f_p }, { &FF::Batch::f_0, &FF::f_0 }, { &FF::Batch::f_t, &FF::f_t } });
+                }
             }
         }
 } bcl2008_k5_form_factors_k5_test;
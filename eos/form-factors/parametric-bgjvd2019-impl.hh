@@ -31,6 +31,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace eos
 {
@@ -250,6 +251,58 @@ namespace eos
         return f_t(q2) * q2 / _m_B / (_m_B + _m_P);
     }
 
+    template <typename Process_>
+    void
+    HQETFormFactors<Process_, PToP>::_evaluate(std::span<const double> q2, Batch & results) const
+    {
+        const std::size_t n = q2.size();
+
+        const double m_B = this->_m_B(), m_P = this->_m_P();
+        const double r = m_P / m_B;
+
+        const bool need_pm = ! results.f_p.empty() || ! results.f_0.empty();
+        const bool need_T  = ! results.f_t.empty() || ! results.f_plus_T.empty();
+
+        std::vector<double> f_p(n), f_m(n), f_t(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (need_pm)
+            {
+                const double h_p = _h_p(q2[i]), h_m = _h_m(q2[i]);
+
+                // cf. [FKKM:2008A], eq. (22)
+                f_p[i] = 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * h_p - (1.0 - r) * h_m);
+                f_m[i] = 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * h_m - (1.0 - r) * h_p);
+            }
+
+            if (need_T)
+            {
+                // cf. [BJvD:2019A], eq. (A7)
+                f_t[i] = (1.0 + r) / (2.0 * sqrt(r)) * _h_T(q2[i]);
+            }
+        }
+
+        if (! results.f_p.empty())
+        {
+            results.f_p = f_p;
+        }
+
+        for (std::size_t i = 0; i < results.f_0.size(); ++i)
+        {
+            results.f_0[i] = f_p[i] + q2[i] / (m_B * m_B - m_P * m_P) * f_m[i];
+        }
+
+        if (! results.f_t.empty())
+        {
+            results.f_t = f_t;
+        }
+
+        for (std::size_t i = 0; i < results.f_plus_T.size(); ++i)
+        {
+            results.f_plus_T[i] = f_t[i] * q2[i] / m_B / (m_B + m_P);
+        }
+    }
+
     template <typename Process_>
     Diagnostics
     HQETFormFactors<Process_, PToP>::diagnostics() const
@@ -839,6 +892,147 @@ namespace eos
         return 0.;
     }
 
+    template <typename Process_>
+    void
+    HQETFormFactors<Process_, PToV>::_evaluate(std::span<const double> q2, Batch & results) const
+    {
+        const std::size_t n = q2.size();
+
+        const double m_B = this->_m_B(), m_B2 = power_of<2>(m_B);
+        const double m_V = this->_m_V(), m_V2 = power_of<2>(m_V);
+        const double r = m_V / m_B;
+
+        const bool need_v   = ! results.v.empty();
+        const bool need_a1  = ! results.a_0.empty() || ! results.a_1.empty() || ! results.a_12.empty();
+        const bool need_a23 = ! results.a_0.empty() || ! results.a_2.empty() || ! results.a_12.empty();
+        const bool need_t12 = ! results.t_1.empty() || ! results.t_2.empty() || ! results.t_3.empty() || ! results.t_23.empty();
+        const bool need_t3  = ! results.t_3.empty() || ! results.t_23.empty();
+
+        std::vector<double> w(n), h_v(n), h_a1(n), h_a2(n), h_a3(n), h_t1(n), h_t2(n), h_t3(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            w[i] = _w(q2[i]);
+
+            if (need_v)
+            {
+                h_v[i] = _h_v(q2[i]);
+            }
+
+            if (need_a1)
+            {
+                h_a1[i] = _h_a1(q2[i]);
+            }
+
+            if (need_a23)
+            {
+                h_a2[i] = _h_a2(q2[i]);
+                h_a3[i] = _h_a3(q2[i]);
+            }
+
+            if (need_t12)
+            {
+                h_t1[i] = _h_t1(q2[i]);
+                h_t2[i] = _h_t2(q2[i]);
+            }
+
+            if (need_t3)
+            {
+                h_t3[i] = _h_t3(q2[i]);
+            }
+        }
+
+        // cf. [FKKM:2008A], eq. (22)
+        std::vector<double> a_1(n), a_2(n), t_2(n), t_3(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a_1[i] = sqrt(r) * (1.0 + w[i]) / (1.0 + r) * h_a1[i];
+            a_2[i] = (1.0 + r) / (2.0 * sqrt(r)) * (r * h_a2[i] + h_a3[i]);
+            t_2[i] = +1.0 / (2.0 * sqrt(r)) * (2.0 * r * (w[i] + 1.0) / (1.0 + r) * h_t1[i] - 2.0 * r * (w[i] - 1.0) / (1.0 - r) * h_t2[i]);
+            t_3[i] = +1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * h_t1[i] - (1.0 + r) * h_t2[i] + (1.0 - r * r) * h_t3[i]);
+        }
+
+        for (std::size_t i = 0; i < results.v.size(); ++i)
+        {
+            results.v[i] = (1.0 + r) / 2.0 / sqrt(r) * h_v[i];
+        }
+
+        for (std::size_t i = 0; i < results.a_0.size(); ++i)
+        {
+            results.a_0[i] = 1.0 / (2.0 * sqrt(r)) * ((1.0 + w[i]) * h_a1[i] + (r * w[i] - 1.0) * h_a2[i] + (r - w[i]) * h_a3[i]);
+        }
+
+        if (! results.a_1.empty())
+        {
+            results.a_1 = a_1;
+        }
+
+        if (! results.a_2.empty())
+        {
+            results.a_2 = a_2;
+        }
+
+        for (std::size_t i = 0; i < results.a_12.size(); ++i)
+        {
+            const double lambda = eos::lambda(m_B2, m_V2, q2[i]);
+
+            results.a_12[i] = ((m_B + m_V) * (m_B + m_V) * (m_B2 - m_V2 - q2[i]) * a_1[i] - lambda * a_2[i])
+                    / (16.0 * m_B * m_V2 * (m_B + m_V));
+        }
+
+        for (std::size_t i = 0; i < results.t_1.size(); ++i)
+        {
+            results.t_1[i] = -1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * h_t2[i] - (1.0 + r) * h_t1[i]);
+        }
+
+        if (! results.t_2.empty())
+        {
+            results.t_2 = t_2;
+        }
+
+        if (! results.t_3.empty())
+        {
+            results.t_3 = t_3;
+        }
+
+        for (std::size_t i = 0; i < results.t_23.size(); ++i)
+        {
+            const double lambda = eos::lambda(m_B2, m_V2, q2[i]);
+
+            results.t_23[i] = ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - q2[i]) * t_2[i] - lambda * t_3[i]) / (8.0 * m_B * m_V2 * (m_B - m_V));
+        }
+
+        // the helicity form factors are not available in this parametrisation
+        for (std::size_t i = 0; i < results.f_perp.size(); ++i)
+        {
+            results.f_perp[i] = f_perp(q2[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_para.size(); ++i)
+        {
+            results.f_para[i] = f_para(q2[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_long.size(); ++i)
+        {
+            results.f_long[i] = f_long(q2[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_perp_T.size(); ++i)
+        {
+            results.f_perp_T[i] = f_perp_T(q2[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_para_T.size(); ++i)
+        {
+            results.f_para_T[i] = f_para_T(q2[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_long_T.size(); ++i)
+        {
+            results.f_long_T[i] = f_long_T(q2[i]);
+        }
+    }
+
     template <typename Process_>
     Diagnostics
     HQETFormFactors<Process_, PToV>::diagnostics() const
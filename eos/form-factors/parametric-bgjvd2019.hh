@@ -250,6 +250,9 @@ namespace eos
             double _h_S(const double & q2) const;
             double _h_T(const double & q2) const;
 
+            // computes each of the h_i at most once per value of q^2
+            virtual void _evaluate(std::span<const double> q2, Batch & results) const override;
+
         public:
             HQETFormFactors(const Parameters & p, const Options & o);
             ~HQETFormFactors();
@@ -307,6 +310,9 @@ namespace eos
             double _h_t2(const double & q2) const;
             double _h_t3(const double & q2) const;
 
+            // computes each of the h_i at most once per value of q^2
+            virtual void _evaluate(std::span<const double> q2, Batch & results) const override;
+
         public:
             HQETFormFactors(const Parameters & p, const Options & o);
             ~HQETFormFactors();
@@ -858,6 +858,14 @@ class BToDHQETFormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t( 4.0), +0.204498, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t( 8.0), +0.636037, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(10.0), +1.040053, eps);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    const std::vector<double> q2{ 0.5, 4.0, 8.0, 10.0 };
+
+                    using FF = FormFactors<PToP>;
+                    check_batch_evaluation<FF>(ff, q2, { { &FF::Batch::f_p, &FF::f_p }, { &FF::Batch::f_0, &FF::f_0 }, { &FF::Batch::f_t, &FF::f_t }, { &FF::Batch::f_plus_T, &FF::f_plus_T } });
+                }
             }
         }
 } b_to_d_hqet_form_factors_test;
@@ -1535,6 +1543,24 @@ class BToDstarHQETFormFactorsTest :
                 };
 
                 TEST_CHECK_DIAGNOSTICS(diag, ref);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    const std::vector<double> q2{ 0.5, 3.0, 6.0, 9.0 };
+
+                    using FF = FormFactors<PToV>;
+                    check_batch_evaluation<FF>(ff, q2, {
+                            { &FF::Batch::v,    &FF::v    },
+                            { &FF::Batch::a_0,  &FF::a_0  },
+                            { &FF::Batch::a_1,  &FF::a_1  },
+                            { &FF::Batch::a_2,  &FF::a_2  },
+                            { &FF::Batch::a_12, &FF::a_12 },
+                            { &FF::Batch::t_1,  &FF::t_1  },
+                            { &FF::Batch::t_2,  &FF::t_2  },
+                            { &FF::Batch::t_3,  &FF::t_3  },
+                            { &FF::Batch::t_23, &FF::t_23 }
+                        });
+                }
             }
         }
 } b_to_dstar_hqet_form_factors_test;
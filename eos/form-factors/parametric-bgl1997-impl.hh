@@ -27,10 +27,12 @@
 #include <eos/utils/kinematic.hh>
 #include <eos/models/model.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/maths/power-series.hh>
 
 #include <gsl/gsl_sf_dilog.h>
 
 #include <numeric>
+#include <vector>
 
 namespace eos
 {
@@ -336,6 +338,184 @@ namespace eos
         return 0.0;  //  TODO
     }
 
+    template<typename Process_>
+    void BGL1997FormFactors<Process_, PToV>::_evaluate(std::span<const double> s, Batch & results) const
+    {
+        const std::size_t n = s.size();
+
+        const double tp = _traits.tp(), tm = _traits.tm();
+        const double m_B = _mB(), m_B2 = power_of<2>(m_B);
+        const double m_V = _mV(), m_V2 = power_of<2>(m_V);
+
+        const bool need_g   = ! results.v.empty();
+        const bool need_f   = ! results.a_1.empty() || ! results.a_2.empty();
+        const bool need_F1  = ! results.a_2.empty() || ! results.a_12.empty();
+        const bool need_F2  = ! results.a_0.empty();
+        const bool need_T1  = ! results.t_1.empty();
+        const bool need_T2  = ! results.t_2.empty() || ! results.t_3.empty();
+        const bool need_T23 = ! results.t_3.empty() || ! results.t_23.empty();
+
+        // z(s) and the Blaschke factors are shared among the form factors
+        std::vector<double> z(n), blaschke_1m, blaschke_1p, blaschke_0m;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            z[i] = _traits._z(s[i], _traits.t_0, tp);
+        }
+
+        if (need_g || need_T1)
+        {
+            blaschke_1m.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                blaschke_1m[i] = _traits.blaschke_1m(s[i]);
+            }
+        }
+
+        if (need_f || need_F1 || need_T2 || need_T23)
+        {
+            blaschke_1p.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                blaschke_1p[i] = _traits.blaschke_1p(s[i]);
+            }
+        }
+
+        if (need_F2)
+        {
+            blaschke_0m.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                blaschke_0m[i] = _traits.blaschke_0m(s[i]);
+            }
+        }
+
+        const auto series = [&](const std::array<double, 4> & coefficients, const std::vector<double> & blaschke,
+                const double & K, const unsigned & a, const unsigned & b, const unsigned & c, const double & chi)
+        {
+            std::vector<double> result(n);
+            power_series(coefficients, z, result);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                result[i] = result[i] / _phi(s[i], _traits.t_0, K, a, b, c, chi) / blaschke[i];
+            }
+
+            return result;
+        };
+
+        std::vector<double> g, f, F1, F2, T1, T2, T23;
+        if (need_g)
+        {
+            g = series({ _a_g[0], _a_g[1], _a_g[2], _a_g[3] }, blaschke_1m, 96.0, 3, 3, 1, _traits.chi_1m);
+        }
+
+        if (need_f)
+        {
+            f = series({ _a_f[0], _a_f[1], _a_f[2], _a_f[3] }, blaschke_1p, 24.0, 1, 1, 1, _traits.chi_1p);
+        }
+
+        if (need_F1)
+        {
+            F1 = series({ a_F1_0(), _a_F1[0], _a_F1[1], _a_F1[2] }, blaschke_1p, 48.0, 1, 1, 2, _traits.chi_1p);
+        }
+
+        if (need_F2)
+        {
+            F2 = series({ a_F2_0(), _a_F2[0], _a_F2[1], _a_F2[2] }, blaschke_0m, 64.0, 3, 3, 1, _traits.chi_0m);
+        }
+
+        if (need_T1)
+        {
+            T1 = series({ _a_T1[0], _a_T1[1], _a_T1[2], _a_T1[3] }, blaschke_1m, 24.0, 3, 3, 2, _traits.chi_T_1m);
+        }
+
+        if (need_T2)
+        {
+            T2 = series({ a_T2_0(), _a_T2[0], _a_T2[1], _a_T2[2] }, blaschke_1p, 24.0 / (tp * tm), 1, 1, 2, _traits.chi_T_1p);
+        }
+
+        if (need_T23)
+        {
+            T23 = series({ a_T23_0(), _a_T23[0], _a_T23[1], _a_T23[2] }, blaschke_1p, 3.0 * tp / (m_B2 * m_V2), 1, 1, 1, _traits.chi_T_1p);
+        }
+
+        for (std::size_t i = 0; i < results.v.size(); ++i)
+        {
+            results.v[i] = (m_B + m_V) / 2.0 * g[i];
+        }
+
+        for (std::size_t i = 0; i < results.a_0.size(); ++i)
+        {
+            results.a_0[i] = F2[i] / 2.0;
+        }
+
+        for (std::size_t i = 0; i < results.a_1.size(); ++i)
+        {
+            results.a_1[i] = 1.0 / (m_B + m_V) * f[i];
+        }
+
+        for (std::size_t i = 0; i < results.a_2.size(); ++i)
+        {
+            results.a_2[i] = (m_B + m_V) / eos::lambda(m_B2, m_V2, s[i]) * ((m_B2 - m_V2 - s[i]) * f[i] - 2.0 * m_V * F1[i]);
+        }
+
+        for (std::size_t i = 0; i < results.a_12.size(); ++i)
+        {
+            results.a_12[i] = F1[i] / (8.0 * m_B * m_V);
+        }
+
+        if (! results.t_1.empty())
+        {
+            results.t_1 = T1;
+        }
+
+        if (! results.t_2.empty())
+        {
+            results.t_2 = T2;
+        }
+
+        for (std::size_t i = 0; i < results.t_3.size(); ++i)
+        {
+            results.t_3[i] = ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - s[i]) * T2[i] - 8.0 * m_B * m_V2 * (m_B - m_V) * T23[i])
+                    / eos::lambda(m_B2, m_V2, s[i]);
+        }
+
+        if (! results.t_23.empty())
+        {
+            results.t_23 = T23;
+        }
+
+        // the helicity form factors are not yet available in this parametrisation
+        for (std::size_t i = 0; i < results.f_perp.size(); ++i)
+        {
+            results.f_perp[i] = f_perp(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_para.size(); ++i)
+        {
+            results.f_para[i] = f_para(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_long.size(); ++i)
+        {
+            results.f_long[i] = f_long(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_perp_T.size(); ++i)
+        {
+            results.f_perp_T[i] = f_perp_T(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_para_T.size(); ++i)
+        {
+            results.f_para_T[i] = f_para_T(s[i]);
+        }
+
+        for (std::size_t i = 0; i < results.f_long_T.size(); ++i)
+        {
+            results.f_long_T[i] = f_long_T(s[i]);
+        }
+    }
+
     template<typename Process_>
     double BGL1997FormFactors<Process_, PToV>::saturation_0p_v() const
     {
@@ -533,6 +713,76 @@ namespace eos
         return 0.0; //  TODO
     }
 
+    template<typename Process_>
+    void BGL1997FormFactors<Process_, PToP>::_evaluate(std::span<const double> s, Batch & results) const
+    {
+        const std::size_t n = s.size();
+
+        const double tp = _traits.tp(), tm = _traits.tm();
+
+        const bool need_1m = ! results.f_p.empty() || ! results.f_t.empty();
+
+        // z(s) and the Blaschke factors are shared among the form factors
+        std::vector<double> z(n), blaschke_1m, blaschke_0p;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            z[i] = _traits._z(s[i], _traits.t_0, tp);
+        }
+
+        if (need_1m)
+        {
+            blaschke_1m.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                blaschke_1m[i] = _traits.blaschke_1m(s[i]);
+            }
+        }
+
+        if (! results.f_0.empty())
+        {
+            blaschke_0p.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                blaschke_0p[i] = _traits.blaschke_0p(s[i]);
+            }
+        }
+
+        if (! results.f_p.empty())
+        {
+            power_series(std::array<double, 4>{ _a_f_p[0], _a_f_p[1], _a_f_p[2], _a_f_p[3] }, z, results.f_p);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_p[i] = results.f_p[i] / _phi(s[i], _traits.t_0, 48, 3, 3, 2, _traits.chi_1m) / blaschke_1m[i];
+            }
+        }
+
+        if (! results.f_0.empty())
+        {
+            // Note that EOS's definition of f0 = fp + t / sqrt(tm * tp) * fm differs from the one in [BGL:1997A]
+            const double norm = sqrt(tm * tp);
+
+            power_series(std::array<double, 4>{ a_0_0(), _a_f_0[0], _a_f_0[1], _a_f_0[2] }, z, results.f_0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_0[i] = results.f_0[i] / (norm * _phi(s[i], _traits.t_0, 16, 1, 1, 1, _traits.chi_0p)) / blaschke_0p[i];
+            }
+        }
+
+        if (! results.f_t.empty())
+        {
+            power_series(std::array<double, 4>{ _a_f_t[0], _a_f_t[1], _a_f_t[2], _a_f_t[3] }, z, results.f_t);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_t[i] = results.f_t[i] / _phi(s[i], _traits.t_0, 48.0 * tp, 3, 3, 1, _traits.chi_T_1m) / blaschke_1m[i];
+            }
+        }
+
+        for (std::size_t i = 0; i < results.f_plus_T.size(); ++i)
+        {
+            results.f_plus_T[i] = f_plus_T(s[i]);
+        }
+    }
+
     template <typename Process_>
     double BGL1997FormFactors<Process_, PToP>::saturation_0p_v() const
     {
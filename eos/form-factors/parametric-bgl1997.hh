@@ -281,6 +281,9 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // computes z(s) and the Blaschke factors once per point for all form factors, and the constrained coefficients once per batch
+            virtual void _evaluate(std::span<const double> s, Batch & results) const override;
+
         public:
             BGL1997FormFactors(const Parameters &, const Options &);
             ~BGL1997FormFactors();
@@ -357,6 +360,9 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // computes z(s) and the Blaschke factors once per point for all form factors, and the constrained coefficients once per batch
+            virtual void _evaluate(std::span<const double> s, Batch & results) const override;
+
         public:
             BGL1997FormFactors(const Parameters &, const Options &);
             ~BGL1997FormFactors();
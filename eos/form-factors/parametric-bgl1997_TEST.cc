@@ -580,6 +580,24 @@ class BGL1997FormFactorsTest :
 
                 TEST_CHECK_NEARLY_EQUAL(ff.t_1(0.0),  ff.t_2(0.0),                                                                      eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.t_23(t_m), (mB + mV) * (mB * mB + 3.0 * mV * mV - t_m) / (8.0 * mB * mV * mV) * ff.t_2(t_m), eps);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    const std::vector<double> q2{ -2.0, 1.0, 4.0, 7.0, 10.0 };
+
+                    using FF = FormFactors<PToV>;
+                    check_batch_evaluation<FF>(ff, q2, {
+                            { &FF::Batch::v,    &FF::v    },
+                            { &FF::Batch::a_0,  &FF::a_0  },
+                            { &FF::Batch::a_1,  &FF::a_1  },
+                            { &FF::Batch::a_2,  &FF::a_2  },
+                            { &FF::Batch::a_12, &FF::a_12 },
+                            { &FF::Batch::t_1,  &FF::t_1  },
+                            { &FF::Batch::t_2,  &FF::t_2  },
+                            { &FF::Batch::t_3,  &FF::t_3  },
+                            { &FF::Batch::t_23, &FF::t_23 }
+                        });
+                }
             }
 
             /* B -> D FFs*/
@@ -656,6 +674,14 @@ class BGL1997FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(-2.0), 0.161964,  eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+1.0), 0.177010,  eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+4.0), 0.195134,  eps);
+
+                // batch evaluation agrees with the scalar interface
+                {
+                    const std::vector<double> q2{ -2.0, 1.0, 4.0, 7.0, 10.0 };
+
+                    using FF = FormFactors<PToP>;
+                    check_batch_evaluation<FF>(ff, q2, { { &FF::Batch::f_p, &FF::f_p }, { &FF::Batch::f_0, &FF::f_0 }, { &FF::Batch::f_t, &FF::f_t } });
+                }
             }
         }
 } BGL1997_form_factor_test;
@@ -22,6 +22,11 @@
 
 #include <eos/form-factors/parametric-bsz2015.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/maths/power-series.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace eos
 {
@@ -311,6 +316,122 @@ namespace eos
                 - s * lambda / (2 * power_of<3>(_mB) * _mV * (power_of<2>(_mB) - power_of<2>(_mV))) * t_3(s);
     }
 
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToV>::_evaluate(std::span<const double> s, Batch & results) const
+    {
+        const double tp = _traits.tp();
+
+        // the real conformal mapping is only valid below the pair-production threshold
+        if (std::any_of(s.begin(), s.end(), [&tp](const double & x) { return x > tp; }))
+        {
+            return FormFactors<PToV>::_evaluate(s, results);
+        }
+
+        const std::size_t n = s.size();
+
+        const double m_B = _mB(), m_B2 = power_of<2>(m_B), m_B3 = power_of<3>(m_B);
+        const double m_V = _mV(), m_V2 = power_of<2>(m_V);
+
+        const double sqrt_tp_t0 = std::sqrt(tp - _traits.t0());
+        const double z_0        = _traits.calc_z(0.0);
+
+        const double m2_R_0m = power_of<2>(_traits.m_R_0m());
+        const double m2_R_1m = power_of<2>(_traits.m_R_1m());
+        const double m2_R_1p = power_of<2>(_traits.m_R_1p());
+
+        // z(s) - z(0) and the pole factors, computed once per value of s
+        std::vector<double> dz(n), pole_0m(n), pole_1m(n), pole_1p(n), lambda(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double sqrt_tp_s = std::sqrt(tp - s[i]);
+
+            dz[i]      = (sqrt_tp_s - sqrt_tp_t0) / (sqrt_tp_s + sqrt_tp_t0) - z_0;
+            pole_0m[i] = 1.0 / (1.0 - s[i] / m2_R_0m);
+            pole_1m[i] = 1.0 / (1.0 - s[i] / m2_R_1m);
+            pole_1p[i] = 1.0 / (1.0 - s[i] / m2_R_1p);
+            lambda[i]  = eos::lambda(m_B2, m_V2, s[i]);
+        }
+
+        const auto calc_ff = [&dz, &n](const std::array<double, 3> & a, const std::vector<double> & pole)
+        {
+            std::vector<double> result(n);
+            power_series(a, dz, result);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                result[i] *= pole[i];
+            }
+
+            return result;
+        };
+
+        const std::vector<double> v    = calc_ff({ _a_V[0], _a_V[1], _a_V[2] }, pole_1m);
+        const std::vector<double> a_0  = calc_ff({ _a_A0[0], _a_A0[1], _a_A0[2] }, pole_0m);
+        const std::vector<double> a_1  = calc_ff({ _a_A1[0], _a_A1[1], _a_A1[2] }, pole_1p);
+        // use constraint (B.6) in [BSZ:2015A] to remove A_12(0)
+        const std::vector<double> a_12 = calc_ff({ (m_B2 - m_V2) / (8.0 * m_B * m_V) * _a_A0[0], _a_A12[0], _a_A12[1] }, pole_1p);
+        const std::vector<double> t_1  = calc_ff({ _a_T1[0], _a_T1[1], _a_T1[2] }, pole_1m);
+        // use constraint T_1(0) = T_2(0) to replace T_2(0)
+        const std::vector<double> t_2  = calc_ff({ _a_T1[0], _a_T2[0], _a_T2[1] }, pole_1p);
+        const std::vector<double> t_23 = calc_ff({ _a_T23[0], _a_T23[1], _a_T23[2] }, pole_1p);
+
+        std::vector<double> a_2(n), t_3(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a_2[i] = (power_of<2>(m_B + m_V) * (m_B2 - m_V2 - s[i]) * a_1[i] - 16.0 * m_B * m_V2 * (m_B + m_V) * a_12[i]) / lambda[i];
+            t_3[i] = ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - s[i]) * t_2[i] - 8.0 * m_B * m_V2 * (m_B - m_V) * t_23[i]) / lambda[i];
+        }
+
+        const auto assign = [](std::vector<double> & result, const std::vector<double> & values)
+        {
+            if (! result.empty())
+            {
+                result = values;
+            }
+        };
+
+        assign(results.v,    v);
+        assign(results.a_0,  a_0);
+        assign(results.a_1,  a_1);
+        assign(results.a_2,  a_2);
+        assign(results.a_12, a_12);
+        assign(results.t_1,  t_1);
+        assign(results.t_2,  t_2);
+        assign(results.t_3,  t_3);
+        assign(results.t_23, t_23);
+
+        for (std::size_t i = 0; i < results.f_perp.size(); ++i)
+        {
+            results.f_perp[i] = std::sqrt(2.0 * lambda[i]) / m_B / (m_B + m_V) * v[i];
+        }
+
+        for (std::size_t i = 0; i < results.f_para.size(); ++i)
+        {
+            results.f_para[i] = std::sqrt(2.0) * (m_B + m_V) / m_B * a_1[i];
+        }
+
+        for (std::size_t i = 0; i < results.f_long.size(); ++i)
+        {
+            results.f_long[i] = ((m_B2 - m_V2 - s[i]) * power_of<2>(m_B + m_V) * a_1[i] - lambda[i] * a_2[i]) / (2.0 * m_V * m_B2 * (m_B + m_V));
+        }
+
+        for (std::size_t i = 0; i < results.f_perp_T.size(); ++i)
+        {
+            results.f_perp_T[i] = std::sqrt(2.0 * lambda[i]) / m_B2 * t_1[i];
+        }
+
+        for (std::size_t i = 0; i < results.f_para_T.size(); ++i)
+        {
+            results.f_para_T[i] = std::sqrt(2.0) * (m_B2 - m_V2) / m_B2 * t_2[i];
+        }
+
+        for (std::size_t i = 0; i < results.f_long_T.size(); ++i)
+        {
+            results.f_long_T[i] = s[i] * (m_B2 + 3.0 * m_V2 - s[i]) / (2.0 * m_B3 * m_V) * t_2[i]
+                                - s[i] * lambda[i] / (2.0 * m_B3 * m_V * (m_B2 - m_V2)) * t_3[i];
+        }
+    }
+
 
     // P -> P
     template <typename Process_>
@@ -447,6 +568,75 @@ namespace eos
     {
         return real(f_plus_T(complex<double>(s)));
     }
+
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToP>::_evaluate(std::span<const double> s, Batch & results) const
+    {
+        const double tp = _traits.tp();
+
+        // the real conformal mapping is only valid below the pair-production threshold
+        if (std::any_of(s.begin(), s.end(), [&tp](const double & x) { return x > tp; }))
+        {
+            return FormFactors<PToP>::_evaluate(s, results);
+        }
+
+        const std::size_t n = s.size();
+
+        const double sqrt_tp_t0 = std::sqrt(tp - _traits.t0());
+        const double z_0        = _traits.calc_z(0.0);
+
+        const double m2_R_0p = power_of<2>(_traits.m_R_0p());
+        const double m2_R_1m = power_of<2>(_traits.m_R_1m());
+
+        // z(s) - z(0), computed once per value of s
+        std::vector<double> dz(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double sqrt_tp_s = std::sqrt(tp - s[i]);
+
+            dz[i] = (sqrt_tp_s - sqrt_tp_t0) / (sqrt_tp_s + sqrt_tp_t0) - z_0;
+        }
+
+        if (! results.f_p.empty())
+        {
+            power_series(std::array<double, 3>{ _a_fp[0], _a_fp[1], _a_fp[2] }, dz, results.f_p);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_p[i] /= 1.0 - s[i] / m2_R_1m;
+            }
+        }
+
+        if (! results.f_0.empty())
+        {
+            // use equation of motion to replace f_0(0) by f_+(0)
+            power_series(std::array<double, 3>{ _a_fp[0], _a_fz[0], _a_fz[1] }, dz, results.f_0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_0[i] /= 1.0 - s[i] / m2_R_0p;
+            }
+        }
+
+        if (! results.f_t.empty())
+        {
+            power_series(std::array<double, 3>{ _a_ft[0], _a_ft[1], _a_ft[2] }, dz, results.f_t);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_t[i] /= 1.0 - s[i] / m2_R_1m;
+            }
+        }
+
+        if (! results.f_plus_T.empty())
+        {
+            const double m_B = _mB(), m_P = _mP();
+
+            power_series(std::array<double, 3>{ _a_ft[0], _a_ft[1], _a_ft[2] }, dz, results.f_plus_T);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results.f_plus_T[i] *= s[i] / m_B / (m_B + m_P) / (1.0 - s[i] / m2_R_1m);
+            }
+        }
+    }
 }
 
 #endif
@@ -104,6 +104,9 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // computes z(s) and the pole factors once per value of s
+            virtual void _evaluate(std::span<const double> s, Batch & results) const override;
+
         public:
             BSZ2015FormFactors(const Parameters & p, const Options &);
 
@@ -234,6 +237,9 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // computes z(s) and the pole factors once per value of s
+            virtual void _evaluate(std::span<const double> s, Batch & results) const override;
+
         public:
             BSZ2015FormFactors(const Parameters & p, const Options &);
 
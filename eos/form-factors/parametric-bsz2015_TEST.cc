@@ -21,6 +21,8 @@
 #include <test/test.hh>
 #include <eos/form-factors/parametric-bsz2015-impl.hh>
 
+#include <vector>
+
 using namespace test;
 using namespace eos;
 
@@ -81,6 +83,21 @@ class BToPiBSZ2015FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(10.0), 1.73442, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(15.0), 2.64425, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff->f_t(20.0), 4.99850, eps);
+
+                // batch evaluation agrees with the scalar interface, including above the threshold
+                using FF = FormFactors<PToP>;
+                for (const auto & q2 : { std::vector<double>{ 0.0, 5.0, 10.0, 15.0, 20.0 }, std::vector<double>{ 5.0, 30.0 } })
+                {
+                    check_batch_evaluation<FF>(*ff, q2, { { &FF::Batch::f_p, &FF::f_p }, { &FF::Batch::f_0, &FF::f_0 }, { &FF::Batch::f_t, &FF::f_t }, { &FF::Batch::f_plus_T, &FF::f_plus_T } });
+                }
+
+                // buffers of the wrong size are rejected
+                {
+                    FormFactors<PToP>::Batch batch;
+                    batch.f_0.resize(2);
+
+                    TEST_CHECK_THROWS(InternalError, ff->evaluate(std::vector<double>{ 1.0, 2.0, 3.0 }, batch));
+                }
             }
         }
 } b_to_pi_bsz2015_form_factors_test;
@@ -236,6 +253,41 @@ class BToKstarBSZ2015FormFactorsTest :
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(2.1), 0.200925, eps);
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(4.1), 0.219004, eps);
             TEST_CHECK_NEARLY_EQUAL(ff->t_3(6.1), 0.239587, eps);
+
+            // batch evaluation agrees with the scalar interface
+            {
+                using FF = FormFactors<PToV>;
+                const std::vector<double> q2{ 0.1, 2.1, 4.1, 6.1, 12.0, 18.0 };
+
+                const auto batch = check_batch_evaluation<FF>(*ff, q2, {
+                        { &FF::Batch::v,        &FF::v        },
+                        { &FF::Batch::a_0,      &FF::a_0      },
+                        { &FF::Batch::a_1,      &FF::a_1      },
+                        { &FF::Batch::a_2,      &FF::a_2      },
+                        { &FF::Batch::a_12,     &FF::a_12     },
+                        { &FF::Batch::t_1,      &FF::t_1      },
+                        { &FF::Batch::t_2,      &FF::t_2      },
+                        { &FF::Batch::t_3,      &FF::t_3      },
+                        { &FF::Batch::t_23,     &FF::t_23     },
+                        { &FF::Batch::f_perp,   &FF::f_perp   },
+                        { &FF::Batch::f_para,   &FF::f_para   },
+                        { &FF::Batch::f_long,   &FF::f_long   },
+                        { &FF::Batch::f_perp_T, &FF::f_perp_T },
+                        { &FF::Batch::f_para_T, &FF::f_para_T },
+                        { &FF::Batch::f_long_T, &FF::f_long_T }
+                    });
+
+                // only the requested form factors are evaluated
+                FormFactors<PToV>::Batch partial;
+                partial.a_2.resize(q2.size());
+
+                ff->evaluate(q2, partial);
+                TEST_CHECK(partial.v.empty());
+                for (std::size_t i = 0; i < q2.size(); ++i)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(partial.a_2[i], batch.a_2[i], 1e-15);
+                }
+            }
         }
 } b_to_kstar_bsz2015_form_factors_test;
 
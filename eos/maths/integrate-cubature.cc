@@ -106,10 +106,97 @@
 
 #include "integrate-cubature.hh"
 
+#include <utility>
+#include <vector>
+
 /* error return codes */
 #define SUCCESS 0
 #define FAILURE 1
 
+/***************************************************************************/
+/* Per-thread arena for the region data and the cubature rules.
+
+   The integration routines below allocate and free two small blocks for
+   every region they create, and one rule with its evaluation buffers for
+   every call.  Integrated observables call these routines in tight loops,
+   so freed blocks and rules are kept in per-thread free lists and handed
+   out again by later calls.  Rules are checked out for the duration of a
+   call, so that nested integrations never share a rule. */
+
+namespace
+{
+    class BlockPool
+    {
+        private:
+            /* free blocks, grouped by their size in bytes */
+            std::vector<std::pair<size_t, std::vector<void *>>> _free;
+
+            /* maximal number of free blocks kept per size */
+            static constexpr size_t max_free_blocks = 1 << 16;
+
+            std::vector<void *> &
+            _free_list(size_t size)
+            {
+                for (auto & [s, list] : _free)
+                {
+                    if (s == size)
+                    {
+                        return list;
+                    }
+                }
+
+                return _free.emplace_back(size, std::vector<void *>()).second;
+            }
+
+        public:
+            ~BlockPool()
+            {
+                for (auto & [s, list] : _free)
+                {
+                    for (void * p : list)
+                    {
+                        free(p);
+                    }
+                }
+            }
+
+            void *
+            allocate(size_t size)
+            {
+                auto & list = _free_list(size);
+                if (list.empty())
+                {
+                    return malloc(size);
+                }
+
+                void * result = list.back();
+                list.pop_back();
+
+                return result;
+            }
+
+            void
+            release(void * p, size_t size)
+            {
+                if (! p)
+                {
+                    return;
+                }
+
+                auto & list = _free_list(size);
+                if (list.size() >= max_free_blocks)
+                {
+                    free(p);
+                    return;
+                }
+
+                list.push_back(p);
+            }
+    };
+
+    thread_local BlockPool block_pool;
+} // namespace
+
 /***************************************************************************/
 /* Basic datatypes */
 
@@ -158,7 +245,7 @@ make_hypercube(unsigned dim, const double * center, const double * halfwidth)
     unsigned  i;
     hypercube h;
     h.dim  = dim;
-    h.data = (double *) malloc(sizeof(double) * dim * 2);
+    h.data = (double *) block_pool.allocate(sizeof(double) * dim * 2);
     h.vol  = 0;
     if (h.data)
     {
@@ -192,7 +279,7 @@ make_hypercube_range(unsigned dim, const double * xmin, const double * xmax)
 static void
 destroy_hypercube(hypercube * h)
 {
-    free(h->data);
+    block_pool.release(h->data, sizeof(double) * h->dim * 2);
     h->dim = 0;
 }
 
@@ -212,7 +299,7 @@ make_region(const hypercube * h, unsigned fdim)
     R.h        = make_hypercube(h->dim, h->data, h->data + h->dim);
     R.splitDim = 0;
     R.fdim     = fdim;
-    R.ee       = R.h.data ? (esterr *) malloc(sizeof(esterr) * fdim) : NULL;
+    R.ee       = R.h.data ? (esterr *) block_pool.allocate(sizeof(esterr) * fdim) : NULL;
     R.errmax   = HUGE_VAL;
     return R;
 }
@@ -221,7 +308,7 @@ static void
 destroy_region(region * R)
 {
     destroy_hypercube(&R->h);
-    free(R->ee);
+    block_pool.release(R->ee, sizeof(esterr) * R->fdim);
     R->ee = 0;
 }
 
@@ -239,7 +326,7 @@ cut_region(region * R, region * R2)
     }
     R->h.data[d]  -= R->h.data[d + dim];
     R2->h.data[d] += R->h.data[d + dim];
-    R2->ee         = (esterr *) malloc(sizeof(esterr) * R2->fdim);
+    R2->ee         = (esterr *) block_pool.allocate(sizeof(esterr) * R2->fdim);
     return R2->ee == NULL;
 }
 
@@ -869,6 +956,68 @@ make_rule15gauss(unsigned dim, unsigned fdim)
     return make_rule(sizeof(rule), dim, fdim, 15, rule15gauss_evalError, 0);
 }
 
+/***************************************************************************/
+/* Per-thread pool of cubature rules, cf. the arena for the region data
+   above.  A rule keeps its buffer of evaluation points when it is returned
+   to the pool. */
+
+namespace
+{
+    class RulePool
+    {
+        private:
+            std::vector<rule *> _free;
+
+            /* maximal number of free rules kept */
+            static constexpr size_t max_free_rules = 16;
+
+        public:
+            ~RulePool()
+            {
+                for (rule * r : _free)
+                {
+                    destroy_rule(r);
+                }
+            }
+
+            rule *
+            acquire(unsigned dim, unsigned fdim)
+            {
+                for (auto i = _free.begin(); i != _free.end(); ++i)
+                {
+                    if (((*i)->dim == dim) && ((*i)->fdim == fdim))
+                    {
+                        rule * result = *i;
+                        _free.erase(i);
+
+                        return result;
+                    }
+                }
+
+                return dim == 1 ? make_rule15gauss(dim, fdim) : make_rule75genzmalik(dim, fdim);
+            }
+
+            void
+            release(rule * r)
+            {
+                if (! r)
+                {
+                    return;
+                }
+
+                if (_free.size() >= max_free_rules)
+                {
+                    destroy_rule(_free.front());
+                    _free.erase(_free.begin());
+                }
+
+                _free.push_back(r);
+            }
+    };
+
+    thread_local RulePool rule_pool;
+} // namespace
+
 /***************************************************************************/
 /* binary heap implementation (ala _Introduction to Algorithms_ by
    Cormen, Leiserson, and Rivest), for use as a priority queue of
@@ -1329,7 +1478,7 @@ cubature(unsigned fdim, integrand_v f, void * fdata, unsigned dim, const double
         }
         return SUCCESS;
     }
-    r = dim == 1 ? make_rule15gauss(dim, fdim) : make_rule75genzmalik(dim, fdim);
+    r = rule_pool.acquire(dim, fdim);
     if (! r)
     {
         for (i = 0; i < fdim; ++i)
@@ -1342,7 +1491,7 @@ cubature(unsigned fdim, integrand_v f, void * fdata, unsigned dim, const double
     h      = make_hypercube_range(dim, xmin, xmax);
     status = ! h.data ? FAILURE : rulecubature(r, fdim, f, fdata, &h, maxEval, reqAbsError, reqRelError, norm, val, err, parallel);
     destroy_hypercube(&h);
-    destroy_rule(r);
+    rule_pool.release(r);
     return status;
 }
 
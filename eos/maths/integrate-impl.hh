@@ -50,6 +50,45 @@ namespace eos
 
             return 0;
         }
+
+        template <size_t ndim_, size_t fdim_, typename T_> struct batch_integrand_data
+        {
+                using integrand_traits = cubature::integrand_traits<ndim_, fdim_, T_>;
+
+                const cubature::batch_integrand<ndim_, fdim_, T_> & f;
+
+                // buffers for the arguments and results, reused across calls of the integrand
+                std::vector<typename integrand_traits::argument_type> arguments;
+                std::vector<typename integrand_traits::result_type>   results;
+        };
+
+        template <size_t ndim_, size_t fdim_, typename T_>
+        int
+        batch_integrand_wrapper(unsigned ndim, size_t npt, const double * x, void * data, unsigned fdim, double * fval)
+        {
+            using integrand_traits = cubature::integrand_traits<ndim_, fdim_, T_>;
+
+            assert(ndim == ndim_);
+            assert(fdim == integrand_traits::buffer_size);
+
+            auto & d = *static_cast<batch_integrand_data<ndim_, fdim_, T_> *>(data);
+            d.arguments.resize(npt);
+            d.results.resize(npt);
+
+            for (size_t i = 0; i < npt; ++i)
+            {
+                integrand_traits::copy_arguments(x + i * ndim_, d.arguments[i]);
+            }
+
+            d.f(d.arguments, d.results);
+
+            for (size_t i = 0; i < npt; ++i)
+            {
+                integrand_traits::copy_result(d.results[i], fval + i * integrand_traits::buffer_size);
+            }
+
+            return 0;
+        }
     } // namespace cubature
 
     template <size_t ndim_, size_t fdim_, typename T_>
@@ -73,7 +112,7 @@ namespace eos
                       config.maxeval(),
                       config.epsabs(),
                       config.epsrel(),
-                      ERROR_L2,
+                      config.individual_errors() ? ERROR_INDIVIDUAL : ERROR_L2,
                       integrand_traits::pointer_from_buffer(result_buffer),
                       integrand_traits::pointer_from_buffer(error_buffer)))
         {
@@ -82,6 +121,38 @@ namespace eos
 
         return integrand_traits::contruct_result(result_buffer);
     }
+
+    template <size_t ndim_, size_t fdim_, typename T_>
+    typename cubature::integrand_traits<ndim_, fdim_, T_>::result_type
+    integrate_batch(const cubature::batch_integrand<ndim_, fdim_, T_> & f, const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & a,
+                    const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & b, const cubature::Config & config)
+    {
+        using integrand_traits = cubature::integrand_traits<ndim_, fdim_, T_>;
+        using cubature::batch_integrand_wrapper;
+
+        cubature::batch_integrand_data<ndim_, fdim_, T_> data{ f, {}, {} };
+
+        constexpr unsigned                     nintegrands = integrand_traits::buffer_size;
+        typename integrand_traits::buffer_type result_buffer;
+        typename integrand_traits::buffer_type error_buffer;
+        if (hcubature_v(nintegrands,
+                        &batch_integrand_wrapper<ndim_, fdim_, T_>,
+                        &data,
+                        ndim_,
+                        integrand_traits::pointer_from_arguments(a),
+                        integrand_traits::pointer_from_arguments(b),
+                        config.maxeval(),
+                        config.epsabs(),
+                        config.epsrel(),
+                        config.individual_errors() ? ERROR_INDIVIDUAL : ERROR_L2,
+                        integrand_traits::pointer_from_buffer(result_buffer),
+                        integrand_traits::pointer_from_buffer(error_buffer)))
+        {
+            throw IntegrationError("hcubature_v failed");
+        }
+
+        return integrand_traits::contruct_result(result_buffer);
+    }
 } // namespace eos
 
 #endif
@@ -0,0 +1,324 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_INTEGRATE_PANELS_HH
+#define EOS_GUARD_EOS_MATHS_INTEGRATE_PANELS_HH 1
+
+#include <eos/maths/legendre-polynomial-vector.hh>
+#include <eos/utils/decay-pool.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/parameters.hh>
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eos
+{
+    namespace panels
+    {
+        // accumulate the weighted values of scalar and vector-valued integrands
+        inline void
+        accumulate(double & result, const double & weight, const double & value)
+        {
+            result += weight * value;
+        }
+
+        template <std::size_t n_>
+        void
+        accumulate(std::array<double, n_> & result, const double & weight, const std::array<double, n_> & value)
+        {
+            for (std::size_t i = 0; i < n_; ++i)
+            {
+                result[i] += weight * value[i];
+            }
+        }
+    } // namespace panels
+
+    /*!
+     * PanelIntegrator integrates functions of q^2 with a fixed Gauss-Legendre rule on a global partition of the q^2 axis.
+     *
+     * The q^2 axis is partitioned into panels of fixed width, starting at q^2 = 0. An integral over [a, b] is split at the
+     * panel boundaries into pieces, each of which is integrated with a points_-point Gauss-Legendre rule. The values of an
+     * expensive function, e.g. the amplitudes of a decay, at the nodes of each piece are cached, and are reused by all
+     * integrals that share the piece. The cached values are valid for one parameter point only, and are discarded as soon
+     * as any of the parameters used by the decay changes.
+     *
+     * If a boundary of an integral is a threshold of the function, e.g. at q^2 = 4 m_l^2 or at the kinematic endpoint
+     * q^2 = (m_B - m_V)^2, the piece adjacent to it is refined geometrically towards the threshold. This accounts for the
+     * square-root behaviour of the phase space, and for the photon pole close to the threshold for light leptons.
+     *
+     * All decay objects of the same type that use the same Parameters object and equal Options share one PanelIntegrator,
+     * which is obtained through make().
+     */
+    template <typename Decay_, typename Value_, unsigned points_ = 8> class PanelIntegrator
+    {
+        public:
+            using Function = std::function<Value_(const double &)>;
+
+            // width of the panels in GeV^2
+            static constexpr double panel_width = 0.5;
+
+            // ratio of the widths of adjacent pieces, and number of levels of the refinement towards a threshold
+            static constexpr double   refinement_ratio  = 0.2;
+            static constexpr unsigned refinement_levels = 12;
+
+            // largest distance in GeV^2 between an integration boundary and a threshold for the boundary to count as the threshold
+            static constexpr double threshold_tolerance = 1.0e-3;
+
+            /*!
+             * Determine whether an integration boundary coincides with a threshold of the integrand.
+             *
+             * @param boundary  The integration boundary.
+             * @param threshold The position of the threshold.
+             */
+            static bool
+            at_threshold(const double & boundary, const double & threshold)
+            {
+                return std::abs(boundary - threshold) <= threshold_tolerance;
+            }
+
+        private:
+            Parameters _parameters;
+
+            Mutex _mutex;
+
+            // Gauss-Legendre nodes and weights on the interval [-1, +1]
+            std::array<double, points_> _nodes, _weights;
+
+            // the parameters used by the decay, and their generations when the cached values were computed
+            std::vector<Parameter> _used;
+
+            std::vector<unsigned long> _generations;
+
+            // the function values at the nodes of each piece, keyed by the boundaries of the piece
+            std::map<std::pair<double, double>, std::array<Value_, points_>> _pieces;
+
+            // Requires the mutex to be held
+            void
+            _update(const ParameterUser & user)
+            {
+                if (_used.empty())
+                {
+                    for (const auto & id : user)
+                    {
+                        _used.push_back(_parameters[id]);
+                    }
+                    _generations.assign(_used.size(), std::numeric_limits<unsigned long>::max());
+                }
+
+                // without any used parameters we cannot tell whether the cached values are still valid
+                bool changed = _used.empty();
+                for (unsigned i = 0; i < _used.size(); ++i)
+                {
+                    const unsigned long generation = _used[i].generation();
+                    if (generation != _generations[i])
+                    {
+                        _generations[i] = generation;
+                        changed         = true;
+                    }
+                }
+
+                if (changed)
+                {
+                    _pieces.clear();
+                }
+            }
+
+            // The boundaries of the pieces of [a, b], with a < b
+            static std::vector<double>
+            _boundaries(const double & a, const double & b, const bool & threshold_a, const bool & threshold_b)
+            {
+                // avoid pieces of vanishing width due to rounding errors
+                static constexpr double eps = 1.0e-10 * panel_width;
+
+                std::vector<double> result{ a };
+                for (double k = std::floor(a / panel_width) + 1.0; k * panel_width < b - eps; k += 1.0)
+                {
+                    const double x = k * panel_width;
+                    if (x - result.back() > eps)
+                    {
+                        result.push_back(x);
+                    }
+                }
+                result.push_back(b);
+
+                // a single piece with two thresholds is split, such that each threshold is refined within its own half
+                if (threshold_a && threshold_b && (2 == result.size()))
+                {
+                    result.insert(result.begin() + 1, (a + b) / 2.0);
+                }
+
+                // refine the last piece geometrically towards the threshold at b
+                if (threshold_b)
+                {
+                    const double width = b - result[result.size() - 2];
+                    result.pop_back();
+                    for (unsigned level = 1; level <= refinement_levels; ++level)
+                    {
+                        result.push_back(b - width * std::pow(refinement_ratio, level));
+                    }
+                    result.push_back(b);
+                }
+
+                // refine the first piece geometrically towards the threshold at a
+                if (threshold_a)
+                {
+                    const double        width = result[1] - a;
+                    std::vector<double> refined{ a };
+                    for (unsigned level = refinement_levels; level > 0; --level)
+                    {
+                        refined.push_back(a + width * std::pow(refinement_ratio, level));
+                    }
+                    refined.insert(refined.end(), result.begin() + 1, result.end());
+
+                    return refined;
+                }
+
+                return result;
+            }
+
+        public:
+            PanelIntegrator(const Parameters & parameters, const Options &) :
+                _parameters(parameters)
+            {
+                LegendrePVector<points_> lp;
+                lp.gauss_legendre(_nodes, _weights);
+            }
+
+            ~PanelIntegrator() {}
+
+            /*!
+             * Retrieve the PanelIntegrator shared by all decay objects with the given parameters and options.
+             *
+             * @param parameters The parameters used by the decay object.
+             * @param options    The options used by the decay object.
+             */
+            static std::shared_ptr<PanelIntegrator>
+            make(const Parameters & parameters, const Options & options)
+            {
+                auto shared = DecayPool<PanelIntegrator>::instance()->get(parameters, options);
+
+                return std::shared_ptr<PanelIntegrator>(shared, &shared->decay);
+            }
+
+            /*!
+             * Integrate a function of the cached values over q^2.
+             *
+             * @param user        The decay object, whose used parameters determine the validity of the cached values.
+             * @param f           The function whose values are cached at the nodes.
+             * @param g           The integrand, as a function of the value of f and of q^2.
+             * @param a           The lower integration boundary.
+             * @param b           The upper integration boundary.
+             * @param threshold_a Whether the integration boundary a is a threshold of f.
+             * @param threshold_b Whether the integration boundary b is a threshold of f.
+             */
+            template <typename Integrand_>
+            std::invoke_result_t<const Integrand_ &, const Value_ &, const double &>
+            integrate(const ParameterUser & user, const Function & f, const Integrand_ & g, const double & a, const double & b, const bool & threshold_a = false,
+                      const bool & threshold_b = false)
+            {
+                using Result = std::invoke_result_t<const Integrand_ &, const Value_ &, const double &>;
+
+                Result result{};
+                if (a == b)
+                {
+                    return result;
+                }
+
+                if (b < a)
+                {
+                    panels::accumulate(result, -1.0, integrate(user, f, g, b, a, threshold_b, threshold_a));
+
+                    return result;
+                }
+
+                {
+                    Lock l(_mutex);
+                    _update(user);
+                }
+
+                const std::vector<double> boundaries = _boundaries(a, b, threshold_a, threshold_b);
+                for (unsigned i = 0; i + 1 < boundaries.size(); ++i)
+                {
+                    const auto   key    = std::make_pair(boundaries[i], boundaries[i + 1]);
+                    const double center = (key.first + key.second) / 2.0;
+                    const double half   = (key.second - key.first) / 2.0;
+
+                    std::array<Value_, points_> values;
+                    bool                        found = false;
+                    {
+                        Lock l(_mutex);
+
+                        auto p = _pieces.find(key);
+                        if (_pieces.end() != p)
+                        {
+                            values = p->second;
+                            found  = true;
+                        }
+                    }
+
+                    // evaluate f outside of the lock; concurrent evaluations of the same piece yield identical values
+                    if (! found)
+                    {
+                        for (unsigned j = 0; j < points_; ++j)
+                        {
+                            values[j] = f(center + half * _nodes[j]);
+                        }
+
+                        Lock l(_mutex);
+                        _pieces.emplace(key, values);
+                    }
+
+                    for (unsigned j = 0; j < points_; ++j)
+                    {
+                        panels::accumulate(result, half * _weights[j], g(values[j], center + half * _nodes[j]));
+                    }
+                }
+
+                return result;
+            }
+
+            /*!
+             * Integrate the cached function itself over q^2.
+             *
+             * @param user        The decay object, whose used parameters determine the validity of the cached values.
+             * @param f           The function whose values are cached at the nodes.
+             * @param a           The lower integration boundary.
+             * @param b           The upper integration boundary.
+             * @param threshold_a Whether the integration boundary a is a threshold of f.
+             * @param threshold_b Whether the integration boundary b is a threshold of f.
+             */
+            Value_
+            integrate(const ParameterUser & user, const Function & f, const double & a, const double & b, const bool & threshold_a = false, const bool & threshold_b = false)
+            {
+                return integrate(user, f, [](const Value_ & value, const double &) -> Value_ { return value; }, a, b, threshold_a, threshold_b);
+            }
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,159 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/maths/integrate-impl.hh>
+#include <eos/maths/integrate-panels.hh>
+
+#include <test/test.hh>
+
+#include <array>
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    struct TestDecay : public ParameterUser
+    {
+            UsedParameter m_B;
+
+            mutable unsigned evaluations;
+
+            TestDecay(const Parameters & p, const Options &) :
+                m_B(p["mass::B_d"], *this),
+                evaluations(0)
+            {
+            }
+
+            // smooth functions with a pole below the integration range, similar to the photon pole in b -> s l l
+            std::array<double, 2>
+            values(const double & q2) const
+            {
+                ++evaluations;
+
+                return std::array<double, 2>{ std::exp(-q2 / m_B), m_B / (q2 + 0.05) };
+            }
+    };
+} // namespace
+
+class IntegratePanelsTest : public TestCase
+{
+    public:
+        IntegratePanelsTest() :
+            TestCase("integrate_panels_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            using Integrator = PanelIntegrator<TestDecay, std::array<double, 2>>;
+
+            Parameters p = Parameters::Defaults();
+            Options    o;
+            TestDecay  d(p, o);
+
+            const Integrator::Function f = [&d](const double & q2) { return d.values(q2); };
+
+            auto integrator = Integrator::make(p, o);
+
+            // agreement with the adaptive cubature
+            {
+                const cubature::Config config = cubature::Config().epsrel(1e-12).epsabs(0.0);
+
+                for (const auto & [a, b] : { std::make_pair(0.1, 0.98), std::make_pair(1.1, 2.5), std::make_pair(2.5, 6.0), std::make_pair(15.0, 19.0) })
+                {
+                    const auto adaptive = eos::integrate<1, 2>(f, a, b, config);
+                    const auto panels   = integrator->integrate(d, f, a, b);
+
+                    TEST_CHECK_RELATIVE_ERROR(panels[0], adaptive[0], 1e-10);
+                    TEST_CHECK_RELATIVE_ERROR(panels[1], adaptive[1], 1e-7);
+                }
+            }
+
+            // refinement towards thresholds with a square-root behaviour
+            {
+                const double a = 4.0 * 0.10566 * 0.10566;
+                const double b = (5.279 - 0.896) * (5.279 - 0.896);
+
+                TEST_CHECK(Integrator::at_threshold(a + 1e-4, a));
+                TEST_CHECK(! Integrator::at_threshold(0.1, a));
+
+                const auto g_a = [a](const std::array<double, 2> &, const double & q2) { return std::sqrt(q2 - a); };
+                TEST_CHECK_RELATIVE_ERROR(integrator->integrate(d, f, g_a, a, 1.0, true), 2.0 / 3.0 * std::pow(1.0 - a, 1.5), 1e-8);
+                TEST_CHECK_RELATIVE_ERROR(integrator->integrate(d, f, g_a, a, 6.0, true), 2.0 / 3.0 * std::pow(6.0 - a, 1.5), 1e-8);
+
+                const auto g_b = [b](const std::array<double, 2> &, const double & q2) { return std::sqrt(b - q2); };
+                TEST_CHECK_RELATIVE_ERROR(integrator->integrate(d, f, g_b, 15.0, b, false, true), 2.0 / 3.0 * std::pow(b - 15.0, 1.5), 1e-9);
+                TEST_CHECK_RELATIVE_ERROR(integrator->integrate(d, f, g_b, b, 15.0, true, false), -2.0 / 3.0 * std::pow(b - 15.0, 1.5), 1e-9);
+
+                // both thresholds within a single panel
+                const double c   = 0.4;
+                const auto   g_c = [a, c](const std::array<double, 2> &, const double & q2) { return std::sqrt((q2 - a) * (c - q2)); };
+                TEST_CHECK_RELATIVE_ERROR(integrator->integrate(d, f, g_c, a, c, true, true), M_PI / 8.0 * (c - a) * (c - a), 1e-8);
+            }
+
+            // values at the nodes are shared among all integrals within the same panels
+            {
+                Parameters p2 = p.clone();
+                TestDecay  d2(p2, o);
+
+                const Integrator::Function f2 = [&d2](const double & q2) { return d2.values(q2); };
+
+                auto integrator2 = Integrator::make(p2, o);
+                TEST_CHECK(integrator2.get() != integrator.get());
+
+                integrator2->integrate(d2, f2, 1.0, 2.0);
+                integrator2->integrate(d2, f2, 2.0, 4.0);
+                integrator2->integrate(d2, f2, 4.0, 6.0);
+                TEST_CHECK_EQUAL(d2.evaluations, 10u * 8u);
+
+                // the normalisation reuses the values of the bins
+                const auto total = integrator2->integrate(d2, f2, 1.0, 6.0);
+                TEST_CHECK_EQUAL(d2.evaluations, 10u * 8u);
+
+                // the integrand can be any function of the cached values
+                const double ratio = integrator2->integrate(d2, f2, [](const std::array<double, 2> & v, const double & q2) { return v[1] * q2; }, 1.0, 6.0);
+                TEST_CHECK_EQUAL(d2.evaluations, 10u * 8u);
+                TEST_CHECK_RELATIVE_ERROR(ratio, p2["mass::B_d"].evaluate() * (5.0 - 0.05 * std::log(6.05 / 1.05)), 1e-10);
+
+                // a bin boundary between the panel boundaries creates a partial panel, which is shared as well
+                integrator2->integrate(d2, f2, 1.1, 2.0);
+                integrator2->integrate(d2, f2, 1.1, 6.0);
+                TEST_CHECK_EQUAL(d2.evaluations, 11u * 8u);
+
+                // reversed boundaries
+                const auto reversed = integrator2->integrate(d2, f2, 6.0, 1.0);
+                TEST_CHECK_NEARLY_EQUAL(reversed[0], -total[0], 1e-15);
+                TEST_CHECK_NEARLY_EQUAL(reversed[1], -total[1], 1e-15);
+
+                // a change of a used parameter discards the cached values
+                p2["mass::B_d"] = p2["mass::B_d"].evaluate() + 0.1;
+                const auto changed = integrator2->integrate(d2, f2, 1.0, 6.0);
+                TEST_CHECK_EQUAL(d2.evaluations, 21u * 8u);
+                TEST_CHECK_RELATIVE_ERROR(changed[1], p2["mass::B_d"].evaluate() * std::log(6.05 / 1.05), 1e-10);
+            }
+
+            // decay objects with the same parameters and options share one integrator
+            {
+                TEST_CHECK(Integrator::make(p, o).get() == integrator.get());
+            }
+        }
+} integrate_panels_test;
@@ -26,6 +26,7 @@
 #include <gsl/gsl_errno.h>
 
 #include <limits>
+#include <memory>
 #include <vector>
 
 namespace
@@ -36,6 +37,59 @@ namespace
         const auto & f = *static_cast<eos::GSL::fdd *>(params);
         return f(x);
     }
+
+    // Per-thread pool of QAGS workspaces. A workspace is checked out for the duration of one
+    // integration, so that nested integrations never share a workspace.
+    class QAGSWorkspacePool
+    {
+        private:
+            std::vector<std::unique_ptr<eos::GSL::QAGS::Workspace>> _free;
+
+        public:
+            class Lease
+            {
+                private:
+                    QAGSWorkspacePool &                          _pool;
+                    std::unique_ptr<eos::GSL::QAGS::Workspace> _work_space;
+
+                public:
+                    Lease(QAGSWorkspacePool & pool, std::unique_ptr<eos::GSL::QAGS::Workspace> && work_space) :
+                        _pool(pool),
+                        _work_space(std::move(work_space))
+                    {
+                    }
+
+                    ~Lease()
+                    {
+                        _pool._free.push_back(std::move(_work_space));
+                    }
+
+                    eos::GSL::QAGS::Workspace &
+                    operator* () const
+                    {
+                        return *_work_space;
+                    }
+            };
+
+            Lease
+            acquire(int limit)
+            {
+                for (auto i = _free.begin(); i != _free.end(); ++i)
+                {
+                    if ((*i)->limit() >= limit)
+                    {
+                        auto result = std::move(*i);
+                        _free.erase(i);
+
+                        return Lease(*this, std::move(result));
+                    }
+                }
+
+                return Lease(*this, std::make_unique<eos::GSL::QAGS::Workspace>(limit));
+            }
+    };
+
+    thread_local QAGSWorkspacePool qags_work_spaces;
 } // namespace
 
 namespace eos
@@ -86,7 +140,8 @@ namespace eos
 
         QAGS::Config::Config() :
             _qng(),
-            _key(2)
+            _key(2),
+            _limit(5000)
         {
         }
 
@@ -128,6 +183,19 @@ namespace eos
             _key = x;
             return *this;
         }
+
+        int
+        QAGS::Config::limit() const
+        {
+            return _limit;
+        }
+
+        QAGS::Config &
+        QAGS::Config::limit(const int & x)
+        {
+            _limit = x;
+            return *this;
+        }
     } // namespace GSL
 
     template <>
@@ -158,7 +226,8 @@ namespace eos
         F.function = &gsl_function_adapter;
         F.params   = (void *) &f;
 
-        auto status = gsl_integration_qag(&F, a, b, config.epsabs(), config.epsrel(), GSL::work_space.limit(), config.key(), GSL::work_space, &result, &abserr);
+        auto work_space = qags_work_spaces.acquire(config.limit());
+        auto status     = gsl_integration_qag(&F, a, b, config.epsabs(), config.epsrel(), config.limit(), config.key(), *work_space, &result, &abserr);
 
         if (status)
         {
@@ -171,7 +240,8 @@ namespace eos
     {
         Config::Config() :
             _qng(),
-            _maxeval(50000)
+            _maxeval(50000),
+            _individual_errors(false)
         {
         }
 
@@ -213,6 +283,19 @@ namespace eos
             _maxeval = x;
             return *this;
         }
+
+        bool
+        Config::individual_errors() const
+        {
+            return _individual_errors;
+        }
+
+        Config &
+        Config::individual_errors(const bool & x)
+        {
+            _individual_errors = x;
+            return *this;
+        }
     } // namespace cubature
 
     IntegrationError::IntegrationError(const std::string & message) throw() :
@@ -33,6 +33,7 @@
 
 #include <array>
 #include <functional>
+#include <span>
 
 namespace eos
 {
@@ -97,13 +98,16 @@ namespace eos
                         int      key() const;
                         Config & key(const int &);
 
+                        // maximal number of subintervals
+                        int      limit() const;
+                        Config & limit(const int &);
+
                     private:
                         QNG::Config _qng;
                         int         _key;
+                        int         _limit;
                 };
         };
-
-        static thread_local QAGS::Workspace work_space;
     } // namespace GSL
 
     /*!
@@ -360,6 +364,11 @@ namespace eos
 
         template <size_t ndim_, size_t fdim_ = 1, typename T_ = double> using integrand = typename integrand_traits<ndim_, fdim_, T_>::function_type;
 
+        // integrand function that is evaluated on a batch of points at once, writing one result per point
+        template <size_t ndim_, size_t fdim_ = 1, typename T_ = double>
+        using batch_integrand = std::function<void(std::span<const typename integrand_traits<ndim_, fdim_, T_>::argument_type>,
+                                                   std::span<typename integrand_traits<ndim_, fdim_, T_>::result_type>)>;
+
         class Config
         {
             public:
@@ -374,9 +383,15 @@ namespace eos
                 size_t   maxeval() const;
                 Config & maxeval(const size_t & x);
 
+                // apply the error criteria to each component of a vector-valued integrand individually,
+                // rather than to the L2 norm of all components
+                bool     individual_errors() const;
+                Config & individual_errors(const bool & x);
+
             private:
                 GSL::QNG::Config _qng;
                 size_t           _maxeval;
+                bool             _individual_errors;
         };
     } // namespace cubature
 
@@ -389,6 +404,18 @@ namespace eos
     integrate(const cubature::integrand<ndim_, fdim_, T_> & f, const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & a,
               const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & b, const cubature::Config & config = cubature::Config());
 
+    /*!
+     * Numerically integrate functions of one or more than one variable with
+     * cubature methods, evaluating the integrand on batches of points.
+     *
+     * Each call to the integrand receives all points of one or more subregions,
+     * which allows the integrand to vectorise its evaluation.
+     */
+    template <size_t ndim_, size_t fdim_ = 1, typename T_ = double>
+    typename cubature::integrand_traits<ndim_, fdim_, T_>::result_type
+    integrate_batch(const cubature::batch_integrand<ndim_, fdim_, T_> & f, const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & a,
+                    const typename cubature::integrand_traits<ndim_, fdim_, T_>::argument_type & b, const cubature::Config & config = cubature::Config());
+
     class IntegrationError : public Exception
     {
         public:
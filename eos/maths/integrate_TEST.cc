@@ -141,6 +141,12 @@ class IntegrateTest : public TestCase
             TEST_CHECK_RELATIVE_ERROR(3 * i4, q7[2], eps);
             TEST_CHECK_RELATIVE_ERROR(4 * i4, q7[3], eps);
 
+            std::array<double, 4> q7i = integrate<1, 4>(f7, 1.0, std::exp(1), cubature::Config(config_cubature).individual_errors(true));
+            TEST_CHECK_RELATIVE_ERROR(i4, q7i[0], eps);
+            TEST_CHECK_RELATIVE_ERROR(2 * i4, q7i[1], eps);
+            TEST_CHECK_RELATIVE_ERROR(3 * i4, q7i[2], eps);
+            TEST_CHECK_RELATIVE_ERROR(4 * i4, q7i[3], eps);
+
             double q8 = integrate<1>(f4, 1.0, std::exp(1), config_cubature);
             TEST_CHECK_RELATIVE_ERROR(i4, q8, eps);
 
@@ -149,5 +155,61 @@ class IntegrateTest : public TestCase
             TEST_CHECK_RELATIVE_ERROR(2 * 3.43656, q9[1], eps);
             TEST_CHECK_RELATIVE_ERROR(3 * 3.43656, q9[2], eps);
             TEST_CHECK_RELATIVE_ERROR(4 * 3.43656, q9[3], eps);
+
+            // nested QAGS integration: the inner integral must not reuse the outer workspace
+            auto   f10 = [&config_QAGS](const double & x) -> double
+            {
+                return integrate<GSL::QAGS>([x](const double & y) -> double { return x * y; }, 0.0, 1.0, config_QAGS);
+            };
+            double q10 = integrate<GSL::QAGS>(f10, 0.0, 1.0, GSL::QAGS::Config(config_QAGS).limit(100));
+            TEST_CHECK_RELATIVE_ERROR(0.25, q10, eps);
+
+            // batch evaluation of the integrand
+            unsigned  calls = 0;
+            cubature::batch_integrand<1> f11 = [&calls](std::span<const double> x, std::span<double> result)
+            {
+                ++calls;
+                for (size_t i = 0; i < x.size(); ++i)
+                {
+                    result[i] = std::log(x[i]);
+                }
+            };
+            double q11 = integrate_batch<1>(f11, 1.0, std::exp(1), config_cubature);
+            TEST_CHECK_RELATIVE_ERROR(i4, q11, eps);
+            TEST_CHECK(calls > 0);
+
+            cubature::batch_integrand<1, 4> f12 = [this](std::span<const double> x, std::span<std::array<double, 4>> result)
+            {
+                for (size_t i = 0; i < x.size(); ++i)
+                {
+                    result[i] = f7(x[i]);
+                }
+            };
+            std::array<double, 4> q12 = integrate_batch<1, 4>(f12, 1.0, std::exp(1), config_cubature);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                TEST_CHECK_RELATIVE_ERROR((i + 1) * i4, q12[i], eps);
+            }
+
+            cubature::batch_integrand<2, 4> f13 = [this](std::span<const std::array<double, 2>> x, std::span<std::array<double, 4>> result)
+            {
+                for (size_t i = 0; i < x.size(); ++i)
+                {
+                    result[i] = f8(x[i]);
+                }
+            };
+            std::array<double, 4> q13 = integrate_batch<2, 4>(f13, std::array<double, 2>{ 1.0, 1.0 }, std::array<double, 2>{ std::exp(1), std::exp(1) }, config_cubature);
+            TEST_CHECK_RELATIVE_ERROR(1 * 3.43656, q13[0], eps);
+            TEST_CHECK_RELATIVE_ERROR(4 * 3.43656, q13[3], eps);
+
+            cubature::batch_integrand<1, 1, complex<double>> f14 = [](std::span<const double> x, std::span<complex<double>> result)
+            {
+                for (size_t i = 0; i < x.size(); ++i)
+                {
+                    result[i] = f5(x[i]);
+                }
+            };
+            complex<double> q14 = integrate_batch<1, 1, complex<double>>(f14, 0.0, 0.5 * M_PI, config_cubature);
+            TEST_CHECK_RELATIVE_ERROR_C(q14, i5, eps);
         }
 } model_test;
@@ -16,39 +16,232 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/interpolation.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
 
-#include <gsl/gsl_errno.h>
-
-#include <interpolation.hh>
+#include <algorithm>
+#include <cmath>
 
 namespace eos
 {
-    CSplineInterpolation::CSplineInterpolation(const std::vector<double> & data_x, const std::vector<double> & data_y) :
-        _data_x(data_x),
-        _data_y(data_y),
-        _acc(gsl_interp_accel_alloc(), &gsl_interp_accel_free),
-        _interp(gsl_interp_alloc(gsl_interp_cspline, _data_x.size()), &gsl_interp_free)
+    namespace impl
     {
-        if (_data_x.size() != _data_y.size())
+        template <typename T_>
+        CubicSpline<T_>::CubicSpline(const std::vector<double> & x, const std::vector<T_> & y) :
+            _x(x),
+            _inverse_step(0.0)
+        {
+            const std::size_t n = x.size();
+
+            if (n != y.size())
+            {
+                throw InternalError("Interpolation: dimensions of x and y data do not match");
+            }
+
+            if (n < 3)
+            {
+                throw InternalError("Interpolation: at least 3 supporting points are required, got " + stringify(n));
+            }
+
+            std::vector<double> h(n - 1);
+            for (std::size_t i = 0 ; i < n - 1 ; ++i)
+            {
+                h[i] = x[i + 1] - x[i];
+
+                if (! (h[i] > 0.0))
+                {
+                    throw InternalError("Interpolation: x data must be strictly increasing");
+                }
+            }
+
+            // Solve the tridiagonal system for the natural spline, i.e. c_0 = c_{n-1} = 0,
+            // using the Thomas algorithm.
+            std::vector<T_>     c(n, T_(0.0));
+            std::vector<double> diag(n, 0.0);
+            std::vector<T_>     rhs(n, T_(0.0));
+            for (std::size_t i = 1 ; i < n - 1 ; ++i)
+            {
+                diag[i] = 2.0 * (h[i - 1] + h[i]);
+                rhs[i]  = 3.0 * ((y[i + 1] - y[i]) / h[i] - (y[i] - y[i - 1]) / h[i - 1]);
+            }
+            for (std::size_t i = 2 ; i < n - 1 ; ++i)
+            {
+                const double w = h[i - 1] / diag[i - 1];
+                diag[i] -= w * h[i - 1];
+                rhs[i]  -= w * rhs[i - 1];
+            }
+            for (std::size_t i = n - 2 ; i > 0 ; --i)
+            {
+                c[i] = (rhs[i] - h[i] * c[i + 1]) / diag[i];
+            }
+
+            _coefficients.resize(n - 1);
+            for (std::size_t i = 0 ; i < n - 1 ; ++i)
+            {
+                const T_ b = (y[i + 1] - y[i]) / h[i] - h[i] * (c[i + 1] + 2.0 * c[i]) / 3.0;
+                const T_ d = (c[i + 1] - c[i]) / (3.0 * h[i]);
+
+                _coefficients[i] = { y[i], b, c[i], d };
+            }
+
+            // Use O(1) lookup if the supporting points are equidistant, up to rounding.
+            // _interval() corrects the estimated index by one position if needed.
+            const double step = (x.back() - x.front()) / (n - 1);
+            bool uniform = true;
+            for (std::size_t i = 1 ; i < n - 1 ; ++i)
+            {
+                if (std::abs(x[i] - (x.front() + i * step)) > 1.0e-8 * step)
+                {
+                    uniform = false;
+                    break;
+                }
+            }
+
+            if (uniform)
+            {
+                _inverse_step = 1.0 / step;
+            }
+        }
+
+        template <typename T_>
+        std::size_t
+        CubicSpline<T_>::_interval(const double & x) const
         {
-            throw InternalError("Interpolation: dimensions of x and y data do not match");
+            const std::size_t last = _coefficients.size() - 1;
+
+            if (_inverse_step > 0.0)
+            {
+                const double t = (x - _x.front()) * _inverse_step;
+                std::size_t  i = (t > 0.0) ? std::min(static_cast<std::size_t>(t), last) : 0;
+
+                if ((i > 0) && (x < _x[i]))
+                {
+                    --i;
+                }
+                else if ((i < last) && (x >= _x[i + 1]))
+                {
+                    ++i;
+                }
+
+                return i;
+            }
+
+            const auto it = std::upper_bound(_x.cbegin(), _x.cend(), x);
+            const std::size_t i = (it == _x.cbegin()) ? 0 : static_cast<std::size_t>(it - _x.cbegin()) - 1;
+
+            return std::min(i, last);
+        }
+
+        template <typename T_>
+        T_
+        CubicSpline<T_>::_evaluate(const std::size_t & i, const double & x) const
+        {
+            const auto & [a, b, c, d] = _coefficients[i];
+            const double dx = x - _x[i];
+
+            return a + dx * (b + dx * (c + dx * d));
         }
-        gsl_interp_init(_interp.get(), &_data_x[0], &_data_y[0], _data_x.size());
+
+        template <typename T_>
+        T_
+        CubicSpline<T_>::operator() (const double & x) const
+        {
+            if ((x < _x.front()) || (x > _x.back()))
+            {
+                throw GSLError("Interpolation: x = " + stringify(x) + " is outside of the data range [" + stringify(_x.front()) + ", " + stringify(_x.back()) + "]");
+            }
+
+            return _evaluate(_interval(x), x);
+        }
+
+        template <typename T_>
+        void
+        CubicSpline<T_>::evaluate(std::span<const double> x, std::span<T_> results) const
+        {
+            if (x.size() != results.size())
+            {
+                throw InternalError("Interpolation: expected " + stringify(x.size()) + " results, got a buffer of size " + stringify(results.size()));
+            }
+
+            // Check the domain up front, so that the evaluation loop is free of branches that can throw
+            const auto [min, max] = std::minmax_element(x.begin(), x.end());
+            if ((min != x.end()) && ((*min < _x.front()) || (*max > _x.back())))
+            {
+                const double outlier = (*min < _x.front()) ? *min : *max;
+                throw GSLError("Interpolation: x = " + stringify(outlier) + " is outside of the data range [" + stringify(_x.front()) + ", " + stringify(_x.back()) + "]");
+            }
+
+            for (std::size_t k = 0 ; k < x.size() ; ++k)
+            {
+                results[k] = _evaluate(_interval(x[k]), x[k]);
+            }
+        }
+
+        template class CubicSpline<double>;
+        template class CubicSpline<complex<double>>;
+    } // namespace impl
+
+    CSplineInterpolation::CSplineInterpolation(const std::vector<double> & data_x, const std::vector<double> & data_y) :
+        _spline(data_x, data_y)
+    {
     }
 
     double
     CSplineInterpolation::operator() (const double & x) const
     {
-        double res        = 0;
-        int    gsl_status = 0;
+        return _spline(x);
+    }
+
+    void
+    CSplineInterpolation::evaluate(std::span<const double> x, std::span<double> results) const
+    {
+        _spline.evaluate(x, results);
+    }
+
+    std::vector<double>
+    CSplineInterpolation::evaluate(std::span<const double> x) const
+    {
+        std::vector<double> results(x.size());
+        _spline.evaluate(x, results);
 
-        gsl_status = gsl_interp_eval_e(_interp.get(), &_data_x[0], &_data_y[0], x, _acc.get(), &res);
-        if (gsl_status)
+        return results;
+    }
+
+    namespace
+    {
+        std::vector<complex<double>>
+        combine(const std::vector<double> & data_y_real, const std::vector<double> & data_y_imag)
         {
-            throw eos::GSLError(gsl_strerror(gsl_status));
+            if (data_y_real.size() != data_y_imag.size())
+            {
+                throw InternalError("Interpolation: dimensions of real and imaginary y data do not match");
+            }
+
+            std::vector<complex<double>> result(data_y_real.size());
+            for (std::size_t i = 0 ; i < result.size() ; ++i)
+            {
+                result[i] = complex<double>(data_y_real[i], data_y_imag[i]);
+            }
+
+            return result;
         }
+    }
 
-        return res;
+    ComplexCSplineInterpolation::ComplexCSplineInterpolation(const std::vector<double> & data_x, const std::vector<double> & data_y_real, const std::vector<double> & data_y_imag) :
+        _spline(data_x, combine(data_y_real, data_y_imag))
+    {
+    }
+
+    complex<double>
+    ComplexCSplineInterpolation::operator() (const double & x) const
+    {
+        return _spline(x);
+    }
+
+    void
+    ComplexCSplineInterpolation::evaluate(std::span<const double> x, std::span<complex<double>> results) const
+    {
+        _spline.evaluate(x, results);
     }
 } // namespace eos
@@ -19,27 +19,60 @@
 #ifndef EOS_GUARD_EOS_MATHS_INTERPOLATION_HH
 #define EOS_GUARD_EOS_MATHS_INTERPOLATION_HH 1
 
-#include <gsl/gsl_spline.h>
+#include <eos/maths/complex.hh>
 
-#include <functional>
-#include <memory>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace eos
 {
+    namespace impl
+    {
+        /*
+         * Natural cubic spline, equivalent to GSL's cspline interpolation.
+         *
+         * The coefficient table is computed once upon construction and never modified
+         * afterwards, so that a single spline can be evaluated concurrently from
+         * any number of threads. If the supporting points are equidistant, the
+         * interval containing x is found in O(1), otherwise by bisection.
+         */
+        template <typename T_> class CubicSpline
+        {
+            private:
+                std::vector<double> _x;
+
+                // coefficients (a, b, c, d) of a + b dx + c dx^2 + d dx^3 for each interval
+                std::vector<std::array<T_, 4>> _coefficients;
+
+                // inverse distance between the supporting points if they are equidistant, zero otherwise
+                double _inverse_step;
+
+                std::size_t _interval(const double & x) const;
+
+                T_ _evaluate(const std::size_t & i, const double & x) const;
+
+            public:
+                CubicSpline(const std::vector<double> & x, const std::vector<T_> & y);
+
+                T_ operator() (const double & x) const;
+
+                void evaluate(std::span<const double> x, std::span<T_> results) const;
+        };
+
+        extern template class CubicSpline<double>;
+        extern template class CubicSpline<complex<double>>;
+    } // namespace impl
+
     class CSplineInterpolation
     {
         private:
-            const std::vector<double>                   _data_x;
-            const std::vector<double>                   _data_y;
-            const std::function<double(const double &)> _map_x;
-            const std::shared_ptr<gsl_interp_accel>     _acc;
-            const std::shared_ptr<gsl_interp>           _interp;
+            impl::CubicSpline<double> _spline;
 
         public:
             CSplineInterpolation() = delete;
             /*!
-             * Stores the interpolation data and initializes gsl variables.
+             * Stores the interpolation data and computes the spline coefficients.
              *
              * @param data_x The supporting points of the x domain of the function.
              * @param data_y The corresponding function values.
@@ -52,6 +85,56 @@ namespace eos
              * @param x The point at which the function shall be evaluated.
              */
             double operator() (const double & x) const;
+
+            /*!
+             * Evaluate the interpolating function for a batch of points.
+             *
+             * @param x       The points at which the function shall be evaluated.
+             * @param results The buffer receiving one function value per point.
+             */
+            void evaluate(std::span<const double> x, std::span<double> results) const;
+
+            /*!
+             * Evaluate the interpolating function for a batch of points.
+             *
+             * @param x The points at which the function shall be evaluated.
+             */
+            std::vector<double> evaluate(std::span<const double> x) const;
+    };
+
+    class ComplexCSplineInterpolation
+    {
+        private:
+            impl::CubicSpline<complex<double>> _spline;
+
+        public:
+            ComplexCSplineInterpolation() = delete;
+            /*!
+             * Stores the interpolation data and computes the spline coefficients.
+             *
+             * The real and imaginary parts are interpolated independently, but share
+             * one interleaved coefficient table and a single interval lookup.
+             *
+             * @param data_x      The supporting points of the x domain of the function.
+             * @param data_y_real The real parts of the corresponding function values.
+             * @param data_y_imag The imaginary parts of the corresponding function values.
+             */
+            ComplexCSplineInterpolation(const std::vector<double> & data_x, const std::vector<double> & data_y_real, const std::vector<double> & data_y_imag);
+
+            /*!
+             * Evaluate the interpolating function.
+             *
+             * @param x The point at which the function shall be evaluated.
+             */
+            complex<double> operator() (const double & x) const;
+
+            /*!
+             * Evaluate the interpolating function for a batch of points.
+             *
+             * @param x       The points at which the function shall be evaluated.
+             * @param results The buffer receiving one function value per point.
+             */
+            void evaluate(std::span<const double> x, std::span<complex<double>> results) const;
     };
 } // namespace eos
 
@@ -22,6 +22,8 @@
 
 #include <interpolation.hh>
 
+#include <vector>
+
 using namespace test;
 using namespace eos;
 
@@ -68,5 +70,79 @@ class InterpolationTest : public TestCase
                                       { 0.0, 1.0, 2.0, 3.0 }
                 }));
             }
+
+            // natural cubic spline on equidistant and non-equidistant supporting points
+            {
+                const std::vector<double> y = { 0.0, 1.0, 8.0, 27.0, 64.0 };
+
+                CSplineInterpolation uniform({ 0.0, 1.0, 2.0, 3.0, 4.0 }, y);
+                // reference values of the natural cubic spline, computed in exact arithmetic
+                TEST_CHECK_NEARLY_EQUAL(uniform(0.0),  0.0,                 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(uniform(0.5),  0.0982142857142857,  1e-14);
+                TEST_CHECK_NEARLY_EQUAL(uniform(1.0),  1.0,                 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(uniform(2.5), 15.3303571428571429,  1e-13);
+                TEST_CHECK_NEARLY_EQUAL(uniform(3.0), 27.0,                 1e-13);
+                TEST_CHECK_NEARLY_EQUAL(uniform(3.9), 59.8969285714285714,  1e-13);
+                TEST_CHECK_NEARLY_EQUAL(uniform(4.0), 64.0,                 1e-13);
+
+                CSplineInterpolation nonuniform({ 0.0, 1.0, 2.0, 3.5, 4.0 }, { 0.0, 1.0, 8.0, 42.875, 64.0 });
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(0.0),     0.0,                1e-14);
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(2.0),     8.0,                1e-14);
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(3.5),    42.875,              1e-13);
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(4.0),    64.0,                1e-13);
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(0.5),    0.1082089552238806, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(nonuniform(3.0),   26.6467661691542289, 1e-13);
+            }
+
+            // batch evaluation agrees with pointwise evaluation
+            {
+                CSplineInterpolation interp({ 0.0, 0.5, 1.0, 1.5, 2.0 }, { 1.0, 0.5, -0.25, 0.75, 2.0 });
+
+                const std::vector<double> x = { 0.0, 0.1, 0.5, 0.75, 1.2, 1.5, 1.99, 2.0 };
+                const auto results = interp.evaluate(x);
+
+                TEST_CHECK_EQUAL(results.size(), x.size());
+                for (std::size_t i = 0 ; i < x.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(results[i], interp(x[i]));
+                }
+
+                std::vector<double> too_small(x.size() - 1);
+                TEST_CHECK_THROWS(InternalError, interp.evaluate(x, too_small));
+
+                const std::vector<double> outside = { 0.5, 2.5 };
+                TEST_CHECK_THROWS(GSLError, interp.evaluate(outside));
+            }
+
+            // complex interpolation agrees with separate real and imaginary interpolations
+            {
+                const std::vector<double> x      = { 0.0, 0.3, 0.7, 1.0, 1.6, 2.0 };
+                const std::vector<double> y_real = { 1.0, 0.2, -0.4, 0.1, 1.3, 0.8 };
+                const std::vector<double> y_imag = { 0.0, -0.5, 0.3, 0.9, 0.7, -0.1 };
+
+                ComplexCSplineInterpolation interp(x, y_real, y_imag);
+                CSplineInterpolation        real_part(x, y_real);
+                CSplineInterpolation        imag_part(x, y_imag);
+
+                const std::vector<double> points = { 0.0, 0.15, 0.3, 0.85, 1.2, 1.99, 2.0 };
+                std::vector<complex<double>> results(points.size());
+                interp.evaluate(points, results);
+
+                for (std::size_t i = 0 ; i < points.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(real(interp(points[i])), real_part(points[i]), 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(imag(interp(points[i])), imag_part(points[i]), 1e-14);
+                    TEST_CHECK_EQUAL(results[i], interp(points[i]));
+                }
+
+                TEST_CHECK_THROWS(GSLError, interp(-0.1));
+                TEST_CHECK_THROWS(InternalError, ComplexCSplineInterpolation(x, y_real, { 0.0, 1.0 }));
+            }
+
+            // too few or unordered supporting points: must throw
+            {
+                TEST_CHECK_THROWS(InternalError, CSplineInterpolation({ 0.0, 1.0 }, { 0.0, 1.0 }));
+                TEST_CHECK_THROWS(InternalError, CSplineInterpolation({ 0.0, 2.0, 1.0 }, { 0.0, 1.0, 2.0 }));
+            }
         }
 } interpolation_test;
@@ -21,7 +21,11 @@
 #ifndef EOS_GUARD_EOS_MATHS_MATRIX_HH
 #define EOS_GUARD_EOS_MATHS_MATRIX_HH 1
 
+#include <eos/utils/exception.hh>
+
 #include <array>
+#include <cmath>
+#include <utility>
 
 namespace eos
 {
@@ -222,6 +226,96 @@ namespace eos
 
         return result;
     }
+
+    /* Special matrices and inversion */
+
+    /* identity matrix */
+    template <typename T_, std::size_t n_>
+    std::array<std::array<T_, n_>, n_>
+    identity()
+    {
+        std::array<std::array<T_, n_>, n_> result;
+        for (std::size_t i(0); i < n_; ++i)
+        {
+            for (std::size_t j(0); j < n_; ++j)
+            {
+                result[i][j] = (i == j) ? 1.0 : 0.0;
+            }
+        }
+
+        return result;
+    }
+
+    /* transpose of a matrix */
+    template <typename T_, std::size_t m_, std::size_t n_>
+    std::array<std::array<T_, m_>, n_>
+    transpose(const std::array<std::array<T_, n_>, m_> & x)
+    {
+        std::array<std::array<T_, m_>, n_> result;
+        for (std::size_t i(0); i < m_; ++i)
+        {
+            for (std::size_t j(0); j < n_; ++j)
+            {
+                result[j][i] = x[i][j];
+            }
+        }
+
+        return result;
+    }
+
+    /* inverse of a real square matrix, using Gauss-Jordan elimination with partial pivoting */
+    template <std::size_t n_>
+    std::array<std::array<double, n_>, n_>
+    inverse(const std::array<std::array<double, n_>, n_> & x)
+    {
+        std::array<std::array<double, n_>, n_> a      = x;
+        std::array<std::array<double, n_>, n_> result = identity<double, n_>();
+
+        for (std::size_t k(0); k < n_; ++k)
+        {
+            // choose the row with the largest pivot
+            std::size_t pivot = k;
+            for (std::size_t i(k + 1); i < n_; ++i)
+            {
+                if (std::abs(a[i][k]) > std::abs(a[pivot][k]))
+                {
+                    pivot = i;
+                }
+            }
+
+            if (0.0 == a[pivot][k])
+            {
+                throw InternalError("inverse: matrix is singular");
+            }
+
+            std::swap(a[k], a[pivot]);
+            std::swap(result[k], result[pivot]);
+
+            const double scale = 1.0 / a[k][k];
+            for (std::size_t j(0); j < n_; ++j)
+            {
+                a[k][j]      *= scale;
+                result[k][j] *= scale;
+            }
+
+            for (std::size_t i(0); i < n_; ++i)
+            {
+                if (i == k)
+                {
+                    continue;
+                }
+
+                const double factor = a[i][k];
+                for (std::size_t j(0); j < n_; ++j)
+                {
+                    a[i][j]      -= factor * a[k][j];
+                    result[i][j] -= factor * result[k][j];
+                }
+            }
+        }
+
+        return result;
+    }
 } // namespace eos
 
 #endif
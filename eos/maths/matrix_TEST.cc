@@ -247,5 +247,53 @@ class MatrixMultiplicationTest : public TestCase
                     TEST_CHECK_RELATIVE_ERROR(result[i], true_result[i], 1e-15);
                 }
             }
+
+            // transpose
+            {
+                const array<array<double, 3>, 2> x{
+                    { array<double, 3>{ { 1.0, 2.0, 3.0 } }, array<double, 3>{ { 4.0, 5.0, 6.0 } } }
+                };
+
+                const array<array<double, 2>, 3> result = transpose(x);
+
+                for (unsigned i = 0; i < 2; ++i)
+                {
+                    for (unsigned j = 0; j < 3; ++j)
+                    {
+                        TEST_CHECK_EQUAL(result[j][i], x[i][j]);
+                    }
+                }
+            }
+
+            // inverse, with a vanishing leading diagonal element that requires pivoting
+            {
+                using Matrix = array<array<double, 3>, 3>;
+
+                const Matrix x{
+                    { array<double, 3>{ { 0.0, 2.0, 1.0 } }, array<double, 3>{ { 1.0, 1.0, 0.0 } }, array<double, 3>{ { 3.0, 0.0, 4.0 } } }
+                };
+                const Matrix true_result{
+                    { array<double, 3>{ { -4.0 / 11.0, 8.0 / 11.0, 1.0 / 11.0 } },
+                      array<double, 3>{ { 4.0 / 11.0, 3.0 / 11.0, -1.0 / 11.0 } },
+                      array<double, 3>{ { 3.0 / 11.0, -6.0 / 11.0, 2.0 / 11.0 } } }
+                };
+
+                const Matrix result = inverse(x);
+                const Matrix unit   = x * result;
+
+                for (unsigned i = 0; i < 3; ++i)
+                {
+                    for (unsigned j = 0; j < 3; ++j)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(result[i][j], true_result[i][j], 1e-15);
+                        TEST_CHECK_NEARLY_EQUAL(unit[i][j], (i == j) ? 1.0 : 0.0, 1e-15);
+                    }
+                }
+
+                const Matrix singular{
+                    { array<double, 3>{ { 1.0, 2.0, 3.0 } }, array<double, 3>{ { 2.0, 4.0, 6.0 } }, array<double, 3>{ { 0.0, 0.0, 1.0 } } }
+                };
+                TEST_CHECK_THROWS(InternalError, inverse(singular));
+            }
         }
 } matrix_multiplication_test;
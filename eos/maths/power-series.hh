@@ -0,0 +1,88 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_POWER_SERIES_HH
+#define EOS_GUARD_EOS_MATHS_POWER_SERIES_HH 1
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
+
+#include <array>
+#include <span>
+
+namespace eos
+{
+    /*!
+     * Evaluate the power series sum_k c_k x^k, using Horner's scheme.
+     *
+     * @param c The coefficients c_0, ..., c_{n-1}.
+     * @param x The point at which to evaluate the series.
+     */
+    template <std::size_t n_>
+    constexpr double
+    power_series(const std::array<double, n_> & c, const double & x)
+    {
+        static_assert(n_ > 0, "power_series requires at least one coefficient");
+
+        double result = c[n_ - 1];
+        for (std::size_t k = n_ - 1; k-- > 0;)
+        {
+            result = result * x + c[k];
+        }
+
+        return result;
+    }
+
+    /*!
+     * Evaluate the power series sum_k c_k x^k for a batch of points, using Horner's scheme.
+     *
+     * The loop over the points is the innermost one and is free of branches, such that
+     * the compiler can vectorise it.
+     *
+     * @param c       The coefficients c_0, ..., c_{n-1}.
+     * @param x       The points at which to evaluate the series.
+     * @param results The values of the series, one per point.
+     */
+    template <std::size_t n_>
+    void
+    power_series(const std::array<double, n_> & c, std::span<const double> x, std::span<double> results)
+    {
+        static_assert(n_ > 0, "power_series requires at least one coefficient");
+
+        if (x.size() != results.size())
+        {
+            throw InternalError("power_series: expected " + stringify(x.size()) + " results, got a buffer of size " + stringify(results.size()));
+        }
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            results[i] = c[n_ - 1];
+        }
+
+        for (std::size_t k = n_ - 1; k-- > 0;)
+        {
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                results[i] = results[i] * x[i] + c[k];
+            }
+        }
+    }
+} // namespace eos
+
+#endif
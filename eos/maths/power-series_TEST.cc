@@ -0,0 +1,67 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/maths/power-series.hh>
+
+#include <test/test.hh>
+
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class PowerSeriesTest : public TestCase
+{
+    public:
+        PowerSeriesTest() :
+            TestCase("power_series_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            static const double eps = 1e-14;
+
+            const std::array<double, 4> c{ 1.0, -0.5, 0.25, 2.0 };
+
+            // single points
+            {
+                TEST_CHECK_NEARLY_EQUAL(power_series(c, 0.0), 1.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(power_series(c, 1.0), 2.75, eps);
+                TEST_CHECK_NEARLY_EQUAL(power_series(c, -0.3), 1.0 + 0.15 + 0.0225 - 0.054, eps);
+                TEST_CHECK_NEARLY_EQUAL(power_series(std::array<double, 1>{ 3.0 }, 0.7), 3.0, eps);
+            }
+
+            // batches of points agree with single points
+            {
+                const std::vector<double> x{ -0.4, -0.1, 0.0, 0.05, 0.2, 0.3, 0.45 };
+                std::vector<double>       results(x.size());
+
+                power_series(c, x, results);
+                for (std::size_t i = 0; i < x.size(); ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(results[i], power_series(c, x[i]), eps);
+                }
+
+                std::vector<double> too_small(x.size() - 1);
+                TEST_CHECK_THROWS(InternalError, power_series(c, x, too_small));
+            }
+        }
+} power_series_test;
@@ -25,7 +25,9 @@
 #include <eos/maths/power-of.hh>
 #include <eos/models/standard-model.hh>
 #include <eos/models/top-loops.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
 #include <eos/utils/rge-impl.hh>
@@ -35,7 +37,10 @@
 #include <gsl/gsl_sf_dilog.h>
 
 #include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 namespace eos
 {
@@ -169,7 +174,76 @@ namespace eos
         return complex<double>(result, 0.0);
     }
 
+    template <> struct Implementation<SMComponent<components::QCD>>
+    {
+        // Inputs of the running of alpha_s: alpha_s(MZ), m_Z, mu_t, mu_b, mu_c, and Lambda_QCD
+        std::array<Parameter, 6> parameters;
+
+        // Values of the inputs for which the cache is valid
+        std::array<double, 6> inputs;
+
+        // alpha_s at the flavour thresholds, for the current inputs
+        double alpha_s_mu_t, alpha_s_mu_b, alpha_s_mu_c;
+
+        // Recently evaluated values of alpha_s, stored as (mu, alpha_s(mu)) and indexed by a hash of mu
+        static constexpr std::size_t alpha_s_memo_size = 32;
+        std::array<std::pair<double, double>, alpha_s_memo_size> alpha_s_memo;
+
+        // Pole masses, stored along with the MSbar mass from which they were obtained
+        std::array<std::pair<double, double>, 4> m_b_pole;
+        std::pair<double, double>                m_c_pole;
+
+        // Guards all of the above, since one component might be used from several threads
+        Mutex mutex;
+
+        Implementation(const Parameters & p) :
+            parameters{ p["QCD::alpha_s(MZ)"], p["mass::Z"], p["QCD::mu_t"], p["QCD::mu_b"], p["QCD::mu_c"], p["QCD::Lambda"] }
+        {
+            inputs.fill(std::numeric_limits<double>::quiet_NaN());
+            reset();
+        }
+
+        void
+        reset()
+        {
+            static const std::pair<double, double> empty{ std::numeric_limits<double>::quiet_NaN(), 0.0 };
+
+            alpha_s_memo.fill(empty);
+            m_b_pole.fill(empty);
+            m_c_pole = empty;
+        }
+
+        // Bring the cache up to date with the current values of the inputs; requires the mutex to be held
+        void
+        update()
+        {
+            const std::array<double, 6> current{ parameters[0](), parameters[1](), parameters[2](), parameters[3](), parameters[4](), parameters[5]() };
+
+            if (current == inputs)
+            {
+                return;
+            }
+
+            inputs = current;
+            reset();
+
+            const auto & [alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd] = inputs;
+            alpha_s_mu_t = QCD::alpha_s(mu_t, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+            alpha_s_mu_b = QCD::alpha_s(mu_b, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+            alpha_s_mu_c = QCD::alpha_s(mu_c, alpha_s_mu_b, mu_b, QCD::beta_function_nf_4);
+        }
+
+        static std::size_t
+        alpha_s_memo_index(const double & mu)
+        {
+            const auto bits = std::bit_cast<std::uint64_t>(mu);
+
+            return ((bits ^ (bits >> 29) ^ (bits >> 41)) * 0x9e3779b97f4a7c15ull >> 58) % alpha_s_memo_size;
+        }
+    };
+
     SMComponent<components::QCD>::SMComponent(const Parameters & p, ParameterUser & u) :
+        PrivateImplementationPattern<SMComponent<components::QCD>>(new Implementation<SMComponent<components::QCD>>(p)),
         _alpha_s_Z__qcd(p["QCD::alpha_s(MZ)"], u),
         _mu_t__qcd(p["QCD::mu_t"], u),
         _mu_b__qcd(p["QCD::mu_b"], u),
@@ -185,46 +259,73 @@ namespace eos
     {
     }
 
+    SMComponent<components::QCD>::~SMComponent() = default;
+
     double
     SMComponent<components::QCD>::alpha_s(const double & mu) const
     {
-        double alpha_s_0 = _alpha_s_Z__qcd, mu_0 = _m_Z__qcd;
+        const std::size_t index = Implementation<SMComponent<components::QCD>>::alpha_s_memo_index(mu);
 
-        if (mu >= _m_Z__qcd)
+        // take a snapshot of the inputs, such that the running is consistent even if another thread changes them
+        std::array<double, 6> inputs;
+        double                alpha_s_mu_t, alpha_s_mu_b, alpha_s_mu_c;
         {
-            if (mu < _mu_t__qcd)
+            Lock l(_imp->mutex);
+            _imp->update();
+
+            const auto & memo = _imp->alpha_s_memo[index];
+            if (memo.first == mu)
             {
-                return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_5);
+                return memo.second;
             }
 
-            alpha_s_0 = QCD::alpha_s(_mu_t__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_5);
-            mu_0      = _mu_t__qcd;
-
-            return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_6);
+            inputs       = _imp->inputs;
+            alpha_s_mu_t = _imp->alpha_s_mu_t;
+            alpha_s_mu_b = _imp->alpha_s_mu_b;
+            alpha_s_mu_c = _imp->alpha_s_mu_c;
         }
 
-        if (mu >= _mu_b__qcd)
+        const auto & [alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd] = inputs;
+        double result;
+
+        if (mu >= m_Z)
         {
-            return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_5);
+            if (mu < mu_t)
+            {
+                result = QCD::alpha_s(mu, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+            }
+            else
+            {
+                result = QCD::alpha_s(mu, alpha_s_mu_t, mu_t, QCD::beta_function_nf_6);
+            }
         }
-
-        alpha_s_0 = QCD::alpha_s(_mu_b__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_5);
-        mu_0      = _mu_b__qcd;
-
-        if (mu >= _mu_c__qcd)
+        else if (mu >= mu_b)
         {
-            return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_4);
+            result = QCD::alpha_s(mu, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+        }
+        else if (mu >= mu_c)
+        {
+            result = QCD::alpha_s(mu, alpha_s_mu_b, mu_b, QCD::beta_function_nf_4);
+        }
+        else if (mu >= lambda_qcd)
+        {
+            result = QCD::alpha_s(mu, alpha_s_mu_c, mu_c, QCD::beta_function_nf_3);
+        }
+        else
+        {
+            throw InternalError("SMComponent<components::QCD>::alpha_s: Cannot run alpha_s to mu < lambda_qcd");
         }
 
-        alpha_s_0 = QCD::alpha_s(_mu_c__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_4);
-        mu_0      = _mu_c__qcd;
-
-        if (mu >= _lambda_qcd__qcd)
+        // do not store a value obtained for outdated inputs
         {
-            return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_3);
+            Lock l(_imp->mutex);
+            if (_imp->inputs == inputs)
+            {
+                _imp->alpha_s_memo[index] = { mu, result };
+            }
         }
 
-        throw InternalError("SMComponent<components::QCD>::alpha_s: Cannot run alpha_s to mu < lambda_qcd");
+        return result;
     }
 
     double
@@ -304,6 +405,22 @@ namespace eos
         }
         double m_b_MSbar = _m_b_MSbar__qcd();
 
+        // the mutex is not held during the fixed-point procedure, since it runs alpha_s
+        std::array<double, 6> inputs;
+        {
+            Lock l(_imp->mutex);
+            _imp->update();
+
+            const auto & cached = _imp->m_b_pole[loop_order];
+            if (cached.first == m_b_MSbar)
+            {
+                return cached.second;
+            }
+
+            inputs = _imp->inputs;
+        }
+        const double m_b_MSbar_input = m_b_MSbar;
+
         // Initial guess
         //                a                               m0                  b                                          m0                  c
         double m_b_pole = c[loop_order][1] + (m_b_MSbar - c[loop_order][0]) * c[loop_order][2] + power_of<2>(m_b_MSbar - c[loop_order][0]) * c[loop_order][3];
@@ -320,6 +437,12 @@ namespace eos
 
             if (std::abs(delta) < 1e-3)
             {
+                Lock l(_imp->mutex);
+                if (_imp->inputs == inputs)
+                {
+                    _imp->m_b_pole[loop_order] = { m_b_MSbar_input, m_b_pole };
+                }
+
                 return m_b_pole;
             }
         }
@@ -384,6 +507,23 @@ namespace eos
         static const double m0 = 1.27, a = 1.59564, b = 1.13191, c = -0.737165;
 
         double m_c_MSbar = _m_c_MSbar__qcd();
+
+        // the mutex is not held during the fixed-point procedure, since it runs alpha_s
+        std::array<double, 6> inputs;
+        {
+            Lock l(_imp->mutex);
+            _imp->update();
+
+            const auto & cached = _imp->m_c_pole;
+            if (cached.first == m_c_MSbar)
+            {
+                return cached.second;
+            }
+
+            inputs = _imp->inputs;
+        }
+        const double m_c_MSbar_input = m_c_MSbar;
+
         double m_c_pole  = a + (m_c_MSbar - m0) * b + power_of<2>(m_c_MSbar - m0) * c;
 
         for (int i = 0; i < 10; ++i)
@@ -400,6 +540,14 @@ namespace eos
             }
         }
 
+        {
+            Lock l(_imp->mutex);
+            if (_imp->inputs == inputs)
+            {
+                _imp->m_c_pole = { m_c_MSbar_input, m_c_pole };
+            }
+        }
+
         return m_c_pole;
     }
 
@@ -760,7 +908,7 @@ namespace eos
         // SM Wilson coefficients are real so cp conjugation has no effect
 
         // RGE
-        thread_local static const MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, 5u, 10u> rge{
+        static const MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, 5u, 10u> rge{
             // gamma_0: eigenvalues
             (2.0 / 3.0) * std::array<double, 10u>{ { -24.0, -12.0, 6.0, 3.0, (-17.0 - sqrt(241.0)), -24.0, (+1.0 + sqrt(241.0)), (+1.0 - sqrt(241.0)), 3.0, (-17 + sqrt(241.0)) } },
             // gamma_0: V
@@ -855,7 +1003,7 @@ namespace eos
         // SM Wilson coefficients are real so cp conjugation has no effect
 
         // RGE
-        thread_local static const MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, 5u, 10u> rge{
+        static const MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, 5u, 10u> rge{
             // gamma_0: eigenvalues
             (2.0 / 3.0) * std::array<double, 10u>{ { -24.0, -12.0, 6.0, 3.0, (-17.0 - sqrt(241.0)), -24.0, (+1.0 + sqrt(241.0)), (+1.0 - sqrt(241.0)), 3.0, (-17 + sqrt(241.0)) } },
             // gamma_0: V
@@ -1083,7 +1231,7 @@ namespace eos
         // RGE [dB:2017A] and [dBMS:2016A]
 
         // RGE mu_b < mu < mu_W
-        thread_local static const MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, 5u, 2u> rgeW{ // gamma_0: eigenvalues
+        static const MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, 5u, 2u> rgeW{ // gamma_0: eigenvalues
                                                                                                             std::array<double, 2u>{ { -8., 4. } },
                                                                                                             // gamma_0: V
                                                                                                             { {
@@ -1103,7 +1251,7 @@ namespace eos
         };
 
         // RGE mu_c < mu < mu_b
-        thread_local static const MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, 4u, 10u> rgeb{
+        static const MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, 4u, 10u> rgeb{
             // gamma_0: eigenvalues
             std::array<double, 10u>{ { -16.666666667, -16.6666666667, -14.0856421441, -8., -7.3333333333, -7.0020014176, -6., 5.7817459320, 4., 2.1947865186 } },
             // gamma_0: V
@@ -1244,7 +1392,61 @@ namespace eos
 
     /* Old-style WET sectors */
 
+    template <> struct Implementation<SMComponent<components::DeltaBS1>>
+    {
+        // Inputs of the Wilson coefficients: alpha_s(MZ), mu_t, mu_b, mu_c, sin^2(theta_W), m_t(pole), m_W, m_Z, mu_0c, and mu_0t
+        std::array<Parameter, 10> parameters;
+
+        // Values of the inputs for which the cache is valid
+        std::array<double, 10> inputs;
+
+        // Recently evaluated Wilson coefficients, stored as (mu, C(mu)) and replaced in round-robin order
+        static constexpr std::size_t memo_size = 4;
+        std::array<std::pair<double, WilsonCoefficients<BToS>>, memo_size> memo;
+        std::size_t next;
+
+        // Guards all of the above, since one component might be used from several threads
+        Mutex mutex;
+
+        Implementation(const Parameters & p) :
+            parameters{ p["QCD::alpha_s(MZ)"], p["QCD::mu_t"], p["QCD::mu_b"], p["QCD::mu_c"], p["GSW::sin^2(theta)"], p["mass::t(pole)"], p["mass::W"], p["mass::Z"], p["b->s::mu_0c"], p["b->s::mu_0t"] }
+        {
+            inputs.fill(std::numeric_limits<double>::quiet_NaN());
+            reset();
+        }
+
+        void
+        reset()
+        {
+            for (auto & entry : memo)
+            {
+                entry.first = std::numeric_limits<double>::quiet_NaN();
+            }
+            next = 0;
+        }
+
+        // Bring the cache up to date with the current values of the inputs; requires the mutex to be held
+        void
+        update()
+        {
+            std::array<double, 10> current;
+            for (std::size_t i = 0; i < parameters.size(); ++i)
+            {
+                current[i] = parameters[i]();
+            }
+
+            if (current == inputs)
+            {
+                return;
+            }
+
+            inputs = current;
+            reset();
+        }
+    };
+
     SMComponent<components::DeltaBS1>::SMComponent(const Parameters & p, ParameterUser & u) :
+        PrivateImplementationPattern<SMComponent<components::DeltaBS1>>(new Implementation<SMComponent<components::DeltaBS1>>(p)),
         _alpha_s_Z__deltabs1(p["QCD::alpha_s(MZ)"], u),
         _mu_t__deltabs1(p["QCD::mu_t"], u),
         _mu_b__deltabs1(p["QCD::mu_b"], u),
@@ -1258,6 +1460,8 @@ namespace eos
     {
     }
 
+    SMComponent<components::DeltaBS1>::~SMComponent() = default;
+
     /* b->s Wilson coefficients */
     namespace implementation
     {
@@ -1378,6 +1582,23 @@ namespace eos
             throw InternalError("SMComponent<components::DeltaB1>::wilson_coefficients_b_to_s: Evolution to mu <= mu_c is not yet implemented!");
         }
 
+        // the mutex is not held during the evolution, such that other scales can be looked up in the meantime
+        std::array<double, 10> inputs;
+        {
+            Lock l(_imp->mutex);
+            _imp->update();
+
+            for (const auto & [mu_memo, wc_memo] : _imp->memo)
+            {
+                if (mu_memo == mu)
+                {
+                    return wc_memo;
+                }
+            }
+
+            inputs = _imp->inputs;
+        }
+
         // only evolve the wilson coefficients for 5 active flavors
         static const double nf = 5.0;
 
@@ -1436,6 +1657,17 @@ namespace eos
         WilsonCoefficients<BToS> wc = downscaled_top;
         wc._sm_like_coefficients    = wc._sm_like_coefficients + complex<double>(-1.0, 0.0) * downscaled_charm._sm_like_coefficients;
 
+        // do not store Wilson coefficients obtained for outdated inputs
+        {
+            Lock l(_imp->mutex);
+            _imp->update();
+            if (_imp->inputs == inputs)
+            {
+                _imp->memo[_imp->next] = { mu, wc };
+                _imp->next             = (_imp->next + 1) % Implementation<SMComponent<components::DeltaBS1>>::memo_size;
+            }
+        }
+
         return wc;
     }
 
@@ -54,7 +54,9 @@ namespace eos
             virtual complex<double> ckm_tb() const;
     };
 
-    template <> class SMComponent<components::QCD> : public virtual ModelComponent<components::QCD>
+    template <> class SMComponent<components::QCD> :
+        public virtual ModelComponent<components::QCD>,
+        public PrivateImplementationPattern<SMComponent<components::QCD>>
     {
         private:
             /* QCD parameters */
@@ -75,8 +77,16 @@ namespace eos
 
         public:
             SMComponent(const Parameters &, ParameterUser &);
-
-            /* QCD */
+            ~SMComponent();
+
+            /*
+             * QCD
+             *
+             * The running of alpha_s and the pole masses are cached for the current values of the
+             * QCD parameters and quark masses. The cache is invalidated whenever these values change.
+             * Accesses to the cache are guarded by a mutex, such that one component can be used from
+             * several threads.
+             */
             virtual double alpha_s(const double &) const;
             virtual double m_t_msbar(const double & mu) const;
             virtual double m_t_pole() const;
@@ -289,7 +299,9 @@ namespace eos
 
     /* Old-style WET sectors */
 
-    template <> class SMComponent<components::DeltaBS1> : public virtual ModelComponent<components::DeltaBS1>
+    template <> class SMComponent<components::DeltaBS1> :
+        public virtual ModelComponent<components::DeltaBS1>,
+        public PrivateImplementationPattern<SMComponent<components::DeltaBS1>>
     {
         private:
             /* QCD parameters */
@@ -312,8 +324,16 @@ namespace eos
 
         public:
             SMComponent(const Parameters &, ParameterUser &);
-
-            /* b->s Wilson coefficients */
+            ~SMComponent();
+
+            /*
+             * b->s Wilson coefficients
+             *
+             * The Wilson coefficients are cached for the most recently used scales and the current
+             * values of the parameters. The cache is invalidated whenever these values change.
+             * Accesses to the cache are guarded by a mutex, such that one component can be used from
+             * several threads.
+             */
             virtual WilsonCoefficients<BToS> wilson_coefficients_b_to_s(const double & mu, const LeptonFlavor & lepton_flavor, const bool & cp_conjugate) const;
     };
 
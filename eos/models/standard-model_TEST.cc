@@ -20,10 +20,13 @@
 
 #include <eos/models/model.hh>
 #include <eos/models/standard-model.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <test/test.hh>
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -127,6 +130,94 @@ class AlphaSTest : public TestCase
         }
 } sm_alpha_s_test;
 
+class QCDCacheTest : public TestCase
+{
+    public:
+        QCDCacheTest() :
+            TestCase("sm_qcd_cache_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            Parameters    p = reference_parameters();
+            StandardModel model(p);
+
+            const double alpha_s_4_2 = model.alpha_s(4.2);
+            const double alpha_s_1_5 = model.alpha_s(1.5);
+            const double m_b_pole    = model.m_b_pole();
+            const double m_c_pole    = model.m_c_pole();
+
+            // repeated evaluation yields identical results
+            TEST_CHECK_EQUAL(model.alpha_s(4.2), alpha_s_4_2);
+            TEST_CHECK_EQUAL(model.alpha_s(1.5), alpha_s_1_5);
+            TEST_CHECK_EQUAL(model.m_b_pole(),   m_b_pole);
+            TEST_CHECK_EQUAL(model.m_c_pole(),   m_c_pole);
+
+            // changing the inputs invalidates the cached values
+            {
+                p["QCD::alpha_s(MZ)"] = 0.1200;
+                p["mass::b(MSbar)"]   = 4.18;
+
+                StandardModel reference(p.clone());
+
+                TEST_CHECK_EQUAL(model.alpha_s(4.2), reference.alpha_s(4.2));
+                TEST_CHECK_EQUAL(model.alpha_s(1.5), reference.alpha_s(1.5));
+                TEST_CHECK_EQUAL(model.m_b_pole(),   reference.m_b_pole());
+                TEST_CHECK_EQUAL(model.m_c_pole(),   reference.m_c_pole());
+                TEST_CHECK(model.alpha_s(4.2) > alpha_s_4_2);
+            }
+
+            // restoring the inputs restores the original values
+            {
+                p["QCD::alpha_s(MZ)"] = 0.117620;
+                p["mass::b(MSbar)"]   = 4.2;
+
+                TEST_CHECK_EQUAL(model.alpha_s(4.2), alpha_s_4_2);
+                TEST_CHECK_EQUAL(model.alpha_s(1.5), alpha_s_1_5);
+                TEST_CHECK_EQUAL(model.m_b_pole(),   m_b_pole);
+                TEST_CHECK_EQUAL(model.m_c_pole(),   m_c_pole);
+            }
+
+            // the threshold scales are part of the cache key
+            {
+                const double alpha_s_1_25 = model.alpha_s(1.25);
+
+                p["QCD::mu_c"] = 1.3;
+
+                StandardModel reference(p.clone());
+
+                TEST_CHECK_EQUAL(model.alpha_s(1.25), reference.alpha_s(1.25));
+                TEST_CHECK_EQUAL(model.m_c_pole(),    reference.m_c_pole());
+                TEST_CHECK(model.alpha_s(1.25) != alpha_s_1_25);
+
+                p["QCD::mu_c"] = 1.2;
+            }
+
+            // one model can be used from several threads
+            {
+                static const std::array<double, 8> scales{ 1.25, 1.5, 2.0, 3.0, 4.2, 4.8, 80.0, 175.0 };
+
+                StandardModel shared(p);
+                StandardModel reference(p.clone());
+
+                std::vector<std::array<double, 3>> results(64);
+                ThreadPool::instance()
+                    ->enqueue_range(results.size(),
+                                    [&](const unsigned & j) { results[j] = { shared.alpha_s(scales[j % scales.size()]), shared.m_b_pole(), shared.m_c_pole() }; })
+                    .wait();
+
+                for (unsigned j = 0; j < results.size(); ++j)
+                {
+                    TEST_CHECK_EQUAL(results[j][0], reference.alpha_s(scales[j % scales.size()]));
+                    TEST_CHECK_EQUAL(results[j][1], reference.m_b_pole());
+                    TEST_CHECK_EQUAL(results[j][2], reference.m_c_pole());
+                }
+            }
+        }
+} sm_qcd_cache_test;
+
 class TMassesTest : public TestCase
 {
     public:
@@ -449,6 +540,79 @@ class WilsonCoefficientsBToSTest : public TestCase
         }
 } wilson_coefficients_b_to_s_test;
 
+class WilsonCoefficientsBToSCacheTest : public TestCase
+{
+    public:
+        WilsonCoefficientsBToSCacheTest() :
+            TestCase("wilson_coefficients_b_to_s_cache_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            const auto check_equal = [](const WilsonCoefficients<BToS> & a, const WilsonCoefficients<BToS> & b)
+            {
+                for (unsigned i = 0; i < 15; ++i)
+                {
+                    TEST_CHECK_EQUAL(a._sm_like_coefficients[i], b._sm_like_coefficients[i]);
+                }
+            };
+
+            Parameters    p = reference_parameters();
+            StandardModel model(p);
+
+            // more scales than cache entries
+            const std::array<double, 6> scales{ 4.2, 2.1, 4.8, 3.0, 2.5, 4.2 };
+            std::array<WilsonCoefficients<BToS>, 6> wcs;
+            for (unsigned i = 0; i < scales.size(); ++i)
+            {
+                wcs[i] = model.wilson_coefficients_b_to_s(scales[i], LeptonFlavor::muon, false);
+            }
+
+            // repeated evaluation yields identical results, independent of the lepton flavor and CP conjugation
+            for (unsigned i = 0; i < scales.size(); ++i)
+            {
+                check_equal(model.wilson_coefficients_b_to_s(scales[i], LeptonFlavor::electron, true), wcs[i]);
+            }
+
+            // changing the inputs invalidates the cached values
+            {
+                p["b->s::mu_0c"]   = 120.0;
+                p["mass::t(pole)"] = 172.0;
+
+                StandardModel reference(p.clone());
+
+                check_equal(model.wilson_coefficients_b_to_s(4.2, LeptonFlavor::muon, false), reference.wilson_coefficients_b_to_s(4.2, LeptonFlavor::muon, false));
+                TEST_CHECK(model.wilson_coefficients_b_to_s(4.2, LeptonFlavor::muon, false).c9() != wcs[0].c9());
+            }
+
+            // restoring the inputs restores the original values
+            {
+                p["b->s::mu_0c"]   = reference_parameters()["b->s::mu_0c"].evaluate();
+                p["mass::t(pole)"] = reference_parameters()["mass::t(pole)"].evaluate();
+
+                check_equal(model.wilson_coefficients_b_to_s(4.2, LeptonFlavor::muon, false), wcs[0]);
+                check_equal(model.wilson_coefficients_b_to_s(2.1, LeptonFlavor::muon, false), wcs[1]);
+            }
+
+            // one model can be used from several threads, with more scales than cache entries
+            {
+                StandardModel shared(p);
+
+                std::vector<WilsonCoefficients<BToS>> results(64);
+                ThreadPool::instance()
+                    ->enqueue_range(results.size(), [&](const unsigned & j) { results[j] = shared.wilson_coefficients_b_to_s(scales[j % scales.size()], LeptonFlavor::muon, false); })
+                    .wait();
+
+                for (unsigned j = 0; j < results.size(); ++j)
+                {
+                    check_equal(results[j], wcs[j % scales.size()]);
+                }
+            }
+        }
+} wilson_coefficients_b_to_s_cache_test;
+
 class WilsonCoefficientsUCTest : public TestCase
 {
     public:
@@ -882,43 +882,25 @@ namespace eos
     WilsonCoefficients<wc::UC>
     WilsonScanComponent<components::WET::UC>::wilson_coefficients_uc(const LeptonFlavor & lepton_flavor, const bool & cp_conjugate) const
     {
-        std::function<complex<double>()> c9, c9prime;
-        std::function<complex<double>()> c10, c10prime;
-        std::function<complex<double>()> cS, cSprime;
-        std::function<complex<double>()> cP, cPprime;
-        std::function<complex<double>()> cT, cT5;
-
-        if (LeptonFlavor::electron == lepton_flavor)
-        {
-            c9       = _e_c9;
-            c9prime  = _e_c9prime;
-            c10      = _e_c10;
-            c10prime = _e_c10prime;
-            cS       = _e_cS;
-            cSprime  = _e_cSprime;
-            cP       = _e_cP;
-            cPprime  = _e_cPprime;
-            cT       = _e_cT;
-            cT5      = _e_cT5;
-        }
-        else if (LeptonFlavor::muon == lepton_flavor)
-        {
-            c9       = _mu_c9;
-            c9prime  = _mu_c9prime;
-            c10      = _mu_c10;
-            c10prime = _mu_c10prime;
-            cS       = _mu_cS;
-            cSprime  = _mu_cSprime;
-            cP       = _mu_cP;
-            cPprime  = _mu_cPprime;
-            cT       = _mu_cT;
-            cT5      = _mu_cT5;
-        }
-        else
+        if ((LeptonFlavor::electron != lepton_flavor) && (LeptonFlavor::muon != lepton_flavor))
         {
             throw InternalError("WilsonScan presently only implements 'e' and 'mu' lepton flavors");
         }
 
+        // refer to the coefficients of the lepton flavor rather than copying them on every call
+        const bool electron = (LeptonFlavor::electron == lepton_flavor);
+
+        const std::function<complex<double>()> & c9       = electron ? _e_c9       : _mu_c9;
+        const std::function<complex<double>()> & c9prime  = electron ? _e_c9prime  : _mu_c9prime;
+        const std::function<complex<double>()> & c10      = electron ? _e_c10      : _mu_c10;
+        const std::function<complex<double>()> & c10prime = electron ? _e_c10prime : _mu_c10prime;
+        const std::function<complex<double>()> & cS       = electron ? _e_cS       : _mu_cS;
+        const std::function<complex<double>()> & cSprime  = electron ? _e_cSprime  : _mu_cSprime;
+        const std::function<complex<double>()> & cP       = electron ? _e_cP       : _mu_cP;
+        const std::function<complex<double>()> & cPprime  = electron ? _e_cPprime  : _mu_cPprime;
+        const std::function<complex<double>()> & cT       = electron ? _e_cT       : _mu_cT;
+        const std::function<complex<double>()> & cT5      = electron ? _e_cT5      : _mu_cT5;
+
         double alpha_s = 0.0;
         if (_mu__uc < _mu_b__uc)
         {
@@ -1069,43 +1051,25 @@ namespace eos
     WilsonCoefficients<BToS>
     WilsonScanComponent<components::DeltaBS1>::wilson_coefficients_b_to_s(const double & /*mu*/, const LeptonFlavor & lepton_flavor, const bool & cp_conjugate) const
     {
-        std::function<complex<double>()> c9, c9prime;
-        std::function<complex<double>()> c10, c10prime;
-        std::function<complex<double>()> cS, cSprime;
-        std::function<complex<double>()> cP, cPprime;
-        std::function<complex<double>()> cT, cT5;
-
-        if (LeptonFlavor::electron == lepton_flavor)
-        {
-            c9       = _e_c9;
-            c9prime  = _e_c9prime;
-            c10      = _e_c10;
-            c10prime = _e_c10prime;
-            cS       = _e_cS;
-            cSprime  = _e_cSprime;
-            cP       = _e_cP;
-            cPprime  = _e_cPprime;
-            cT       = _e_cT;
-            cT5      = _e_cT5;
-        }
-        else if (LeptonFlavor::muon == lepton_flavor)
-        {
-            c9       = _mu_c9;
-            c9prime  = _mu_c9prime;
-            c10      = _mu_c10;
-            c10prime = _mu_c10prime;
-            cS       = _mu_cS;
-            cSprime  = _mu_cSprime;
-            cP       = _mu_cP;
-            cPprime  = _mu_cPprime;
-            cT       = _mu_cT;
-            cT5      = _mu_cT5;
-        }
-        else
+        if ((LeptonFlavor::electron != lepton_flavor) && (LeptonFlavor::muon != lepton_flavor))
         {
             throw InternalError("WilsonScan presently only implements 'e' and 'mu' lepton flavors");
         }
 
+        // refer to the coefficients of the lepton flavor rather than copying them on every call
+        const bool electron = (LeptonFlavor::electron == lepton_flavor);
+
+        const std::function<complex<double>()> & c9       = electron ? _e_c9       : _mu_c9;
+        const std::function<complex<double>()> & c9prime  = electron ? _e_c9prime  : _mu_c9prime;
+        const std::function<complex<double>()> & c10      = electron ? _e_c10      : _mu_c10;
+        const std::function<complex<double>()> & c10prime = electron ? _e_c10prime : _mu_c10prime;
+        const std::function<complex<double>()> & cS       = electron ? _e_cS       : _mu_cS;
+        const std::function<complex<double>()> & cSprime  = electron ? _e_cSprime  : _mu_cSprime;
+        const std::function<complex<double>()> & cP       = electron ? _e_cP       : _mu_cP;
+        const std::function<complex<double>()> & cPprime  = electron ? _e_cPprime  : _mu_cPprime;
+        const std::function<complex<double>()> & cT       = electron ? _e_cT       : _mu_cT;
+        const std::function<complex<double>()> & cT5      = electron ? _e_cT5      : _mu_cT5;
+
         double alpha_s = 0.0;
         if (_mu__deltabs1 < _mu_b__deltabs1)
         {
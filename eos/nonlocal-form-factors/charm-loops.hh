@@ -33,17 +33,15 @@ namespace eos
     class CharmLoopsInterpolation
     {
         private:
-        const CSplineInterpolation real_part;
-        const CSplineInterpolation imag_part;
+        const ComplexCSplineInterpolation interpolation;
 
         public:
         CharmLoopsInterpolation(std::vector<double> x, std::vector<double> y_real, std::vector<double> y_imag):
-            real_part(x, y_real),
-            imag_part(x, y_imag)
+            interpolation(x, y_real, y_imag)
         {}
         ~CharmLoopsInterpolation() = default;
 
-        complex<double> operator()(const double & s) const { return complex<double>(real_part(s), imag_part(s)); };
+        complex<double> operator()(const double & s) const { return interpolation(s); };
     };
 
     struct CharmLoops
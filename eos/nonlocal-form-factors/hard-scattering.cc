@@ -223,6 +223,12 @@ namespace eos
         return 2 * m_B / (ub * E) * I1(s, u, m_q, m_B);
     }
 
+    double
+    HardScattering::LCDA_2pt(const double & u, const double & a_1, const double & a_2)
+    {
+        return lcda_tw2(u, a_1, a_2);
+    }
+
     double
     HardScattering::j0(const double & s, const double & u, const double & m_B, const double & a_1, const double & a_2)
     {
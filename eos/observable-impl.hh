@@ -35,7 +35,10 @@ namespace eos
     namespace impl
     {
         extern std::map<QualifiedName, ObservableEntryPtr> observable_entries;
-    }
+
+        // Check the buffers passed to Observable::evaluate_batch, and return the number of points.
+        std::size_t batch_size(const std::vector<std::string> & variables, std::span<const double> points, std::span<double> results);
+    } // namespace impl
 
     template <> struct Implementation<ObservableGroup>
     {
@@ -44,6 +44,7 @@
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_stub.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
@@ -99,10 +100,76 @@ namespace eos
 
     Observable::~Observable() = default;
 
+    void
+    Observable::evaluate_batch(const std::vector<std::string> & variables, std::span<const double> points, std::span<double> results)
+    {
+        const auto n = impl::batch_size(variables, points, results);
+
+        auto                           k = this->kinematics();
+        std::vector<KinematicVariable> kv;
+        std::vector<double>            previous_values;
+        for (const auto & variable : variables)
+        {
+            kv.push_back(k[variable]);
+            previous_values.push_back(kv.back().evaluate());
+        }
+
+        auto restore = [&]()
+        {
+            for (unsigned j = 0; j < kv.size(); ++j)
+            {
+                kv[j].set(previous_values[j]);
+            }
+        };
+
+        try
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                for (unsigned j = 0; j < kv.size(); ++j)
+                {
+                    kv[j].set(points[i * kv.size() + j]);
+                }
+
+                results[i] = this->evaluate();
+            }
+        }
+        catch (...)
+        {
+            restore();
+            throw;
+        }
+
+        restore();
+    }
+
     namespace impl
     {
         std::map<QualifiedName, ObservableEntryPtr> observable_entries;
-    }
+
+        std::size_t
+        batch_size(const std::vector<std::string> & variables, std::span<const double> points, std::span<double> results)
+        {
+            if (variables.empty())
+            {
+                throw InternalError("Observable::evaluate_batch: at least one kinematic variable is required");
+            }
+
+            if (0 != points.size() % variables.size())
+            {
+                throw InternalError("Observable::evaluate_batch: number of values " + stringify(points.size()) + " is not a multiple of the number of kinematic variables "
+                                    + stringify(variables.size()));
+            }
+
+            const std::size_t n = points.size() / variables.size();
+            if (results.size() != n)
+            {
+                throw InternalError("Observable::evaluate_batch: output buffer holds " + stringify(results.size()) + " values, but " + stringify(n) + " are required");
+            }
+
+            return n;
+        }
+    } // namespace impl
 
     ObservableEntries::ObservableEntries() :
         _entries(&impl::observable_entries)
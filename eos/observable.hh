@@ -32,6 +32,7 @@
 #include <eos/utils/units.hh>
 
 #include <map>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -58,6 +59,18 @@ namespace eos
 
             virtual double evaluate() const = 0;
 
+            /*!
+             * Evaluate the observable for a batch of kinematic points.
+             *
+             * @param variables The names of the kinematic variables that are varied.
+             * @param points    The values of the kinematic variables, stored point by point with variables.size() values each.
+             * @param results   The output buffer, holding one value per point.
+             *
+             * The default implementation sets the kinematic variables for each point in turn, and restores
+             * their previous values afterwards.
+             */
+            virtual void evaluate_batch(const std::vector<std::string> & variables, std::span<const double> points, std::span<double> results);
+
             virtual Kinematics kinematics() = 0;
 
             virtual Parameters parameters() = 0;
@@ -20,6 +20,7 @@
 #include <eos/observable.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/options.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/units.hh>
 
 #include <test/test.hh>
@@ -311,6 +312,81 @@ class ObservableTest : public TestCase
                 TEST_CHECK_EQUAL(o.has("B_c->lnu::BR"), true);
                 TEST_CHECK_EQUAL(o.has("B_c->lnu::TEST"), false);
             }
+
+            // Observable::evaluate_batch
+            {
+                Parameters p = Parameters::Defaults();
+                Kinematics k{
+                    { "z",  1.0 },
+                    { "q2", 1.0 }
+                };
+                Options o;
+
+                auto observables = Observables();
+                observables.insert("test::twice_legendre", "", Unit::None(), Options(), "2 * <<TestLegendre1D::UnnormalizedPDF>>");
+
+                auto concrete_observable   = Observable::make("TestLegendre1D::UnnormalizedPDF", p, k, o);
+                auto expression_observable = Observable::make("test::twice_legendre", p, k, o);
+
+                // few points are evaluated serially, many points in parallel
+                for (unsigned n : { 10u, 200u })
+                {
+                    std::vector<double> points(n), results(n), expression_results(n);
+                    for (unsigned i = 0; i < n; ++i)
+                    {
+                        points[i] = 4.0 * i / (n - 1);
+                    }
+
+                    concrete_observable->evaluate_batch({ "z" }, points, results);
+                    expression_observable->evaluate_batch({ "z" }, points, expression_results);
+
+                    for (unsigned i = 0; i < n; ++i)
+                    {
+                        k.set("z", points[i]);
+                        TEST_CHECK_NEARLY_EQUAL(results[i], concrete_observable->evaluate(), 1.0e-12);
+                        TEST_CHECK_NEARLY_EQUAL(expression_results[i], 2.0 * concrete_observable->evaluate(), 1.0e-12);
+                    }
+                    k.set("z", 1.0);
+                }
+
+                // the kinematic variables are left untouched
+                std::vector<double> points{ 0.5, 1.5, 2.5 }, results(3);
+                expression_observable->evaluate_batch({ "z" }, points, results);
+                TEST_CHECK_EQUAL(double(k["z"]), 1.0);
+
+                // the buffers must match the number of points
+                std::vector<double> too_few_results(2);
+                TEST_CHECK_THROWS(InternalError, concrete_observable->evaluate_batch({ "z" }, points, too_few_results));
+                TEST_CHECK_THROWS(InternalError, expression_observable->evaluate_batch({ "z" }, points, too_few_results));
+                TEST_CHECK_THROWS(InternalError, concrete_observable->evaluate_batch({ "z", "z" }, points, results));
+
+                // kinematic variables that the observable does not use are rejected
+                TEST_CHECK_THROWS(InternalError, concrete_observable->evaluate_batch({ "q2" }, points, results));
+
+                // batches can be evaluated from within the jobs of the thread pool, even if all workers are busy
+                {
+                    const unsigned      jobs = 2 * ThreadPool::instance()->number_of_threads();
+                    const unsigned      n    = 200;
+                    std::vector<double> many_points(n);
+                    for (unsigned i = 0; i < n; ++i)
+                    {
+                        many_points[i] = 4.0 * i / (n - 1);
+                    }
+
+                    std::vector<double> reference(n);
+                    concrete_observable->evaluate_batch({ "z" }, many_points, reference);
+
+                    std::vector<std::vector<double>> job_results(jobs, std::vector<double>(n));
+                    ThreadPool::instance()
+                            ->enqueue_range(jobs, [&](const unsigned & j) { concrete_observable->evaluate_batch({ "z" }, many_points, job_results[j]); })
+                            .wait();
+
+                    for (const auto & job_result : job_results)
+                    {
+                        TEST_CHECK(job_result == reference);
+                    }
+                }
+            }
         }
 
 } observable_test;
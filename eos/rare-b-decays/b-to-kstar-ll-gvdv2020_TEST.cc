@@ -128,6 +128,32 @@ class BToKstarDileptonGvDV2020Test :
             TEST_CHECK_RELATIVE_ERROR(imag(amps.a_perp_right),  7.42463e-11,  eps);
             TEST_CHECK_RELATIVE_ERROR(real(amps.a_time),       -1.45112e-10,  eps);
             TEST_CHECK_RELATIVE_ERROR(imag(amps.a_time),       -2.79261e-11,  eps);
+
+            // Gauss-Legendre integration agrees with the adaptive cubature
+            {
+                BToKstarDilepton d_cub(p, oo);
+
+                oo.declare("integration"_ok, "gauss-legendre"_ov);
+                BToKstarDilepton d_gl(p, oo);
+
+                // the adaptive cubature has a relative tolerance of 1e-5 per integral, and the ratios involve two integrals
+                static const double eps_int = 5e-5;
+
+                // the lowest bin starts at the threshold, where the integrand has a square-root behaviour close to the photon pole;
+                // the highest bin ends at the kinematic endpoint, where the integrand has a square-root behaviour as well
+                const double q2_threshold = 4.0 * power_of<2>(p["mass::mu"].evaluate());
+                const double q2_endpoint  = power_of<2>(p["mass::B_d"].evaluate() - p["mass::K_d^*"].evaluate());
+                for (const auto & [q2_min, q2_max] : { std::make_pair(q2_threshold, 0.98), std::make_pair(1.1, 6.0), std::make_pair(15.0, 19.0), std::make_pair(15.0, q2_endpoint) })
+                {
+                    const double br_cub   = d_cub.integrated_branching_ratio(d_cub.prepare(q2_min, q2_max));
+                    const double a_fb_cub = d_cub.integrated_forward_backward_asymmetry(d_cub.prepare(q2_min, q2_max));
+                    const double f_l_cub  = d_cub.integrated_longitudinal_polarisation(d_cub.prepare(q2_min, q2_max));
+
+                    TEST_CHECK_RELATIVE_ERROR(d_gl.integrated_branching_ratio(d_gl.prepare(q2_min, q2_max)),            br_cub,   eps_int);
+                    TEST_CHECK_NEARLY_EQUAL(d_gl.integrated_forward_backward_asymmetry(d_gl.prepare(q2_min, q2_max)),   a_fb_cub, eps_int);
+                    TEST_CHECK_NEARLY_EQUAL(d_gl.integrated_longitudinal_polarisation(d_gl.prepare(q2_min, q2_max)),    f_l_cub,  eps_int);
+                }
+            }
        }
     }
 } b_to_kstar_dilepton_GvDV2020_test;
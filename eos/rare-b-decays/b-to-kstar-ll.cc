@@ -22,6 +22,7 @@
 
 #include <eos/maths/integrate.hh>
 #include <eos/maths/integrate-impl.hh>
+#include <eos/maths/integrate-panels.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-base.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-bfs2004.hh>
@@ -44,8 +45,15 @@ namespace eos
 
         std::shared_ptr<Model> model;
 
+        ParameterUser & parameter_user;
+
         LeptonFlavorOption opt_l;
 
+        RestrictedOption opt_integration;
+
+        // shared cache of the angular coefficients at the q^2 nodes; only used for integration=gauss-legendre
+        std::shared_ptr<PanelIntegrator<BToKstarDilepton, std::array<double, 12>>> panels;
+
         UsedParameter hbar;
         UsedParameter m_l;
         UsedParameter tau;
@@ -59,7 +67,9 @@ namespace eos
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model"_ok, "WET"_ov), p, o)),
+            parameter_user(u),
             opt_l(o, options, "l"_ok),
+            opt_integration(o, options, "integration"_ok),
             hbar(p["QM::hbar"], u),
             m_l(p["mass::" + opt_l.str()], u),
             tau(p["life_time::B_" + o.get("q"_ok, "d"_ov).str()], u),
@@ -91,6 +101,11 @@ namespace eos
             }
 
             u.uses(*amplitude_generator);
+
+            if ("gauss-legendre" == opt_integration.value())
+            {
+                panels = PanelIntegrator<BToKstarDilepton, std::array<double, 12>>::make(p, o);
+            }
         }
 
         ~Implementation()
@@ -212,6 +227,19 @@ namespace eos
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BToKstarDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
+
+            // the fixed-order rule reuses the angular coefficients at the nodes across all bins and the normalisation
+            if (panels)
+            {
+                using Integrator = PanelIntegrator<BToKstarDilepton, std::array<double, 12>>;
+
+                // refine the integration towards boundaries at the threshold 4 m_l^2 and at the kinematic endpoint (m_B - m_K^*)^2
+                const bool threshold_min = Integrator::at_threshold(q2_min, 4.0 * power_of<2>(m_l()));
+                const bool threshold_max = Integrator::at_threshold(q2_max, power_of<2>(amplitude_generator->m_B() - amplitude_generator->m_Kstar()));
+
+                return BToKstarDilepton::AngularCoefficients(panels->integrate(parameter_user, integrand, q2_min, q2_max, threshold_min, threshold_max));
+            }
+
             std::array<double, 12> integrated_angular_coefficients_array = integrate<1, 12>(integrand, q2_min, q2_max, cubature::Config().epsrel(1e-5));
 
             return BToKstarDilepton::AngularCoefficients(integrated_angular_coefficients_array);
@@ -292,7 +320,8 @@ namespace eos
     {
         Model::option_specification(),
         {"l"_ok, { "e"_ov, "mu"_ov, "tau"_ov }, "mu"_ov},
-        {"q"_ok, { "d"_ov, "u"_ov }, "d"_ov}
+        {"q"_ok, { "d"_ov, "u"_ov }, "d"_ov},
+        {"integration"_ok, { "cubature"_ov, "gauss-legendre"_ov }, "cubature"_ov}
     };
 
     double
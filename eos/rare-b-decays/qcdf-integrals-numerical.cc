@@ -20,22 +20,19 @@
 
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/nonlocal-form-factors/hard-scattering.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 #include <eos/rare-b-decays/qcdf-integrals-impl.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <cmath>
-#include <functional>
 #include <limits>
 
-#include <iostream>
-
 namespace eos
 {
-    using namespace std::placeholders;
-
     // massless case
     template <>
     QCDFIntegrals<BToKstarDilepton>
@@ -69,6 +66,118 @@ namespace eos
         throw InternalError("QCDFIntegralCalculator::photon_bottom_case: Numerical integration of photon cases not supported");
     }
 
+    namespace impl
+    {
+        /*
+         * Integrate all dilepton QCDF integrals in a single vector-valued cubature call.
+         *
+         * At each point u, the integrands share the light-cone distribution amplitudes and
+         * the loop functions I1, B0 and h, which are therefore evaluated only once. The massless
+         * case is selected through m_q = 0.
+         */
+        QCDFIntegrals<BToKstarDilepton>
+        dilepton_integrals(const double & s, const double & m_q, const double & m_B, const double & m_V, const double & mu,
+                const double & a_1_perp, const double & a_2_perp,
+                const double & a_1_para, const double & a_2_para)
+        {
+            QCDFIntegrals<BToKstarDilepton> results;
+
+            // avoid NaN at u=1
+            static const double u_min = 0.0 + 1e-5;
+            static const double u_max = 1.0 - 1e-5;
+            // We use the same regularising cut-off x ~= Lambda / m_B as in j7_zero as to ensure
+            // a smooth transition B->K^*ll -> B->K^*gamma for s -> 0. (Lambda = 0.5 / GeV).
+            // The relative error for j7  in the QCDF region 1 <= q^2 <= 6 is less than 25%.
+            // Since j7 enters only via subleading terms, it amounts to a relative error of A_FB
+            // in the SM of < 0.3%.
+            const double u_max_7 = 1.0 - 0.5 / m_B;
+            // j7 is integrated over the same interval as all other integrals by means of a linear substitution
+            const double jacobian_7 = (u_max_7 - u_min) / (u_max - u_min);
+
+            const double m_B2  = m_B * m_B;
+            const double s_hat = s / m_B2;
+            const complex<double> B0_s = (m_q == 0.0) ? complex<double>(0.0) : CharmLoops::B0(s, m_q);
+
+            // individual error criteria retain the accuracy of the formerly separate integrations
+            cubature::Config cub_conf = cubature::Config().epsrel(1e-3).individual_errors(true);
+
+            // components: j0_perp, j0bar_perp, j1_perp, j2_perp, j4_perp, j5_perp, j6_perp, j7_perp,
+            //             j0_parallel, j1_parallel, j3_parallel, j4_parallel,
+            // with the complex-valued integrals occupying two consecutive components each
+            static constexpr size_t fdim = 20;
+            cubature::integrand<1, fdim> integrand = [&](const double & u) -> std::array<double, fdim>
+            {
+                const double ubar = 1.0 - u, ubar2 = ubar * ubar;
+                const double denominator = ubar + u * s_hat;
+
+                const double phi_perp    = HardScattering::LCDA_2pt(u, a_1_perp, a_2_perp);
+                const double phibar_perp = HardScattering::LCDA_2pt(u, -a_1_perp, a_2_perp);
+                const double phi_para    = HardScattering::LCDA_2pt(u, a_1_para, a_2_para);
+
+                // cf. [BFS:2004A], eq. (52): j6 involves the first inverse partial moment of the parallel LCDA
+                const double weight_6 = power_of<2>(u) * (3.0 + a_1_para * (-9.0 + 12.0 * u) +
+                        a_2_para * (18.0 - 60.0 * u + 45.0 * power_of<2>(u)));
+
+                const complex<double> I1 = HardScattering::I1(s, u, m_q, m_B);
+                const complex<double> h  = CharmLoops::h(mu, ubar * m_B2 + u * s, m_q);
+                const complex<double> B0 = (m_q == 0.0)
+                    ? complex<double>(std::log(s_hat / denominator)) / ubar2
+                    : (CharmLoops::B0(ubar * m_B2 + u * s, m_q) - B0_s) / ubar2;
+
+                const complex<double> j1_perp = phi_perp / ubar * I1;
+                const complex<double> j2_perp = phi_perp * B0;
+                const complex<double> j4_perp = phi_perp * h;
+                const complex<double> j5_perp = phi_perp / denominator * h;
+                const complex<double> j6_perp = weight_6 * h;
+                const complex<double> j1_para = phi_para / ubar * I1;
+                const complex<double> j3_para = phi_para * B0 * denominator;
+                const complex<double> j4_para = phi_para * h;
+
+                const double u_7 = u_min + (u - u_min) * jacobian_7;
+                const double j7_perp = jacobian_7 * HardScattering::j7(s, u_7, m_B, a_1_perp, a_2_perp);
+
+                return std::array<double, fdim>{
+                    phi_perp / denominator, phibar_perp / denominator,
+                    real(j1_perp), imag(j1_perp),
+                    real(j2_perp), imag(j2_perp),
+                    real(j4_perp), imag(j4_perp),
+                    real(j5_perp), imag(j5_perp),
+                    real(j6_perp), imag(j6_perp),
+                    j7_perp,
+                    phi_para / denominator,
+                    real(j1_para), imag(j1_para),
+                    real(j3_para), imag(j3_para),
+                    real(j4_para), imag(j4_para)
+                };
+            };
+            const auto j = integrate<1, fdim>(integrand, u_min, u_max, cub_conf);
+
+            // perpendicular amplitude
+            results.j0_perp    = j[0];
+            results.j0bar_perp = j[1];
+            results.j1_perp    = complex<double>(j[2], j[3]);
+            results.j2_perp    = complex<double>(j[4], j[5]);
+            results.j4_perp    = complex<double>(j[6], j[7]);
+            results.j5_perp    = complex<double>(j[8], j[9]);
+            // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
+            results.j6_perp    = complex<double>(j[10], j[11]);
+            results.j7_perp    = j[12];
+
+            // parallel amplitude
+            results.j0_parallel = j[13];
+            results.j1_parallel = complex<double>(j[14], j[15]);
+            results.j3_parallel = complex<double>(j[16], j[17]);
+            results.j4_parallel = complex<double>(j[18], j[19]);
+
+            // composite results
+            const double eh = (1.0 + power_of<2>(m_V / m_B) - s_hat) / 2.0;
+            results.jtilde1_perp = 2.0 / eh * results.j1_perp + s_hat * results.j2_perp / (eh * eh);
+            results.jtilde2_parallel = 2.0 / eh * results.j1_parallel + results.j3_parallel / (eh * eh);
+
+            return results;
+        }
+    }
+
     // massless case
     template <>
     QCDFIntegrals<BToKstarDilepton>
@@ -77,56 +186,7 @@ namespace eos
             const double & a_1_perp, const double & a_2_perp,
             const double & a_1_para, const double & a_2_para)
     {
-        QCDFIntegrals<BToKstarDilepton> results;
-
-        // avoid NaN at u=1
-        static const double u_min = 0.0 + 1e-5;
-        static const double u_max = 1.0 - 1e-5;
-        // We use the same regularising cut-off x ~= Lambda / m_B as in j7_zero as to ensure
-        // a smooth transition B->K^*ll -> B->K^*gamma for s -> 0. (Lambda = 0.5 / GeV).
-        // The relative error for j7  in the QCDF region 1 <= q^2 <= 6 is less than 25%.
-        // Since j7 enters only via subleading terms, it amounts to a relative error of A_FB
-        // in the SM of < 0.3%.
-        static const double u_max_7 = 1.0 - 0.5 / m_B;
-
-        cubature::Config cub_conf = cubature::Config().epsrel(1e-3);
-
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, 0.0, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2_massless, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, 0.0, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, 0.0, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, 0.0, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate<1>(j_0_perp,    u_min, u_max, cub_conf);
-        results.j0bar_perp = integrate<1>(j_0bar_perp, u_min, u_max, cub_conf);
-        results.j1_perp    = integrate<1, 1, complex<double>>(j_1_perp,    u_min, u_max, cub_conf);
-        results.j2_perp    = integrate<1, 1, complex<double>>(j_2_perp,    u_min, u_max, cub_conf);
-        results.j4_perp    = integrate<1, 1, complex<double>>(j_4_perp,    u_min, u_max, cub_conf);
-        results.j5_perp    = integrate<1, 1, complex<double>>(j_5_perp,    u_min, u_max, cub_conf);
-        results.j6_perp    = integrate<1, 1, complex<double>>(j_6_perp,    u_min, u_max, cub_conf);
-        results.j7_perp    = integrate<1>(j_7_perp,    u_min, u_max_7, cub_conf);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, 0.0, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3_massless, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, 0.0, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate<1>(j_0_para, u_min, u_max, cub_conf);
-        results.j1_parallel = integrate<1, 1, complex<double>>(j_1_para, u_min, u_max, cub_conf);
-        results.j3_parallel = integrate<1, 1, complex<double>>(j_3_para, u_min, u_max, cub_conf);
-        results.j4_parallel = integrate<1, 1, complex<double>>(j_4_para, u_min, u_max, cub_conf);
-
-        // composite results
-        const double sh = s / m_B / m_B;
-        const double eh = (1.0 + power_of<2>(m_V / m_B) - sh) / 2.0;
-        results.jtilde1_perp = 2.0 / eh * results.j1_perp + sh * results.j2_perp / (eh * eh);
-        results.jtilde2_parallel = 2.0 / eh * results.j1_parallel + results.j3_parallel / (eh * eh);
-
-        return results;
+        return impl::dilepton_integrals(s, 0.0, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_para, a_2_para);
     }
 
     // charm case
@@ -137,56 +197,7 @@ namespace eos
             const double & a_1_perp, const double & a_2_perp,
             const double & a_1_para, const double & a_2_para)
     {
-        QCDFIntegrals<BToKstarDilepton> results;
-
-        // avoid NaN at u=1
-        static const double u_min = 0.0 + 1e-5;
-        static const double u_max = 1.0 - 1e-5;
-        // We use the same regularising cut-off x ~= Lambda / m_B as in j7_zero as to ensure
-        // a smooth transition B->K^*ll -> B->K^*gamma for s -> 0. (Lambda = 0.5 / GeV).
-        // The relative error for j7  in the QCDF region 1 <= q^2 <= 6 is less than 25%.
-        // Since j7 enters only via subleading terms, it amounts to a relative error of A_FB
-        // in the SM of < 0.3%.
-        static const double u_max_7 = 1.0 - 0.5 / m_B;
-
-        cubature::Config cub_conf = cubature::Config().epsrel(1e-3);
-
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2, s, _1, m_c, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, m_c, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, m_c, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, m_c, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate<1>(j_0_perp,    u_min, u_max, cub_conf);
-        results.j0bar_perp = integrate<1>(j_0bar_perp, u_min, u_max, cub_conf);
-        results.j1_perp    = integrate<1, 1, complex<double>>(j_1_perp,    u_min, u_max, cub_conf);
-        results.j2_perp    = integrate<1, 1, complex<double>>(j_2_perp,    u_min, u_max, cub_conf);
-        results.j4_perp    = integrate<1, 1, complex<double>>(j_4_perp,    u_min, u_max, cub_conf);
-        results.j5_perp    = integrate<1, 1, complex<double>>(j_5_perp,    u_min, u_max, cub_conf);
-        results.j6_perp    = integrate<1, 1, complex<double>>(j_6_perp,    u_min, u_max, cub_conf);
-        results.j7_perp    = integrate<1>(j_7_perp,    u_min, u_max_7, cub_conf);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3, s, _1, m_c, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, m_c, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate<1>(j_0_para, u_min, u_max, cub_conf);
-        results.j1_parallel = integrate<1, 1, complex<double>>(j_1_para, u_min, u_max, cub_conf);
-        results.j3_parallel = integrate<1, 1, complex<double>>(j_3_para, u_min, u_max, cub_conf);
-        results.j4_parallel = integrate<1, 1, complex<double>>(j_4_para, u_min, u_max, cub_conf);
-
-        // composite results
-        const double sh = s / m_B / m_B;
-        const double eh = (1.0 + power_of<2>(m_V / m_B) - sh) / 2.0;
-        results.jtilde1_perp = 2.0 / eh * results.j1_perp + sh * results.j2_perp / (eh * eh);
-        results.jtilde2_parallel = 2.0 / eh * results.j1_parallel + results.j3_parallel / (eh * eh);
-
-        return results;
+        return impl::dilepton_integrals(s, m_c, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_para, a_2_para);
     }
 
     // bottom case
@@ -197,55 +208,6 @@ namespace eos
             const double & a_1_perp, const double & a_2_perp,
             const double & a_1_para, const double & a_2_para)
     {
-        QCDFIntegrals<BToKstarDilepton> results;
-
-        // avoid NaN at u=1
-        static const double u_min = 0.0 + 1e-5;
-        static const double u_max = 1.0 - 1e-5;
-        // We use the same regularising cut-off x ~= Lambda / m_B as in j7_zero as to ensure
-        // a smooth transition B->K^*ll -> B->K^*gamma for s -> 0. (Lambda = 0.5 / GeV).
-        // The relative error for j7  in the QCDF region 1 <= q^2 <= 6 is less than 25%.
-        // Since j7 enters only via subleading terms, it amounts to a relative error of A_FB
-        // in the SM of < 0.3%.
-        static const double u_max_7 = 1.0 - 0.5 / m_B;
-
-        cubature::Config cub_conf = cubature::Config().epsrel(1e-3);
-
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, m_b, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2, s, _1, m_b, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, m_b, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, m_b, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, m_b, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate<1>(j_0_perp,    u_min, u_max, cub_conf);
-        results.j0bar_perp = integrate<1>(j_0bar_perp, u_min, u_max, cub_conf);
-        results.j1_perp    = integrate<1, 1, complex<double>>(j_1_perp,    u_min, u_max, cub_conf);
-        results.j2_perp    = integrate<1, 1, complex<double>>(j_2_perp,    u_min, u_max, cub_conf);
-        results.j4_perp    = integrate<1, 1, complex<double>>(j_4_perp,    u_min, u_max, cub_conf);
-        results.j5_perp    = integrate<1, 1, complex<double>>(j_5_perp,    u_min, u_max, cub_conf);
-        results.j6_perp    = integrate<1, 1, complex<double>>(j_6_perp,    u_min, u_max, cub_conf);
-        results.j7_perp    = integrate<1>(j_7_perp,    u_min, u_max_7, cub_conf);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, m_b, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3, s, _1, m_b, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, m_b, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate<1>(j_0_para, u_min, u_max, cub_conf);
-        results.j1_parallel = integrate<1, 1, complex<double>>(j_1_para, u_min, u_max, cub_conf);
-        results.j3_parallel = integrate<1, 1, complex<double>>(j_3_para, u_min, u_max, cub_conf);
-        results.j4_parallel = integrate<1, 1, complex<double>>(j_4_para, u_min, u_max, cub_conf);
-
-        // composite results
-        const double sh = s / m_B / m_B;
-        const double eh = (1.0 + power_of<2>(m_V / m_B) - sh) / 2.0;
-        results.jtilde1_perp = 2.0 / eh * results.j1_perp + sh * results.j2_perp / (eh * eh);
-        results.jtilde2_parallel = 2.0 / eh * results.j1_parallel + results.j3_parallel / (eh * eh);
-
-        return results;
+        return impl::dilepton_integrals(s, m_b, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_para, a_2_para);
     }
 }
@@ -52,16 +52,15 @@ namespace eos
     class OmnesInterpolation
     {
         private:
-        const CSplineInterpolation real;
-        const CSplineInterpolation imag;
+        const ComplexCSplineInterpolation interpolation;
 
         public:
         OmnesInterpolation(std::vector<double> x, std::vector<double> y_real, std::vector<double> y_imag):
-            real(x, y_real), imag(x, y_imag)
+            interpolation(x, y_real, y_imag)
         {}
         ~OmnesInterpolation() = default;
 
-        complex<double> operator()(const double & s) const { return complex<double>(real(s), imag(s)); };
+        complex<double> operator()(const double & s) const { return interpolation(s); };
     };
 
     class HKVT2025ScatteringAmplitudes :
@@ -0,0 +1,586 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/event-generator.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+namespace eos
+{
+    EventGenerator::Config::Config() :
+        _bins(50),
+        _adaptation_steps(5),
+        _adaptation_samples(20000),
+        _envelope_samples(100000),
+        _safety_factor(1.2),
+        _seed(1701)
+    {
+    }
+
+    unsigned
+    EventGenerator::Config::bins() const
+    {
+        return _bins;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::bins(const unsigned & x)
+    {
+        if (0 == x)
+        {
+            throw InternalError("EventGenerator::Config: at least one bin is required");
+        }
+
+        _bins = x;
+
+        return *this;
+    }
+
+    unsigned
+    EventGenerator::Config::adaptation_steps() const
+    {
+        return _adaptation_steps;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::adaptation_steps(const unsigned & x)
+    {
+        _adaptation_steps = x;
+
+        return *this;
+    }
+
+    unsigned
+    EventGenerator::Config::adaptation_samples() const
+    {
+        return _adaptation_samples;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::adaptation_samples(const unsigned & x)
+    {
+        _adaptation_samples = x;
+
+        return *this;
+    }
+
+    unsigned
+    EventGenerator::Config::envelope_samples() const
+    {
+        return _envelope_samples;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::envelope_samples(const unsigned & x)
+    {
+        if (0 == x)
+        {
+            throw InternalError("EventGenerator::Config: at least one sample is required to determine the envelope");
+        }
+
+        _envelope_samples = x;
+
+        return *this;
+    }
+
+    double
+    EventGenerator::Config::safety_factor() const
+    {
+        return _safety_factor;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::safety_factor(const double & x)
+    {
+        if (! (x >= 1.0))
+        {
+            throw InternalError("EventGenerator::Config: the safety factor must not be smaller than 1");
+        }
+
+        _safety_factor = x;
+
+        return *this;
+    }
+
+    unsigned long
+    EventGenerator::Config::seed() const
+    {
+        return _seed;
+    }
+
+    EventGenerator::Config &
+    EventGenerator::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+
+        return *this;
+    }
+
+    namespace
+    {
+        // derive a seed from a base seed and an index (splitmix64)
+        unsigned long
+        derive_seed(const unsigned long & seed, const unsigned long & index)
+        {
+            std::uint64_t z = static_cast<std::uint64_t>(seed) + (static_cast<std::uint64_t>(index) + 1u) * 0x9e3779b97f4a7c15ull;
+            z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+
+            return static_cast<unsigned long>(z ^ (z >> 31));
+        }
+    } // namespace
+
+    template <> struct Implementation<EventGenerator>
+    {
+            static constexpr unsigned long points_per_chunk = 1024;
+
+            // The state of one thread, operating on its own clone of the PDF
+            struct Worker
+            {
+                    SignalPDFPtr pdf;
+
+                    std::vector<MutablePtr> variables;
+
+                    gsl_rng * rng;
+
+                    // the current proposal point and the bins that contain it
+                    std::vector<double>   point;
+                    std::vector<unsigned> bin;
+
+                    // results of the current chunk
+                    std::vector<double> events;
+                    std::vector<double> squared_weights;
+                    double              max_weight, sum_weights;
+                    unsigned long       proposals, excess;
+
+                    Worker(const SignalPDF & pdf, const unsigned & dim, const unsigned & bins) :
+                        pdf(std::dynamic_pointer_cast<SignalPDF>(pdf.clone())),
+                        rng(gsl_rng_alloc(gsl_rng_mt19937)),
+                        point(dim),
+                        bin(dim),
+                        squared_weights(dim * bins)
+                    {
+                        for (const auto & d : *this->pdf)
+                        {
+                            variables.push_back(d.parameter);
+                        }
+                    }
+
+                    ~Worker()
+                    {
+                        gsl_rng_free(rng);
+                    }
+
+                    void
+                    reset()
+                    {
+                        events.clear();
+                        std::fill(squared_weights.begin(), squared_weights.end(), 0.0);
+                        max_weight  = 0.0;
+                        sum_weights = 0.0;
+                        proposals   = 0;
+                        excess      = 0;
+                    }
+            };
+
+            EventGenerator::Config config;
+
+            std::vector<std::string> names;
+
+            unsigned dim, bins;
+
+            // the edges of the grid, with bins + 1 edges per variable
+            std::vector<double> edges;
+
+            std::vector<std::unique_ptr<Worker>> workers;
+
+            double envelope, efficiency;
+
+            // index of the next stream of random numbers
+            unsigned long stream;
+
+            Implementation(const SignalPDF & pdf, const EventGenerator::Config & config) :
+                config(config),
+                dim(0),
+                bins(config.bins()),
+                envelope(0.0),
+                efficiency(0.0),
+                stream(0)
+            {
+                for (const auto & d : pdf)
+                {
+                    if (! (std::isfinite(d.min) && std::isfinite(d.max) && (d.min < d.max)))
+                    {
+                        throw InternalError("EventGenerator: the sampling variable '" + d.parameter->name() + "' of the PDF '" + pdf.name().full()
+                                            + "' requires finite bounds with min < max, got [" + stringify(d.min) + ", " + stringify(d.max) + "]");
+                    }
+
+                    names.push_back(d.parameter->name());
+
+                    for (unsigned j = 0; j <= bins; ++j)
+                    {
+                        edges.push_back(d.min + (d.max - d.min) * j / bins);
+                    }
+                }
+
+                dim = names.size();
+                if (0 == dim)
+                {
+                    throw InternalError("EventGenerator: the PDF '" + pdf.name().full() + "' does not describe any sampling variable");
+                }
+
+                // clone the PDF for each thread in the calling thread
+                const unsigned threads = std::max(1u, ThreadPool::instance()->number_of_threads());
+                for (unsigned t = 0; t < threads; ++t)
+                {
+                    workers.push_back(std::make_unique<Worker>(pdf, dim, bins));
+                }
+
+                for (unsigned s = 0; s < config.adaptation_steps(); ++s)
+                {
+                    adapt();
+                }
+
+                determine_envelope();
+            }
+
+            // draw a point from the proposal density; returns its weight f / q
+            double
+            propose(Worker & w) const
+            {
+                double jacobian = 1.0;
+                for (unsigned d = 0; d < dim; ++d)
+                {
+                    const double   u = gsl_rng_uniform(w.rng) * bins;
+                    const unsigned j = std::min(static_cast<unsigned>(u), bins - 1);
+                    const double * e = edges.data() + d * (bins + 1);
+
+                    w.bin[d]    = j;
+                    w.point[d]  = e[j] + (u - j) * (e[j + 1] - e[j]);
+                    jacobian   *= bins * (e[j + 1] - e[j]);
+
+                    w.variables[d]->set(w.point[d]);
+                }
+
+                return w.pdf->evaluate_linear() * jacobian;
+            }
+
+            // Run work on all chunks, one chunk per thread at a time. After each wave, finish
+            // is called for each chunk of the wave in order, in the calling thread.
+            void
+            for_each_chunk(const unsigned long & chunks, const std::function<void(const unsigned long &, Worker &)> & work,
+                           const std::function<void(const unsigned long &, Worker &)> & finish)
+            {
+                const unsigned                  wave        = workers.size();
+                const unsigned long             stream_seed = derive_seed(config.seed(), stream++);
+                std::vector<std::exception_ptr> errors(wave);
+
+                for (unsigned long first_chunk = 0; first_chunk < chunks; first_chunk += wave)
+                {
+                    const unsigned n = static_cast<unsigned>(std::min<unsigned long>(wave, chunks - first_chunk));
+
+                    ThreadPool::instance()
+                            ->enqueue_range(n,
+                                            [&](const unsigned & w)
+                                            {
+                                                try
+                                                {
+                                                    gsl_rng_set(workers[w]->rng, derive_seed(stream_seed, first_chunk + w));
+                                                    workers[w]->reset();
+                                                    work(first_chunk + w, *workers[w]);
+                                                }
+                                                catch (...)
+                                                {
+                                                    errors[w] = std::current_exception();
+                                                }
+                                            })
+                            .wait();
+
+                    for (unsigned w = 0; w < n; ++w)
+                    {
+                        if (errors[w])
+                        {
+                            std::rethrow_exception(errors[w]);
+                        }
+                    }
+
+                    for (unsigned w = 0; w < n; ++w)
+                    {
+                        finish(first_chunk + w, *workers[w]);
+                    }
+                }
+            }
+
+            // refine the grid such that each bin carries a similar share of the squared weights
+            void
+            adapt()
+            {
+                static constexpr double alpha = 1.5;
+
+                const unsigned long samples = config.adaptation_samples();
+                const unsigned long chunks  = (samples + points_per_chunk - 1) / points_per_chunk;
+
+                std::vector<double> squared_weights(dim * bins, 0.0);
+
+                for_each_chunk(
+                        chunks,
+                        [&](const unsigned long & chunk, Worker & w)
+                        {
+                            const unsigned long count = std::min(points_per_chunk, samples - chunk * points_per_chunk);
+                            for (unsigned long i = 0; i < count; ++i)
+                            {
+                                const double weight = propose(w);
+                                for (unsigned d = 0; d < dim; ++d)
+                                {
+                                    w.squared_weights[d * bins + w.bin[d]] += weight * weight;
+                                }
+                            }
+                        },
+                        [&](const unsigned long &, Worker & w)
+                        {
+                            for (unsigned k = 0; k < dim * bins; ++k)
+                            {
+                                squared_weights[k] += w.squared_weights[k];
+                            }
+                        });
+
+                std::vector<double> smoothed(bins), importance(bins), new_edges(bins + 1);
+                for (unsigned d = 0; d < dim; ++d)
+                {
+                    const double * s = squared_weights.data() + d * bins;
+                    double *       e = edges.data() + d * (bins + 1);
+
+                    if (bins < 2)
+                    {
+                        continue;
+                    }
+
+                    // average over neighbouring bins to dampen fluctuations
+                    smoothed[0]        = (s[0] + s[1]) / 2.0;
+                    smoothed[bins - 1] = (s[bins - 2] + s[bins - 1]) / 2.0;
+                    for (unsigned j = 1; j < bins - 1; ++j)
+                    {
+                        smoothed[j] = (s[j - 1] + s[j] + s[j + 1]) / 3.0;
+                    }
+
+                    const double sum = std::accumulate(smoothed.cbegin(), smoothed.cend(), 0.0);
+                    if (! (sum > 0.0))
+                    {
+                        continue;
+                    }
+
+                    // compress the importance of each bin to avoid rapid, destabilizing changes of the grid
+                    double total = 0.0;
+                    for (unsigned j = 0; j < bins; ++j)
+                    {
+                        const double r = smoothed[j] / sum;
+                        importance[j]  = (r <= 0.0) ? 0.0 : ((r >= 1.0) ? 1.0 : std::pow((1.0 - r) / std::log(1.0 / r), alpha));
+                        total         += importance[j];
+                    }
+
+                    // place the new edges such that each new bin receives the same importance
+                    const double per_bin     = total / bins;
+                    double       accumulated = 0.0;
+                    unsigned     j           = 0;
+
+                    new_edges[0]    = e[0];
+                    new_edges[bins] = e[bins];
+                    for (unsigned k = 1; k < bins; ++k)
+                    {
+                        const double target = k * per_bin;
+                        while ((j < bins - 1) && (accumulated + importance[j] < target))
+                        {
+                            accumulated += importance[j];
+                            ++j;
+                        }
+
+                        const double fraction = (importance[j] > 0.0) ? std::clamp((target - accumulated) / importance[j], 0.0, 1.0) : 1.0;
+                        new_edges[k]          = e[j] + fraction * (e[j + 1] - e[j]);
+                    }
+
+                    std::copy(new_edges.cbegin(), new_edges.cend(), e);
+                }
+            }
+
+            void
+            determine_envelope()
+            {
+                const unsigned long samples = config.envelope_samples();
+                const unsigned long chunks  = (samples + points_per_chunk - 1) / points_per_chunk;
+
+                double max_weight = 0.0, sum_weights = 0.0;
+
+                for_each_chunk(
+                        chunks,
+                        [&](const unsigned long & chunk, Worker & w)
+                        {
+                            const unsigned long count = std::min(points_per_chunk, samples - chunk * points_per_chunk);
+                            for (unsigned long i = 0; i < count; ++i)
+                            {
+                                const double weight = propose(w);
+
+                                w.max_weight   = std::max(w.max_weight, weight);
+                                w.sum_weights += weight;
+                            }
+                        },
+                        [&](const unsigned long &, Worker & w)
+                        {
+                            max_weight   = std::max(max_weight, w.max_weight);
+                            sum_weights += w.sum_weights;
+                        });
+
+                if (! (max_weight > 0.0))
+                {
+                    throw InternalError("EventGenerator: the PDF vanishes at all " + stringify(samples) + " proposal points");
+                }
+
+                envelope   = config.safety_factor() * max_weight;
+                efficiency = sum_weights / samples / envelope;
+
+                Log::instance()->message("EventGenerator", ll_informational) << "Expected fraction of accepted proposal points is " << efficiency;
+            }
+
+            void
+            generate(const unsigned long & events, const std::function<void(const unsigned long &, std::span<const double>)> & consumer)
+            {
+                const unsigned long chunks = (events + points_per_chunk - 1) / points_per_chunk;
+
+                unsigned long proposals = 0, excess = 0;
+
+                for_each_chunk(
+                        chunks,
+                        [&](const unsigned long & chunk, Worker & w)
+                        {
+                            const unsigned long count = std::min(points_per_chunk, events - chunk * points_per_chunk);
+                            w.events.reserve(count * dim);
+
+                            while (w.events.size() < count * dim)
+                            {
+                                const double weight = propose(w);
+
+                                w.proposals += 1;
+                                w.excess    += (weight > envelope) ? 1 : 0;
+
+                                if (gsl_rng_uniform(w.rng) * envelope < weight)
+                                {
+                                    w.events.insert(w.events.end(), w.point.cbegin(), w.point.cend());
+                                }
+                            }
+                        },
+                        [&](const unsigned long & chunk, Worker & w)
+                        {
+                            proposals += w.proposals;
+                            excess    += w.excess;
+
+                            consumer(chunk * points_per_chunk, std::span<const double>(w.events.data(), w.events.size()));
+                        });
+
+                Log::instance()->message("EventGenerator::generate", ll_informational)
+                        << "Accepted " << events << " out of " << proposals << " proposal points";
+
+                if (excess > 0)
+                {
+                    Log::instance()->message("EventGenerator::generate", ll_warning)
+                            << "The weights of " << excess << " proposal points exceeded the envelope; the events are biased in these regions. "
+                            << "Consider increasing the safety factor or the number of envelope samples";
+                }
+            }
+    };
+
+    EventGenerator::EventGenerator(const SignalPDF & pdf, const Config & config) :
+        PrivateImplementationPattern<EventGenerator>(new Implementation<EventGenerator>(pdf, config))
+    {
+    }
+
+    EventGenerator::~EventGenerator() = default;
+
+    const std::vector<std::string> &
+    EventGenerator::variables() const
+    {
+        return _imp->names;
+    }
+
+    double
+    EventGenerator::efficiency() const
+    {
+        return _imp->efficiency;
+    }
+
+    void
+    EventGenerator::generate(std::span<double> events)
+    {
+        if (0 != events.size() % _imp->dim)
+        {
+            throw InternalError("EventGenerator::generate: expected a buffer with " + stringify(_imp->dim) + " variables per event, got a buffer of size "
+                                + stringify(events.size()));
+        }
+
+        _imp->generate(events.size() / _imp->dim,
+                       [&](const unsigned long & first, std::span<const double> chunk) { std::copy(chunk.begin(), chunk.end(), events.begin() + first * _imp->dim); });
+    }
+
+    void
+    EventGenerator::write(const std::string & path, const unsigned long & events)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (! file)
+        {
+            throw InternalError("EventGenerator::write: cannot open file '" + path + "' for writing");
+        }
+
+        // header of the .npy format, version 1.0; the preamble and the header are padded to a multiple of 64 bytes
+        std::string header = std::string("{'descr': '") + ((std::endian::native == std::endian::little) ? "<f8" : ">f8")
+                             + "', 'fortran_order': False, 'shape': (" + stringify(events) + ", " + stringify(_imp->dim) + "), }";
+        const std::size_t preamble = 10;
+        header.append((64 - (preamble + header.size() + 1) % 64) % 64, ' ');
+        header += '\n';
+
+        const std::uint16_t header_size = header.size();
+        const char          version[2]  = { 1, 0 };
+        const char          length[2]   = { static_cast<char>(header_size & 0xff), static_cast<char>(header_size >> 8) };
+        file.write("\x93NUMPY", 6);
+        file.write(version, 2);
+        file.write(length, 2);
+        file.write(header.data(), header.size());
+
+        _imp->generate(events,
+                       [&](const unsigned long &, std::span<const double> chunk)
+                       { file.write(reinterpret_cast<const char *>(chunk.data()), chunk.size() * sizeof(double)); });
+
+        if (! file)
+        {
+            throw InternalError("EventGenerator::write: failed to write to file '" + path + "'");
+        }
+    }
+} // namespace eos
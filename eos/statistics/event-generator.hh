@@ -0,0 +1,132 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_EVENT_GENERATOR_HH
+#define EOS_GUARD_EOS_STATISTICS_EVENT_GENERATOR_HH 1
+
+#include <eos/signal-pdf.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Generates independent pseudo events from a SignalPDF by accept-reject sampling.
+     *
+     * The events are drawn within the bounds v_min and v_max of each of the PDF's sampling
+     * variables v, which must be declared in the PDF's kinematics. The proposal density is the
+     * product of one piecewise-constant density per variable, defined on an adaptive grid in the
+     * manner of VEGAS: in each adaptation step, the grid is refined such that every bin carries
+     * a similar share of the squared weights f / q. The envelope of the accept-reject step is the
+     * largest weight observed in a final set of proposal points, times a safety factor.
+     *
+     * The events are generated in chunks that run concurrently on the thread pool. Each thread
+     * evaluates its own clone of the PDF. Each chunk uses its own random number generator, seeded
+     * from Config::seed() and the index of the chunk, so that the events do not depend on the number
+     * of threads.
+     */
+    class EventGenerator :
+        public PrivateImplementationPattern<EventGenerator>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// Number of bins of the adaptive grid per variable
+                    unsigned bins() const;
+                    Config & bins(const unsigned & x);
+
+                    /// Number of adaptation steps of the grid
+                    unsigned adaptation_steps() const;
+                    Config & adaptation_steps(const unsigned & x);
+
+                    /// Number of proposal points per adaptation step
+                    unsigned adaptation_samples() const;
+                    Config & adaptation_samples(const unsigned & x);
+
+                    /// Number of proposal points used to determine the envelope
+                    unsigned envelope_samples() const;
+                    Config & envelope_samples(const unsigned & x);
+
+                    /// Factor by which the envelope exceeds the largest observed weight
+                    double   safety_factor() const;
+                    Config & safety_factor(const double & x);
+
+                    /// Seed from which the seeds of all chunks are derived
+                    unsigned long seed() const;
+                    Config &      seed(const unsigned long & x);
+
+                private:
+                    unsigned _bins, _adaptation_steps, _adaptation_samples, _envelope_samples;
+
+                    double _safety_factor;
+
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * Adapts the proposal density and determines the envelope.
+             *
+             * @param pdf    The signal PDF from which to generate events. Each thread evaluates its own clone.
+             * @param config The configuration of the generator.
+             */
+            EventGenerator(const SignalPDF & pdf, const Config & config);
+
+            /// Destructor.
+            ~EventGenerator();
+            ///@}
+
+            /// Retrieve the names of the sampling variables, in the order of the columns of the events.
+            const std::vector<std::string> & variables() const;
+
+            /// Retrieve the expected fraction of accepted proposal points.
+            double efficiency() const;
+
+            /*!
+             * Generate events.
+             *
+             * Successive calls draw different events.
+             *
+             * @param events The row-major buffer receiving the events, of size N x D for N events of D variables each.
+             */
+            void generate(std::span<double> events);
+
+            /*!
+             * Generate events and write them to a file in the NumPy .npy format.
+             *
+             * The file holds one row per event and one column per variable, and can be read with numpy.load.
+             * The events are written while they are generated, and need not fit into memory at once.
+             *
+             * @param path   The path of the file.
+             * @param events The number of events N.
+             */
+            void write(const std::string & path, const unsigned long & events);
+    };
+} // namespace eos
+
+#endif
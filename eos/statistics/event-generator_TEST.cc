@@ -0,0 +1,113 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/event-generator.hh>
+
+#include <test/test.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class EventGeneratorTest : public TestCase
+{
+    public:
+        EventGeneratorTest() :
+            TestCase("event_generator_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            // pdf(z) ~ z (4 - z) on [0, 4], i.e., a scaled Beta(2, 2) distribution with mean 2 and variance 4/5
+            Parameters p = Parameters::Defaults();
+            Kinematics k{ { "z", 2.0 }, { "z_min", 0.0 }, { "z_max", 4.0 } };
+            auto       pdf = SignalPDF::make("TestLegendre1D::P(z)", p, k, Options{});
+
+            const auto     config = EventGenerator::Config().bins(20).seed(1234);
+            EventGenerator generator(*pdf, config);
+            TEST_CHECK(generator.variables() == std::vector<std::string>{ "z" });
+            TEST_CHECK(generator.efficiency() > 0.5);
+            TEST_CHECK(generator.efficiency() <= 1.0);
+
+            const unsigned      N = 50000;
+            std::vector<double> events(N);
+            generator.generate(events);
+
+            TEST_CHECK(std::all_of(events.cbegin(), events.cend(), [](const double & z) { return (0.0 <= z) && (z <= 4.0); }));
+
+            double mean = 0.0, variance = 0.0;
+            for (const auto & z : events)
+            {
+                mean += z / N;
+            }
+            for (const auto & z : events)
+            {
+                variance += (z - mean) * (z - mean) / (N - 1);
+            }
+            TEST_CHECK_NEARLY_EQUAL(mean, 2.0, 0.02);
+            TEST_CHECK_NEARLY_EQUAL(variance, 0.8, 0.02);
+
+            // the events are reproducible, and successive calls draw different events
+            {
+                EventGenerator      other(*pdf, config);
+                std::vector<double> other_events(N), more_events(N);
+                other.generate(other_events);
+                other.generate(more_events);
+
+                TEST_CHECK(events == other_events);
+                TEST_CHECK(events != more_events);
+            }
+
+            // events written to a .npy file
+            {
+                const std::string path = "event-generator_TEST.npy";
+                EventGenerator(*pdf, config).write(path, N);
+
+                std::ifstream     file(path, std::ios::binary);
+                std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                std::remove(path.c_str());
+
+                TEST_CHECK(std::string(content.data(), 6) == "\x93NUMPY");
+
+                const std::size_t header_size = static_cast<unsigned char>(content[8]) + 256 * static_cast<unsigned char>(content[9]);
+                TEST_CHECK_EQUAL((10 + header_size) % 64, 0u);
+                TEST_CHECK_EQUAL(content.size(), 10 + header_size + N * sizeof(double));
+                TEST_CHECK(std::string(content.data() + 10, header_size).find("'shape': (50000, 1)") != std::string::npos);
+
+                std::vector<double> written(N);
+                std::copy(content.data() + 10 + header_size, content.data() + content.size(), reinterpret_cast<char *>(written.data()));
+                TEST_CHECK(written == events);
+            }
+
+            // the bounds of the sampling variables must describe a non-empty range
+            {
+                Kinematics k_empty{ { "z", 2.0 }, { "z_min", 2.0 }, { "z_max", 2.0 } };
+                auto       empty = SignalPDF::make("TestLegendre1D::P(z)", p, k_empty, Options{});
+                TEST_CHECK_THROWS(InternalError, EventGenerator(*empty, config));
+            }
+        }
+} event_generator_test;
@@ -18,6 +18,7 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/derivative.hh>
 #include <eos/maths/dft-plan-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/signal-pdf.hh>
@@ -25,7 +26,10 @@
 #include <eos/statistics/test-statistic-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
@@ -39,9 +43,13 @@
 #include <gsl/gsl_sf_result.h>
 #include <gsl/gsl_vector.h>
 
+#include <yaml-cpp/yaml.h>
+
 #include <algorithm>
 #include <cmath>
 #include <config.h>
+#include <cstdint>
+#include <exception>
 #include <format>
 #include <limits>
 #include <map>
@@ -142,6 +150,25 @@ namespace eos
                     return norm - power_of<2>(chi) / 2.0;
                 }
 
+                virtual bool
+                add_gradient(std::span<double> gradient) const
+                {
+                    const double value = cache[id];
+                    const double sigma = (value > mode) ? sigma_upper : sigma_lower;
+
+                    gradient[id.value()] -= (value - mode) / power_of<2>(sigma);
+
+                    return true;
+                }
+
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+                {
+                    ids.push_back(id);
+
+                    return true;
+                }
+
                 virtual unsigned
                 number_of_observations() const
                 {
@@ -335,6 +362,24 @@ namespace eos
                     return norm + alpha * value - std::exp(value);
                 }
 
+                virtual bool
+                add_gradient(std::span<double> gradient) const
+                {
+                    const double value = (cache[id] - nu) / lambda;
+
+                    gradient[id.value()] += (alpha - std::exp(value)) / lambda;
+
+                    return true;
+                }
+
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+                {
+                    ids.push_back(id);
+
+                    return true;
+                }
+
                 virtual unsigned
                 number_of_observations() const
                 {
@@ -591,6 +636,14 @@ namespace eos
                     return physical_limit + theta * std::pow(alpha - 1 / beta, 1 / beta);
                 }
 
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+                {
+                    ids.push_back(id);
+
+                    return true;
+                }
+
                 virtual unsigned
                 number_of_observations() const
                 {
@@ -799,6 +852,18 @@ namespace eos
                     return ret_val;
                 }
 
+                bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+                {
+                    bool result = true;
+                    for (const auto & component : components)
+                    {
+                        result = component->observable_ids(ids) && result;
+                    }
+
+                    return result;
+                }
+
                 unsigned
                 number_of_observations() const
                 {
@@ -833,8 +898,52 @@ namespace eos
                 }
         };
 
+        /*
+         * Triangular solves with the Cholesky factor L of a covariance matrix, stored as the packed
+         * rows of its lower triangle. For n_ > 0, the dimension is known at compile time and the loops
+         * can be unrolled; n_ = 0 selects the kernel for arbitrary dimensions.
+         */
+        template <unsigned n_> struct CholeskyKernels
+        {
+                // x <- inv(L) * x
+                static void
+                forward_substitution(const unsigned & n, const double * chol, const double * inverse_diagonal, double * x)
+                {
+                    const unsigned dim = (n_ > 0) ? n_ : n;
+
+                    for (unsigned i = 0, row = 0; i < dim; row += ++i)
+                    {
+                        double sum = x[i];
+                        for (unsigned j = 0; j < i; ++j)
+                        {
+                            sum -= chol[row + j] * x[j];
+                        }
+                        x[i] = sum * inverse_diagonal[i];
+                    }
+                }
+
+                // x <- inv(L^T) * x
+                static void
+                backward_substitution(const unsigned & n, const double * chol, const double * inverse_diagonal, double * x)
+                {
+                    const unsigned dim = (n_ > 0) ? n_ : n;
+
+                    for (unsigned i = dim; i-- > 0;)
+                    {
+                        double sum = x[i];
+                        for (unsigned j = i + 1, row = j * (j + 1) / 2; j < dim; row += ++j)
+                        {
+                            sum -= chol[row + i] * x[j];
+                        }
+                        x[i] = sum * inverse_diagonal[i];
+                    }
+                }
+        };
+
         struct MultivariateGaussianBlock : public LogLikelihoodBlock
         {
+                using Substitution = void (*)(const unsigned &, const double *, const double *, double *);
+
                 ObservableCache _cache;
 
                 std::vector<ObservableCache::ObservableId> _ids;
@@ -848,17 +957,19 @@ namespace eos
                 gsl_matrix * const _response;
                 const unsigned     _number_of_observations;
 
-                // the normalization constant of the density
-                const double _norm;
+                // whether the response matrix is the identity, which is the case for most constraints
+                bool _identity_response;
 
-                // cholesky matrix of covariance, and inverse of covariance
-                gsl_matrix * _chol;
-                gsl_matrix * _covariance_inv;
+                // lower triangle of the Cholesky matrix of the covariance, in packed rows, and the inverse of its diagonal
+                std::vector<double> _chol;
+                std::vector<double> _inverse_diagonal;
 
-                // temporary storage for evaluation
-                gsl_vector * _observables;
-                gsl_vector * _measurements;
-                gsl_vector * _measurements_2;
+                // the triangular solves, specialized for the dimension of the covariance
+                Substitution _forward_substitution;
+                Substitution _backward_substitution;
+
+                // the normalization constant of the density
+                double _norm;
 
                 MultivariateGaussianBlock(const ObservableCache & cache, const std::vector<ObservableCache::ObservableId> && ids, gsl_vector * mean, gsl_matrix * covariance,
                                           gsl_matrix * response, const unsigned & number_of_observations) :
@@ -870,12 +981,10 @@ namespace eos
                     _covariance(covariance),
                     _response(response),
                     _number_of_observations(number_of_observations),
-                    _norm(compute_norm()),
-                    _chol(gsl_matrix_alloc(covariance->size1, covariance->size2)),
-                    _covariance_inv(gsl_matrix_alloc(covariance->size1, covariance->size2)),
-                    _observables(gsl_vector_alloc(_dim_pred)),
-                    _measurements(gsl_vector_alloc(_dim_meas)),
-                    _measurements_2(gsl_vector_alloc(_dim_meas))
+                    _identity_response(false),
+                    _forward_substitution(&CholeskyKernels<0>::forward_substitution),
+                    _backward_substitution(&CholeskyKernels<0>::backward_substitution),
+                    _norm(0.0)
                 {
                     if (_covariance->size1 != _covariance->size2)
                     {
@@ -898,30 +1007,60 @@ namespace eos
                     }
 
                     // cholesky decomposition (informally: the sqrt of the covariance matrix)
-                    // the GSL matrix contains both the cholesky and its transpose, see GSL reference, ch. 14.5
                     cholesky();
-                    invert_covariance();
 
-                    // keep only the lower and diagonal parts, set upper parts to zero
-                    for (unsigned i = 0; i < _dim_meas; ++i)
+                    // -k/2 * log 2 Pi - 1/2 log(det(V)), with det(V) = prod_i L_ii^2
+                    _norm = -0.5 * _dim_meas * std::log(2 * M_PI);
+                    for (const auto & d : _inverse_diagonal)
+                    {
+                        _norm += std::log(d);
+                    }
+
+                    _identity_response = (_dim_pred == _dim_meas);
+                    for (unsigned i = 0; _identity_response && (i < _dim_meas); ++i)
                     {
-                        for (unsigned j = i + 1; j < _dim_meas; ++j)
+                        for (unsigned j = 0; j < _dim_pred; ++j)
                         {
-                            gsl_matrix_set(_chol, i, j, 0.0);
+                            if (gsl_matrix_get(_response, i, j) != ((i == j) ? 1.0 : 0.0))
+                            {
+                                _identity_response = false;
+                                break;
+                            }
                         }
                     }
+
+                    switch (_dim_meas)
+                    {
+                        case 1:
+                            _forward_substitution  = &CholeskyKernels<1>::forward_substitution;
+                            _backward_substitution = &CholeskyKernels<1>::backward_substitution;
+                            break;
+
+                        case 2:
+                            _forward_substitution  = &CholeskyKernels<2>::forward_substitution;
+                            _backward_substitution = &CholeskyKernels<2>::backward_substitution;
+                            break;
+
+                        case 3:
+                            _forward_substitution  = &CholeskyKernels<3>::forward_substitution;
+                            _backward_substitution = &CholeskyKernels<3>::backward_substitution;
+                            break;
+
+                        case 4:
+                            _forward_substitution  = &CholeskyKernels<4>::forward_substitution;
+                            _backward_substitution = &CholeskyKernels<4>::backward_substitution;
+                            break;
+
+                        default:
+                            break;
+                    }
                 }
 
                 virtual ~MultivariateGaussianBlock()
                 {
-                    gsl_matrix_free(_covariance_inv);
-                    gsl_matrix_free(_chol);
                     gsl_matrix_free(_covariance);
                     gsl_matrix_free(_response);
 
-                    gsl_vector_free(_measurements_2);
-                    gsl_vector_free(_measurements);
-                    gsl_vector_free(_observables);
                     gsl_vector_free(_mean);
                 }
 
@@ -930,6 +1069,12 @@ namespace eos
                 {
                     const auto k = _mean->size;
 
+                    // the inverse covariance is not needed for the evaluation, and only computed for display
+                    gsl_matrix * covariance_inv = gsl_matrix_alloc(k, k);
+                    gsl_matrix_memcpy(covariance_inv, _covariance);
+                    GSL_LINALG_CHOLESKY_DECOMP(covariance_inv);
+                    gsl_linalg_cholesky_invert(covariance_inv);
+
                     std::string result  = "Multivariate Gaussian: ";
                     result             += "means = ( ";
                     for (std::size_t i = 0; i < k; ++i)
@@ -952,12 +1097,14 @@ namespace eos
                         result += "( ";
                         for (std::size_t j = 0; j < k; ++j)
                         {
-                            result += stringify(gsl_matrix_get(_covariance_inv, i, j)) + " ";
+                            result += stringify(gsl_matrix_get(covariance_inv, i, j)) + " ";
                         }
                         result += ")";
                     }
                     result += " )";
 
+                    gsl_matrix_free(covariance_inv);
+
                     if (0 == _number_of_observations)
                     {
                         result += "; no observation";
@@ -971,25 +1118,40 @@ namespace eos
                 cholesky()
                 {
                     // copy covariance matrix
-                    gsl_matrix_memcpy(_chol, _covariance);
-                    if (GSL_SUCCESS != GSL_LINALG_CHOLESKY_DECOMP(_chol))
+                    gsl_matrix * chol = gsl_matrix_alloc(_dim_meas, _dim_meas);
+                    gsl_matrix_memcpy(chol, _covariance);
+                    if (GSL_SUCCESS != GSL_LINALG_CHOLESKY_DECOMP(chol))
                     {
+                        gsl_matrix_free(chol);
                         throw InternalError("MultivariateGaussianBlock: Cholesky decomposition failed");
                     }
+
+                    // keep only the lower and diagonal parts
+                    _chol.reserve(_dim_meas * (_dim_meas + 1) / 2);
+                    _inverse_diagonal.resize(_dim_meas);
+                    for (unsigned i = 0; i < _dim_meas; ++i)
+                    {
+                        for (unsigned j = 0; j <= i; ++j)
+                        {
+                            _chol.push_back(gsl_matrix_get(chol, i, j));
+                        }
+                        _inverse_diagonal[i] = 1.0 / gsl_matrix_get(chol, i, i);
+                    }
+
+                    gsl_matrix_free(chol);
                 }
 
-                // invert covariance matrix based on previously obtained Cholesky decomposition
-                void
-                invert_covariance()
+                // thread-local scratch space, such that a block can be evaluated concurrently
+                static double *
+                workspace(const std::size_t & size)
                 {
-                    // copy cholesky matrix
-                    gsl_matrix_memcpy(_covariance_inv, _chol);
-
-                    // compute inverse matrix from cholesky
-                    if (GSL_SUCCESS != gsl_linalg_cholesky_invert(_covariance_inv))
+                    thread_local std::vector<double> buffer;
+                    if (buffer.size() < size)
                     {
-                        throw InternalError("MultivariateGaussianBlock: Cholesky inversion failed");
+                        buffer.resize(size);
                     }
+
+                    return buffer.data();
                 }
 
                 virtual LogLikelihoodBlockPtr
@@ -1018,52 +1180,49 @@ namespace eos
                     return LogLikelihoodBlockPtr(new MultivariateGaussianBlock(cache, std::move(ids), mean, covariance, response, _number_of_observations));
                 }
 
-                // compute the normalization constant on log scale
-                // -k/2 * log 2 Pi - 1/2 log(abs(det(V^{-1})))
-                double
-                compute_norm()
+                // compute the whitened residuals z = inv(L) * (R * observables - mean), with chi^2 = z^T z
+                void
+                whitened_residuals(double * z) const
                 {
-                    // copy covariance matrix
-                    gsl_matrix * M = gsl_matrix_alloc(_dim_meas, _dim_meas);
-                    gsl_matrix_memcpy(M, _covariance);
-
-                    // find LU decomposition
-                    int               signum = 0;
-                    gsl_permutation * p      = gsl_permutation_alloc(_dim_meas);
-                    gsl_linalg_LU_decomp(M, p, &signum);
-
-                    // calculate determinant
-                    const double log_det = gsl_linalg_LU_lndet(M);
+                    if (_identity_response)
+                    {
+                        for (auto i = 0u; i < _dim_meas; ++i)
+                        {
+                            z[i] = _cache[_ids[i]] - gsl_vector_get(_mean, i);
+                        }
+                    }
+                    else
+                    {
+                        for (auto i = 0u; i < _dim_meas; ++i)
+                        {
+                            z[i] = -gsl_vector_get(_mean, i);
+                        }
 
-                    gsl_permutation_free(p);
-                    gsl_matrix_free(M);
+                        for (auto j = 0u; j < _dim_pred; ++j)
+                        {
+                            const double o = _cache[_ids[j]];
+                            for (auto i = 0u; i < _dim_meas; ++i)
+                            {
+                                z[i] += gsl_matrix_get(_response, i, j) * o;
+                            }
+                        }
+                    }
 
-                    return -0.5 * _dim_meas * std::log(2 * M_PI) - 0.5 * log_det;
+                    _forward_substitution(_dim_meas, _chol.data(), _inverse_diagonal.data(), z);
                 }
 
                 double
                 chi_square() const
                 {
-                    // read observable values from cache, and subtract mean
-                    for (auto i = 0u; i < _dim_pred; ++i)
+                    double * z = workspace(_dim_meas);
+                    whitened_residuals(z);
+
+                    double result = 0.0;
+                    for (auto i = 0u; i < _dim_meas; ++i)
                     {
-                        gsl_vector_set(_observables, i, _cache[_ids[i]]);
+                        result += z[i] * z[i];
                     }
 
-                    // prepare for centering
-                    //   measurements <- mean
-                    gsl_vector_memcpy(_measurements, _mean);
-
-                    // apply response matrix and center the gaussian:
-                    //   measurements <- R * observables - measurements
-                    gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, -1.0, _measurements);
-
-                    // observables <- inv(covariance) * measurements
-                    gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements, 0.0, _measurements_2);
-
-                    double result;
-                    gsl_blas_ddot(_measurements, _measurements_2, &result);
-
                     return result;
                 }
 
@@ -1073,6 +1232,44 @@ namespace eos
                     return _norm - 0.5 * chi_square();
                 }
 
+                virtual bool
+                add_gradient(std::span<double> gradient) const
+                {
+                    // w <- inv(covariance) * (R * observables - mean) = inv(L^T) * z
+                    double * w = workspace(_dim_meas);
+                    whitened_residuals(w);
+                    _backward_substitution(_dim_meas, _chol.data(), _inverse_diagonal.data(), w);
+
+                    // gradient <- -R^T * w
+                    for (auto j = 0u; j < _dim_pred; ++j)
+                    {
+                        double sum = 0.0;
+                        if (_identity_response)
+                        {
+                            sum = w[j];
+                        }
+                        else
+                        {
+                            for (auto i = 0u; i < _dim_meas; ++i)
+                            {
+                                sum += gsl_matrix_get(_response, i, j) * w[i];
+                            }
+                        }
+
+                        gradient[_ids[j].value()] -= sum;
+                    }
+
+                    return true;
+                }
+
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+                {
+                    ids.insert(ids.end(), _ids.cbegin(), _ids.cend());
+
+                    return true;
+                }
+
                 virtual unsigned
                 number_of_observations() const
                 {
@@ -1082,26 +1279,16 @@ namespace eos
                 virtual double
                 sample(gsl_rng * rng) const
                 {
-                    // generate standard normals in observables
+                    // To be consistent with the univariate Gaussian, we would center observables around theory,
+                    // then compare to theory. Hence we can forget about theory, and stay centered on zero.
+                    // For x = L * z with standard normal z, the chi^2 reads x^T inv(covariance) x = z^T z.
+                    double chi_squared = 0.0;
                     for (auto i = 0u; i < _dim_meas; ++i)
                     {
-                        gsl_vector_set(_measurements, i, gsl_ran_ugaussian(rng));
+                        chi_squared += power_of<2>(gsl_ran_ugaussian(rng));
                     }
 
-                    // transform: observables2 <- _chol * observables
-                    gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements, 0.0, _measurements_2);
-
-                    // To be consistent with the univariate Gaussian, we would center observables around theory,
-                    // then compare to theory. Hence we can forget about theory, and stay centered on zero.
-                    // transform: observables <- inv(covariance) * observables2
-                    gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements_2, 0.0, _measurements);
-
-                    double result;
-                    gsl_blas_ddot(_measurements, _measurements_2, &result);
-                    result *= -0.5;
-                    result += _norm;
-
-                    return result;
+                    return _norm - 0.5 * chi_squared;
                 }
 
                 virtual double
@@ -1188,6 +1375,14 @@ namespace eos
                     }
                 }
 
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & result) const
+                {
+                    result.insert(result.end(), ids.cbegin(), ids.cend());
+
+                    return true;
+                }
+
                 virtual unsigned
                 number_of_observations() const
                 {
@@ -1292,6 +1487,9 @@ namespace eos
 
                 unsigned _number_of_observations;
 
+                // serialises the use of the DFT plans
+                mutable Mutex mutex;
+
                 Unbinned1DLikelihoodBlock(const ObservableCache & cache, const QualifiedName & pdf_name, const std::vector<Kinematics> & kinematics, const Options & options,
                                           const std::vector<double> & resolution, const std::vector<Kinematics> & observations, const std::array<std::size_t, rank_> & dimensions) :
                     cache(cache),
@@ -1421,8 +1619,10 @@ namespace eos
                     return std::format("Unbinned<{}>: {} events on a grid of {} points", rank_, observations_data.size(), signal_pdfs.size());
                 }
 
-                virtual double
-                evaluate() const
+                // Convolve the signal PDF with the resolution function, and return the result sampled on the grid.
+                // The result is N times the convolved PDF, since the DFT is unnormalised.
+                const double *
+                convolve() const
                 {
                     // Evaluate all signal PDFs on the linear scale and fill the time-domain container. The convolution
                     // with the resolution function operates on the linear density; non-positive values are clamped to
@@ -1453,39 +1653,49 @@ namespace eos
                     backward_plan.frequency_domain_container() *= resolution_dft;
 
                     // Backward DFT.  The DFT is unnormalised, so the result is N times the
-                    // circular convolution; we divide by N below.
+                    // circular convolution; we divide by N in log_likelihood().
                     backward_plan.transform();
 
-                    const double   norm   = 1.0 / static_cast<double>(signal_pdfs.size());
-                    const double * result = backward_plan.time_domain_container().data();
+                    return backward_plan.time_domain_container().data();
+                }
 
-                    // The backward DFT yields the resolution-convolved PDF sampled on the grid points. The likelihood,
-                    // however, is a product over the *observed* events, so we evaluate the convolved PDF at each
-                    // observation by multilinear interpolation from the surrounding grid points.
-                    double log_likelihood = 0.0;
-                    for (const auto & w : interpolation)
+                // Evaluate the convolved PDF at a point by multilinear interpolation from the surrounding grid points.
+                double
+                interpolate(const double * grid, const InterpolationWeights & w) const
+                {
+                    double value = 0.0;
+                    for (std::size_t corner = 0; corner < (std::size_t(1) << rank_); ++corner)
                     {
-                        double value = 0.0;
-                        for (std::size_t corner = 0; corner < (std::size_t(1) << rank_); ++corner)
+                        double      weight = 1.0;
+                        std::size_t offset = 0;
+                        for (std::size_t d = 0; d < rank_; ++d)
                         {
-                            double      weight = 1.0;
-                            std::size_t offset = 0;
-                            for (std::size_t d = 0; d < rank_; ++d)
-                            {
-                                const bool upper  = (corner >> d) & 1u;
-                                weight           *= upper ? w.fraction[d] : (1.0 - w.fraction[d]);
-                                offset           += upper ? strides[d] : 0;
-                            }
-                            value += weight * result[w.base + offset];
+                            const bool upper  = (corner >> d) & 1u;
+                            weight           *= upper ? w.fraction[d] : (1.0 - w.fraction[d]);
+                            offset           += upper ? strides[d] : 0;
                         }
+                        value += weight * grid[w.base + offset];
+                    }
 
+                    return value;
+                }
+
+                // Compute the log-likelihood of a set of events, given the convolved PDF on the grid.
+                double
+                log_likelihood(const double * grid, const std::vector<InterpolationWeights> & events) const
+                {
+                    const double norm = 1.0 / static_cast<double>(signal_pdfs.size());
+
+                    double result = 0.0;
+                    for (const auto & w : events)
+                    {
                         // Treat a non-positive interpolated density (from numerical roundoff, or a resolution kernel
                         // with negative lobes) as a zero-probability event, yielding -infinity rather than a NaN from
                         // std::log() that would silently poison downstream minimization/sampling.
-                        const double density = value * norm;
+                        const double density = interpolate(grid, w) * norm;
                         if (density > 0.0) [[likely]]
                         {
-                            log_likelihood += std::log(density);
+                            result += std::log(density);
                         }
                         else
                         {
@@ -1493,7 +1703,19 @@ namespace eos
                         }
                     }
 
-                    return log_likelihood;
+                    return result;
+                }
+
+                virtual double
+                evaluate() const
+                {
+                    // The DFT plans are shared, so that the convolution must not run concurrently.
+                    Lock l(mutex);
+
+                    // The backward DFT yields the resolution-convolved PDF sampled on the grid points. The likelihood,
+                    // however, is a product over the *observed* events, so we evaluate the convolved PDF at each
+                    // observation by multilinear interpolation from the surrounding grid points.
+                    return log_likelihood(convolve(), interpolation);
                 }
 
                 virtual unsigned
@@ -1503,9 +1725,95 @@ namespace eos
                 }
 
                 virtual double
-                sample(gsl_rng * /* rng */) const
+                sample(gsl_rng * rng) const
+                {
+                    double result;
+                    sample_batch(rng, std::span<double>(&result, 1));
+
+                    return result;
+                }
+
+                /*
+                 * Each pseudo experiment comprises as many events as were observed. The events are drawn from the
+                 * convolved PDF: first, a grid cell is chosen with a probability proportional to the mean of the
+                 * density at its corners, i.e., its integral; then, a point within the cell is chosen by rejection
+                 * sampling from the multilinear interpolation.
+                 */
+                virtual void
+                sample_batch(gsl_rng * rng, std::span<double> results) const
                 {
-                    throw InternalError("Unbinned1DLikelihoodBlock::sample() is not implemented");
+                    std::vector<double> grid;
+                    {
+                        Lock l(mutex);
+
+                        const double * result = convolve();
+                        grid.assign(result, result + signal_pdfs.size());
+                    }
+
+                    // collect the cells, their cumulative probabilities, and the maximal density in each cell
+                    std::vector<std::size_t> cells;
+                    std::vector<double>      cumulative, maxima;
+                    double                   total = 0.0;
+                    for (std::size_t i = 0; i < grid.size(); ++i)
+                    {
+                        // the grid point must be the lower corner of a cell
+                        bool lower_corner = true;
+                        for (std::size_t d = 0; d < rank_; ++d)
+                        {
+                            lower_corner &= ((i / strides[d]) % dimensions[d]) + 1 < dimensions[d];
+                        }
+
+                        if (! lower_corner)
+                        {
+                            continue;
+                        }
+
+                        double sum = 0.0, maximum = 0.0;
+                        for (std::size_t corner = 0; corner < (std::size_t(1) << rank_); ++corner)
+                        {
+                            std::size_t offset = 0;
+                            for (std::size_t d = 0; d < rank_; ++d)
+                            {
+                                offset += ((corner >> d) & 1u) ? strides[d] : 0;
+                            }
+
+                            const double value  = std::max(grid[i + offset], 0.0);
+                            sum                += value;
+                            maximum             = std::max(maximum, value);
+                        }
+
+                        total += sum;
+                        cells.push_back(i);
+                        cumulative.push_back(total);
+                        maxima.push_back(maximum);
+                    }
+
+                    if (! (total > 0.0))
+                    {
+                        throw InternalError("Unbinned1DLikelihoodBlock::sample: the convolved PDF vanishes on the entire grid");
+                    }
+
+                    std::vector<InterpolationWeights> events(observations_data.size());
+                    for (auto & result : results)
+                    {
+                        for (auto & w : events)
+                        {
+                            const auto        cell = std::upper_bound(cumulative.begin(), cumulative.end(), gsl_rng_uniform(rng) * total) - cumulative.begin();
+                            const std::size_t c    = std::min<std::size_t>(cell, cells.size() - 1);
+
+                            w.base = cells[c];
+                            do
+                            {
+                                for (std::size_t d = 0; d < rank_; ++d)
+                                {
+                                    w.fraction[d] = gsl_rng_uniform(rng);
+                                }
+                            }
+                            while (gsl_rng_uniform(rng) * maxima[c] > interpolate(grid.data(), w));
+                        }
+
+                        result = log_likelihood(grid.data(), events);
+                    }
                 }
 
                 virtual double
@@ -1526,46 +1834,775 @@ namespace eos
                     return LogLikelihoodBlockPtr(new Unbinned1DLikelihoodBlock<rank_>(cache, pdf_name, kinematics_data, options, resolution_data, observations_data, dimensions));
                 }
         };
-    } // namespace implementation
-
-    LogLikelihoodBlock::~LogLikelihoodBlock() {}
 
-    LogLikelihoodBlockPtr
-    LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable, const double & min, const double & central, const double & max,
-                                 const unsigned & number_of_observations)
-    {
-        // check input
-        if (min >= central)
+        // Binned likelihood for a set of Poisson-distributed event counts, following the HistFactory model as implemented by pyhf.
+        struct BinnedPoissonBlock : public LogLikelihoodBlock
         {
-            throw InternalError("LogLikelihoodBlock::Gaussian: min value >= central value");
-        }
+                // A multiplicative normalisation modifier, interpolated between its variations at -1 and +1 (pyhf's interpolation code 4).
+                struct NormSys
+                {
+                        std::size_t parameter;
 
-        if (max <= central)
-        {
-            throw InternalError("LogLikelihoodBlock::Gaussian: max value <= central value");
-        }
+                        double hi, lo;
 
-        auto id = cache.add(observable);
+                        // coefficients of the polynomial in the interior |alpha| < 1, starting at the linear term
+                        std::array<double, 6> coefficients;
 
-        return LogLikelihoodBlockPtr(new implementation::GaussianBlock(cache, id, min, central, max, number_of_observations));
-    }
+                        NormSys(const std::size_t & parameter, const double & hi, const double & lo) :
+                            parameter(parameter),
+                            hi(hi),
+                            lo(lo)
+                        {
+                            if ((hi <= 0.0) || (lo <= 0.0))
+                            {
+                                throw InternalError("LogLikelihoodBlock::BinnedPoisson: normsys variations must be positive");
+                            }
 
-    LogLikelihoodBlockPtr
-    LogLikelihoodBlock::LogGamma(ObservableCache cache, const ObservablePtr & observable, const double & min, const double & central, const double & max, const double & alpha,
-                                 const double & lambda, const unsigned & number_of_observations)
-    {
-        // check input
-        if (min >= central)
-        {
-            throw InternalError("LogLikelihoodBlock::LogGamma: min value >= central value");
-        }
+                            // match the polynomial to the exponential extrapolation in value, first and second derivative at alpha = -1, +1
+                            static const double a_inverse[6][6] = {
+                                {   15.0 / 16.0, -15.0 / 16.0, -7.0 / 16.0, -7.0 / 16.0,  1.0 / 16.0, -1.0 / 16.0 },
+                                {    3.0 /  2.0,   3.0 /  2.0, -9.0 / 16.0,  9.0 / 16.0,  1.0 / 16.0,  1.0 / 16.0 },
+                                {   -5.0 /  8.0,   5.0 /  8.0,  5.0 /  8.0,  5.0 /  8.0, -1.0 /  8.0,  1.0 /  8.0 },
+                                {   -3.0 /  2.0,  -3.0 /  2.0,  7.0 /  8.0, -7.0 /  8.0, -1.0 /  8.0, -1.0 /  8.0 },
+                                {    3.0 / 16.0,  -3.0 / 16.0, -3.0 / 16.0, -3.0 / 16.0,  1.0 / 16.0, -1.0 / 16.0 },
+                                {    1.0 /  2.0,   1.0 /  2.0, -5.0 / 16.0,  5.0 / 16.0,  1.0 / 16.0,  1.0 / 16.0 }
+                            };
 
-        if (max <= central)
-        {
-            throw InternalError("LogLikelihoodBlock::LogGamma: max value <= central value");
-        }
+                            const double log_hi = std::log(hi), log_lo = std::log(lo);
+                            const double b[6]   = { hi - 1.0, lo - 1.0, hi * log_hi, -lo * log_lo, hi * log_hi * log_hi, lo * log_lo * log_lo };
 
-        if (alpha <= 0)
+                            for (unsigned i = 0; i < 6; ++i)
+                            {
+                                coefficients[i] = 0.0;
+                                for (unsigned j = 0; j < 6; ++j)
+                                {
+                                    coefficients[i] += a_inverse[i][j] * b[j];
+                                }
+                            }
+                        }
+
+                        inline double
+                        operator() (const double & alpha) const
+                        {
+                            if (alpha >= 1.0)
+                            {
+                                return std::pow(hi, alpha);
+                            }
+
+                            if (alpha <= -1.0)
+                            {
+                                return std::pow(lo, -alpha);
+                            }
+
+                            double result = 0.0;
+                            for (int i = 5; i >= 0; --i)
+                            {
+                                result = alpha * (coefficients[i] + result);
+                            }
+
+                            return 1.0 + result;
+                        }
+                };
+
+                // An additive shape modifier, interpolated between its variations at -1 and +1 (pyhf's interpolation code 4p).
+                struct HistoSys
+                {
+                        std::size_t parameter;
+
+                        std::vector<double> delta_up, delta_down, s, a;
+
+                        HistoSys(const std::size_t & parameter, const std::vector<double> & nominal, const std::vector<double> & hi, const std::vector<double> & lo) :
+                            parameter(parameter),
+                            delta_up(nominal.size()),
+                            delta_down(nominal.size()),
+                            s(nominal.size()),
+                            a(nominal.size())
+                        {
+                            for (std::size_t b = 0; b < nominal.size(); ++b)
+                            {
+                                delta_up[b]   = hi[b] - nominal[b];
+                                delta_down[b] = nominal[b] - lo[b];
+                                s[b]          = 0.5 * (delta_up[b] + delta_down[b]);
+                                a[b]          = 0.0625 * (delta_up[b] - delta_down[b]);
+                            }
+                        }
+
+                        inline void
+                        add(const double & alpha, double * rates) const
+                        {
+                            const std::size_t bins = s.size();
+
+                            if (alpha > 1.0)
+                            {
+                                for (std::size_t b = 0; b < bins; ++b)
+                                {
+                                    rates[b] += alpha * delta_up[b];
+                                }
+                            }
+                            else if (alpha < -1.0)
+                            {
+                                for (std::size_t b = 0; b < bins; ++b)
+                                {
+                                    rates[b] += alpha * delta_down[b];
+                                }
+                            }
+                            else
+                            {
+                                const double alpha2 = alpha * alpha;
+                                const double shape  = alpha2 * (15.0 + alpha2 * (3.0 * alpha2 - 10.0));
+                                for (std::size_t b = 0; b < bins; ++b)
+                                {
+                                    rates[b] += alpha * s[b] + shape * a[b];
+                                }
+                            }
+                        }
+                };
+
+                struct Sample
+                {
+                        // index of the sample's first bin among all bins
+                        std::size_t offset;
+
+                        std::vector<double> nominal;
+
+                        // parameters of the normfactor and lumi modifiers
+                        std::vector<std::size_t> factors;
+
+                        std::vector<NormSys> normsys;
+
+                        std::vector<HistoSys> histosys;
+
+                        // first parameters of the shapesys, staterror and shapefactor modifiers, with one parameter per bin
+                        std::vector<std::size_t> bin_factors;
+                };
+
+                ObservableCache cache;
+
+                std::vector<ObservableCache::ObservableId> ids;
+
+                std::vector<Sample> samples;
+
+                std::vector<double> observed;
+
+                // log(n!) for each observed event count n
+                std::vector<double> log_factorials;
+
+                unsigned channels;
+
+                BinnedPoissonBlock(const ObservableCache & cache, const std::vector<ObservableCache::ObservableId> & ids, const std::vector<Sample> & samples,
+                                   const std::vector<double> & observed, const unsigned & channels) :
+                    cache(cache),
+                    ids(ids),
+                    samples(samples),
+                    observed(observed),
+                    log_factorials(observed.size()),
+                    channels(channels)
+                {
+                    for (std::size_t b = 0; b < observed.size(); ++b)
+                    {
+                        log_factorials[b] = std::lgamma(observed[b] + 1.0);
+                    }
+                }
+
+                virtual ~BinnedPoissonBlock() {}
+
+                // thread-local scratch space, such that a block can be evaluated concurrently
+                static double *
+                workspace(const std::size_t & size)
+                {
+                    thread_local std::vector<double> buffer;
+                    if (buffer.size() < size)
+                    {
+                        buffer.resize(size);
+                    }
+
+                    return buffer.data();
+                }
+
+                // compute the expected event counts in all bins
+                void
+                expected_rates(double * rates, double * scratch) const
+                {
+                    std::fill(rates, rates + observed.size(), 0.0);
+
+                    for (const auto & sample : samples)
+                    {
+                        const std::size_t bins = sample.nominal.size();
+
+                        // additive modifiers
+                        std::copy(sample.nominal.begin(), sample.nominal.end(), scratch);
+                        for (const auto & h : sample.histosys)
+                        {
+                            h.add(cache[ids[h.parameter]], scratch);
+                        }
+
+                        // multiplicative modifiers
+                        double factor = 1.0;
+                        for (const auto & p : sample.factors)
+                        {
+                            factor *= cache[ids[p]];
+                        }
+
+                        for (const auto & n : sample.normsys)
+                        {
+                            factor *= n(cache[ids[n.parameter]]);
+                        }
+
+                        for (const auto & first : sample.bin_factors)
+                        {
+                            for (std::size_t b = 0; b < bins; ++b)
+                            {
+                                scratch[b] *= cache[ids[first + b]];
+                            }
+                        }
+
+                        double * sample_rates = rates + sample.offset;
+                        for (std::size_t b = 0; b < bins; ++b)
+                        {
+                            sample_rates[b] += factor * scratch[b];
+                        }
+                    }
+                }
+
+                // compute the log(likelihood) of a set of event counts, with log(n!) provided by the caller
+                double
+                log_likelihood(const double * counts, const double * log_factorials, const double * rates) const
+                {
+                    double result = 0.0;
+                    for (std::size_t b = 0; b < observed.size(); ++b)
+                    {
+                        if (rates[b] > 0.0) [[likely]]
+                        {
+                            result += counts[b] * std::log(rates[b]) - rates[b] - log_factorials[b];
+                        }
+                        else if ((rates[b] < 0.0) || (counts[b] > 0.0))
+                        {
+                            return -std::numeric_limits<double>::infinity();
+                        }
+                    }
+
+                    return result;
+                }
+
+                std::size_t
+                workspace_size() const
+                {
+                    std::size_t result = 0;
+                    for (const auto & sample : samples)
+                    {
+                        result = std::max(result, sample.nominal.size());
+                    }
+
+                    return observed.size() + result;
+                }
+
+                virtual std::string
+                as_string() const
+                {
+                    return "BinnedPoisson: " + stringify(channels) + " channel(s) with " + stringify(observed.size()) + " bin(s) in total";
+                }
+
+                virtual double
+                evaluate() const
+                {
+                    double * rates   = workspace(workspace_size());
+                    double * scratch = rates + observed.size();
+
+                    expected_rates(rates, scratch);
+
+                    return log_likelihood(observed.data(), log_factorials.data(), rates);
+                }
+
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & result) const
+                {
+                    result.insert(result.end(), ids.cbegin(), ids.cend());
+
+                    return true;
+                }
+
+                virtual unsigned
+                number_of_observations() const
+                {
+                    return observed.size();
+                }
+
+                virtual double
+                sample(gsl_rng * rng) const
+                {
+                    double result;
+                    sample_batch(rng, std::span<double>(&result, 1));
+
+                    return result;
+                }
+
+                virtual void
+                sample_batch(gsl_rng * rng, std::span<double> results) const
+                {
+                    const std::size_t bins = observed.size();
+
+                    std::vector<double> rates(bins), counts(bins), toy_log_factorials(bins);
+                    expected_rates(rates.data(), workspace(workspace_size()));
+
+                    for (auto & result : results)
+                    {
+                        for (std::size_t b = 0; b < bins; ++b)
+                        {
+                            counts[b]             = (rates[b] > 0.0) ? gsl_ran_poisson(rng, rates[b]) : 0.0;
+                            toy_log_factorials[b] = std::lgamma(counts[b] + 1.0);
+                        }
+
+                        result = log_likelihood(counts.data(), toy_log_factorials.data(), rates.data());
+                    }
+                }
+
+                virtual double
+                significance() const
+                {
+                    throw InternalError("BinnedPoissonBlock::significance() is not implemented");
+                }
+
+                virtual TestStatistic
+                primary_test_statistic() const
+                {
+                    return test_statistics::Empty();
+                }
+
+                virtual LogLikelihoodBlockPtr
+                clone(ObservableCache cache) const
+                {
+                    std::vector<ObservableCache::ObservableId> ids;
+                    for (const auto & id : this->ids)
+                    {
+                        ids.push_back(cache.add(this->cache.observable(id)->clone(cache.parameters())));
+                    }
+
+                    return LogLikelihoodBlockPtr(new BinnedPoissonBlock(cache, ids, samples, observed, channels));
+                }
+        };
+
+        /*
+         * Describes a signal PDF that factorises as sum_i J_i(q2) f_i(angles), with angular coefficients J_i
+         * that are provided as observables, and a fixed basis of angular functions f_i.
+         */
+        struct FactorizedSignalPDF
+        {
+                // the kinematic variables of the signal PDF, starting with q2
+                std::vector<std::string> variables;
+
+                // the ranges of the angular variables
+                std::vector<std::array<double, 2>> ranges;
+
+                // the observables providing the angular coefficients as functions of q2
+                std::vector<QualifiedName> coefficients;
+
+                // the default options of the signal PDF
+                Options options;
+
+                // evaluates the angular basis functions for one event, excluding q2
+                void (*basis)(const double * angles, double * f);
+
+                // the integrals of the basis functions over the angular ranges
+                std::vector<double> integrals;
+
+                // upper bounds on the absolute values of the basis functions
+                std::vector<double> maxima;
+        };
+
+        // B -> K^* l^+ l^-, cf. [BHvD:2010A], eq. (2.6), in the angular convention of the LHCb experiment
+        static void
+        b_to_kstar_ll_angular_basis(const double * angles, double * f)
+        {
+            // in the conventions of [BHvD:2010A], c_theta_l and phi change their signs
+            const double c_theta_l = -angles[0], c_theta_k = angles[1], phi = -angles[2];
+
+            const double c_theta_k_2 = c_theta_k * c_theta_k, s_theta_k_2 = 1.0 - c_theta_k_2;
+            const double c_theta_l_2 = c_theta_l * c_theta_l, s_theta_l_2 = 1.0 - c_theta_l_2;
+            const double s_theta_l   = std::sqrt(s_theta_l_2);
+            const double s_2_theta_k = 2.0 * std::sqrt(s_theta_k_2) * c_theta_k;
+            const double s_2_theta_l = 2.0 * s_theta_l * c_theta_l;
+            const double c_2_theta_l = 2.0 * c_theta_l_2 - 1.0;
+            const double c_phi = std::cos(phi), s_phi = std::sin(phi);
+            const double c_2_phi = 2.0 * c_phi * c_phi - 1.0, s_2_phi = 2.0 * s_phi * c_phi;
+
+            f[0]  = s_theta_k_2;                                // J_1s
+            f[1]  = c_theta_k_2;                                // J_1c
+            f[2]  = s_theta_k_2 * c_2_theta_l;                  // J_2s
+            f[3]  = c_theta_k_2 * c_2_theta_l;                  // J_2c
+            f[4]  = s_theta_k_2 * s_theta_l_2 * c_2_phi;        // J_3
+            f[5]  = s_2_theta_k * s_2_theta_l * c_phi;          // J_4
+            f[6]  = s_2_theta_k * s_theta_l * c_phi;            // J_5
+            f[7]  = s_theta_k_2 * c_theta_l;                    // J_6s
+            f[8]  = c_theta_k_2 * c_theta_l;                    // J_6c
+            f[9]  = s_2_theta_k * s_theta_l * s_phi;            // J_7
+            f[10] = s_2_theta_k * s_2_theta_l * s_phi;          // J_8
+            f[11] = s_theta_k_2 * s_theta_l_2 * s_2_phi;        // J_9
+        }
+
+        const std::map<QualifiedName, FactorizedSignalPDF> &
+        factorized_signal_pdfs()
+        {
+            static const std::map<QualifiedName, FactorizedSignalPDF> pdfs{
+                { "B->K^*ll::P(q2,cos(theta_l),cos(theta_K),phi)",
+                  FactorizedSignalPDF{
+                          { "q2", "cos(theta_l)", "cos(theta_K)", "phi" },
+                          { { -1.0, +1.0 }, { -1.0, +1.0 }, { -M_PI, +M_PI } },
+                          { "B->K^*ll::J_1s(q2)", "B->K^*ll::J_1c(q2)", "B->K^*ll::J_2s(q2)", "B->K^*ll::J_2c(q2)", "B->K^*ll::J_3(q2)", "B->K^*ll::J_4(q2)",
+                            "B->K^*ll::J_5(q2)", "B->K^*ll::J_6s(q2)", "B->K^*ll::J_6c(q2)", "B->K^*ll::J_7(q2)", "B->K^*ll::J_8(q2)", "B->K^*ll::J_9(q2)" },
+                          Options{ { "tag"_ok, "BFS2004"_ov } },
+                          &b_to_kstar_ll_angular_basis,
+                          { 16.0 * M_PI / 3.0, 8.0 * M_PI / 3.0, -16.0 * M_PI / 9.0, -8.0 * M_PI / 9.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+                          std::vector<double>(12, 1.0) } }
+            };
+
+            return pdfs;
+        }
+
+        // Unbinned likelihood for a signal PDF that factorises in q2 and the angles, for events stored as a structure of arrays.
+        struct UnbinnedFactorizedLikelihoodBlock : public LogLikelihoodBlock
+        {
+                ObservableCache cache;
+
+                QualifiedName pdf_name;
+
+                Options options;
+
+                const FactorizedSignalPDF & pdf;
+
+                std::vector<double> q2_grid;
+
+                // the events in their original, row-major layout
+                std::vector<double> events;
+
+                std::size_t number_of_events;
+
+                // ids[i * K + k] identifies the coefficient J_i at the grid point k
+                std::vector<ObservableCache::ObservableId> ids;
+
+                // the lower grid point of the q2 cell containing each event, and the event's fractional position in the cell
+                std::vector<std::size_t> cell;
+                std::vector<double>      fraction;
+
+                // basis[i * N + e] holds the basis function f_i for the event e
+                std::vector<double> basis;
+
+                UnbinnedFactorizedLikelihoodBlock(const ObservableCache & cache, const QualifiedName & pdf_name, const Options & options, const FactorizedSignalPDF & pdf,
+                                                  const std::vector<double> & q2_grid, const std::vector<double> & events) :
+                    cache(cache),
+                    pdf_name(pdf_name),
+                    options(options),
+                    pdf(pdf),
+                    q2_grid(q2_grid),
+                    events(events),
+                    number_of_events(events.size() / pdf.variables.size()),
+                    cell(number_of_events),
+                    fraction(number_of_events),
+                    basis(pdf.coefficients.size() * number_of_events)
+                {
+                    const std::size_t K = q2_grid.size(), n = pdf.coefficients.size(), N = number_of_events, D = pdf.variables.size();
+
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        for (std::size_t k = 0; k < K; ++k)
+                        {
+                            Kinematics kinematics{ { "q2", q2_grid[k] } };
+                            ids.push_back(this->cache.add(Observable::make(pdf.coefficients[i], this->cache.parameters(), kinematics, pdf.options + options)));
+                        }
+                    }
+
+                    // precompute the angular basis and the position in the q2 grid once per event
+                    std::vector<double> f(n);
+                    for (std::size_t e = 0; e < N; ++e)
+                    {
+                        const double * event = events.data() + e * D;
+
+                        const auto upper = std::upper_bound(q2_grid.begin(), q2_grid.end(), event[0]);
+                        cell[e]          = std::min<std::size_t>(std::max<std::ptrdiff_t>(upper - q2_grid.begin(), 1), K - 1) - 1;
+                        fraction[e]      = (event[0] - q2_grid[cell[e]]) / (q2_grid[cell[e] + 1] - q2_grid[cell[e]]);
+
+                        pdf.basis(event + 1, f.data());
+                        for (std::size_t i = 0; i < n; ++i)
+                        {
+                            basis[i * N + e] = f[i];
+                        }
+                    }
+                }
+
+                virtual ~UnbinnedFactorizedLikelihoodBlock() {}
+
+                // thread-local scratch space, such that a block can be evaluated concurrently
+                static double *
+                workspace(const std::size_t & size)
+                {
+                    thread_local std::vector<double> buffer;
+                    if (buffer.size() < size)
+                    {
+                        buffer.resize(size);
+                    }
+
+                    return buffer.data();
+                }
+
+                // Read the coefficients on the q2 grid from the cache, and return the normalisation, i.e., the
+                // integral of the PDF with linearly-interpolated coefficients. Both change only with the parameter point.
+                double
+                coefficients(double * J) const
+                {
+                    const std::size_t K = q2_grid.size(), n = pdf.coefficients.size();
+
+                    for (std::size_t j = 0; j < n * K; ++j)
+                    {
+                        J[j] = cache[ids[j]];
+                    }
+
+                    double result = 0.0;
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        if (0.0 == pdf.integrals[i])
+                        {
+                            continue;
+                        }
+
+                        const double * J_i = J + i * K;
+                        for (std::size_t k = 0; k < K - 1; ++k)
+                        {
+                            result += pdf.integrals[i] * 0.5 * (J_i[k] + J_i[k + 1]) * (q2_grid[k + 1] - q2_grid[k]);
+                        }
+                    }
+
+                    return result;
+                }
+
+                virtual std::string
+                as_string() const
+                {
+                    return "UnbinnedFactorized: " + pdf_name.full() + " for " + stringify(number_of_events) + " events";
+                }
+
+                virtual double
+                evaluate() const
+                {
+                    const std::size_t K = q2_grid.size(), n = pdf.coefficients.size(), N = number_of_events;
+
+                    double *     J       = workspace(n * K + N);
+                    double *     density = J + n * K;
+                    const double norm    = coefficients(J);
+
+                    if (! (norm > 0.0))
+                    {
+                        return -std::numeric_limits<double>::infinity();
+                    }
+
+                    // accumulate the unnormalised density across all events, one basis function at a time
+                    std::fill(density, density + N, 0.0);
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        const double * J_i = J + i * K;
+                        const double * f_i = basis.data() + i * N;
+                        for (std::size_t e = 0; e < N; ++e)
+                        {
+                            const double lower  = J_i[cell[e]];
+                            density[e]         += f_i[e] * (lower + fraction[e] * (J_i[cell[e] + 1] - lower));
+                        }
+                    }
+
+                    if (std::any_of(density, density + N, [](const double & d) { return ! (d > 0.0); }))
+                    {
+                        return -std::numeric_limits<double>::infinity();
+                    }
+
+                    double result = 0.0;
+                    for (std::size_t e = 0; e < N; ++e)
+                    {
+                        result += std::log(density[e]);
+                    }
+
+                    return result - N * std::log(norm);
+                }
+
+                virtual bool
+                observable_ids(std::vector<ObservableCache::ObservableId> & result) const
+                {
+                    result.insert(result.end(), ids.cbegin(), ids.cend());
+
+                    return true;
+                }
+
+                virtual unsigned
+                number_of_observations() const
+                {
+                    return number_of_events;
+                }
+
+                virtual double
+                sample(gsl_rng * rng) const
+                {
+                    double result;
+                    sample_batch(rng, std::span<double>(&result, 1));
+
+                    return result;
+                }
+
+                /*
+                 * Each pseudo experiment comprises as many events as were observed. q2 is drawn from the marginal
+                 * distribution, which is piecewise linear on the grid; the angles are then drawn by rejection
+                 * sampling against the upper bound sum_i |J_i(q2)| max |f_i|.
+                 */
+                virtual void
+                sample_batch(gsl_rng * rng, std::span<double> results) const
+                {
+                    const std::size_t K = q2_grid.size(), n = pdf.coefficients.size(), D = pdf.variables.size();
+
+                    std::vector<double> J(n * K);
+                    const double        norm = coefficients(J.data());
+                    if (! (norm > 0.0))
+                    {
+                        throw InternalError("UnbinnedFactorizedLikelihoodBlock::sample: the PDF cannot be normalised at the current parameter point");
+                    }
+
+                    // the marginal distribution of q2 on the grid, and the cumulative probabilities of the cells
+                    std::vector<double> marginal(K, 0.0), cumulative(K - 1);
+                    for (std::size_t k = 0; k < K; ++k)
+                    {
+                        for (std::size_t i = 0; i < n; ++i)
+                        {
+                            marginal[k] += pdf.integrals[i] * J[i * K + k];
+                        }
+                        marginal[k] = std::max(marginal[k], 0.0);
+                    }
+
+                    double total = 0.0;
+                    for (std::size_t k = 0; k < K - 1; ++k)
+                    {
+                        total         += 0.5 * (marginal[k] + marginal[k + 1]) * (q2_grid[k + 1] - q2_grid[k]);
+                        cumulative[k]  = total;
+                    }
+
+                    std::vector<double> angles(D - 1), f(n), J_q2(n);
+                    for (auto & result : results)
+                    {
+                        result = -1.0 * number_of_events * std::log(norm);
+                        for (std::size_t e = 0; e < number_of_events; ++e)
+                        {
+                            // q2
+                            const std::size_t k = std::min<std::size_t>(std::upper_bound(cumulative.begin(), cumulative.end(), gsl_rng_uniform(rng) * total) - cumulative.begin(), K - 2);
+                            double            t;
+                            do
+                            {
+                                t = gsl_rng_uniform(rng);
+                            }
+                            while (gsl_rng_uniform(rng) * std::max(marginal[k], marginal[k + 1]) > marginal[k] + t * (marginal[k + 1] - marginal[k]));
+
+                            double bound = 0.0;
+                            for (std::size_t i = 0; i < n; ++i)
+                            {
+                                J_q2[i]  = J[i * K + k] + t * (J[i * K + k + 1] - J[i * K + k]);
+                                bound   += std::abs(J_q2[i]) * pdf.maxima[i];
+                            }
+
+                            // angles
+                            double density;
+                            do
+                            {
+                                for (std::size_t d = 0; d < D - 1; ++d)
+                                {
+                                    angles[d] = pdf.ranges[d][0] + gsl_rng_uniform(rng) * (pdf.ranges[d][1] - pdf.ranges[d][0]);
+                                }
+
+                                pdf.basis(angles.data(), f.data());
+
+                                density = 0.0;
+                                for (std::size_t i = 0; i < n; ++i)
+                                {
+                                    density += J_q2[i] * f[i];
+                                }
+                            }
+                            while (gsl_rng_uniform(rng) * bound > density);
+
+                            result += std::log(density);
+                        }
+                    }
+                }
+
+                virtual double
+                significance() const
+                {
+                    throw InternalError("UnbinnedFactorizedLikelihoodBlock::significance() is not implemented");
+                }
+
+                virtual TestStatistic
+                primary_test_statistic() const
+                {
+                    return test_statistics::Empty();
+                }
+
+                virtual LogLikelihoodBlockPtr
+                clone(ObservableCache cache) const
+                {
+                    return LogLikelihoodBlockPtr(new UnbinnedFactorizedLikelihoodBlock(cache, pdf_name, options, pdf, q2_grid, events));
+                }
+        };
+    } // namespace implementation
+
+    LogLikelihoodBlock::~LogLikelihoodBlock() {}
+
+    bool
+    LogLikelihoodBlock::add_gradient(std::span<double>) const
+    {
+        return false;
+    }
+
+    bool
+    LogLikelihoodBlock::observable_ids(std::vector<ObservableCache::ObservableId> &) const
+    {
+        return false;
+    }
+
+    void
+    LogLikelihoodBlock::sample_batch(gsl_rng * rng, std::span<double> results) const
+    {
+        for (auto & result : results)
+        {
+            result = this->sample(rng);
+        }
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable, const double & min, const double & central, const double & max,
+                                 const unsigned & number_of_observations)
+    {
+        // check input
+        if (min >= central)
+        {
+            throw InternalError("LogLikelihoodBlock::Gaussian: min value >= central value");
+        }
+
+        if (max <= central)
+        {
+            throw InternalError("LogLikelihoodBlock::Gaussian: max value <= central value");
+        }
+
+        auto id = cache.add(observable);
+
+        return LogLikelihoodBlockPtr(new implementation::GaussianBlock(cache, id, min, central, max, number_of_observations));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::LogGamma(ObservableCache cache, const ObservablePtr & observable, const double & min, const double & central, const double & max, const double & alpha,
+                                 const double & lambda, const unsigned & number_of_observations)
+    {
+        // check input
+        if (min >= central)
+        {
+            throw InternalError("LogLikelihoodBlock::LogGamma: min value >= central value");
+        }
+
+        if (max <= central)
+        {
+            throw InternalError("LogLikelihoodBlock::LogGamma: max value <= central value");
+        }
+
+        if (alpha <= 0)
         {
             throw InternalError("LogLikelihoodBlock::LogGamma: shape parameter alpha (" + stringify(alpha) + ") must be positive");
         }
@@ -1632,55 +2669,299 @@ namespace eos
             throw InternalError("LogLikelihoodBlock::Mixture(): components and weights don't match");
         }
 
-        // normalize weights
-        double sum = 0; // std::accumulate(weights.cbegin(), weights.cend(), 0);
-        for (double weight : weights)
+        // normalize weights
+        double sum = 0; // std::accumulate(weights.cbegin(), weights.cend(), 0);
+        for (double weight : weights)
+        {
+            sum += weight;
+        }
+
+        std::vector<double> norm_weights(weights);
+
+        std::transform(weights.cbegin(), weights.cend(), norm_weights.begin(), std::bind(std::multiplies<double>(), 1.0 / sum, std::placeholders::_1));
+        Log::instance()->message("MixtureBlock()", ll_debug) << "sum = " << sum << ", norm. weights " << stringify_container(norm_weights);
+
+        return LogLikelihoodBlockPtr(new implementation::MixtureBlock(components, norm_weights, test_stat));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::MultivariateGaussian(ObservableCache cache, const std::vector<ObservablePtr> & observables, gsl_vector * mean, gsl_matrix * covariance,
+                                             gsl_matrix * response, const unsigned & number_of_observations)
+    {
+        std::vector<ObservableCache::ObservableId> ids;
+        for (auto & o : observables)
+        {
+            ids.push_back(cache.add(o));
+        }
+
+        return LogLikelihoodBlockPtr(new implementation::MultivariateGaussianBlock(cache, std::move(ids), mean, covariance, response, number_of_observations));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::Unbinned1D(ObservableCache cache, const QualifiedName & pdf_name, const std::vector<Kinematics> & kinematics, const Options & options,
+                                   const std::vector<double> & resolution, const std::vector<Kinematics> & observations)
+    {
+        if (kinematics.empty())
+        {
+            throw InternalError("LogLikelihoodBlock::Unbinned1D: kinematics must not be empty");
+        }
+
+        if (kinematics.size() != resolution.size())
+        {
+            throw InternalError("LogLikelihoodBlock::Unbinned1D: kinematics and resolution must have the same size");
+        }
+
+        if (observations.empty())
+        {
+            throw InternalError("LogLikelihoodBlock::Unbinned1D: observations must not be empty");
+        }
+
+        return LogLikelihoodBlockPtr(
+                new implementation::Unbinned1DLikelihoodBlock<1>(cache, pdf_name, kinematics, options, resolution, observations, std::array<std::size_t, 1>{ kinematics.size() }));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::UnbinnedFactorized(ObservableCache cache, const QualifiedName & pdf_name, const Options & options, const std::vector<double> & q2_grid,
+                                           std::span<const double> events)
+    {
+        const auto & pdfs = implementation::factorized_signal_pdfs();
+        auto         i    = pdfs.find(pdf_name);
+        if (pdfs.end() == i)
+        {
+            throw InternalError("LogLikelihoodBlock::UnbinnedFactorized: the signal PDF '" + pdf_name.full() + "' is not known to factorise");
+        }
+
+        const auto & pdf = i->second;
+        const auto   D   = pdf.variables.size();
+
+        if (q2_grid.size() < 2)
+        {
+            throw InternalError("LogLikelihoodBlock::UnbinnedFactorized: the q2 grid requires at least two points");
+        }
+
+        if (! std::is_sorted(q2_grid.begin(), q2_grid.end(), std::less_equal<double>()))
+        {
+            throw InternalError("LogLikelihoodBlock::UnbinnedFactorized: the q2 grid must be strictly increasing");
+        }
+
+        if (events.empty() || (0 != events.size() % D))
+        {
+            throw InternalError("LogLikelihoodBlock::UnbinnedFactorized: expected a non-empty buffer of events with " + stringify(D) + " variables each, got a buffer of size "
+                                + stringify(events.size()));
+        }
+
+        for (std::size_t e = 0; e < events.size(); e += D)
+        {
+            bool inside = (q2_grid.front() <= events[e]) && (events[e] <= q2_grid.back());
+            for (std::size_t d = 1; d < D; ++d)
+            {
+                inside &= (pdf.ranges[d - 1][0] <= events[e + d]) && (events[e + d] <= pdf.ranges[d - 1][1]);
+            }
+
+            if (! inside)
+            {
+                throw InternalError("LogLikelihoodBlock::UnbinnedFactorized: event " + stringify(e / D) + " lies outside of the kinematic ranges");
+            }
+        }
+
+        return LogLikelihoodBlockPtr(
+                new implementation::UnbinnedFactorizedLikelihoodBlock(cache, pdf_name, options, pdf, q2_grid, std::vector<double>(events.begin(), events.end())));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::BinnedPoisson(ObservableCache cache, const std::string & workspace, const std::map<std::string, QualifiedName> & parameter_map)
+    {
+        using Sample = implementation::BinnedPoissonBlock::Sample;
+
+        // a pyhf parameter, with one element per bin for the shapesys, staterror and shapefactor modifiers
+        struct ParameterSet
+        {
+                std::string type;
+                std::size_t first, size;
+                double      init, min, max;
+                bool        scalar;
+        };
+
+        YAML::Node root;
+        try
+        {
+            // JSON is a subset of YAML; accept both a file name and the workspace specification itself
+            const auto first = workspace.find_first_not_of(" \t\r\n");
+            root             = ((std::string::npos != first) && ('{' == workspace[first])) ? YAML::Load(workspace) : YAML::LoadFile(workspace);
+        }
+        catch (YAML::Exception & e)
+        {
+            throw InternalError("LogLikelihoodBlock::BinnedPoisson: cannot parse workspace '" + workspace + "': " + e.what());
+        }
+
+        std::vector<double>                 observed;
+        std::vector<Sample>                 samples;
+        std::map<std::string, ParameterSet> parameter_sets;
+        std::vector<std::string>            parameter_order;
+        std::size_t                         number_of_parameters = 0;
+        unsigned                            channels             = 0;
+
+        // register a parameter set, or check the consistency with a previous registration of the same name
+        auto parameter = [&](const std::string & name, const std::string & type, const std::size_t & size, const bool & scalar) -> std::size_t
+        {
+            auto i = parameter_sets.find(name);
+            if (parameter_sets.end() != i)
+            {
+                if ((i->second.type != type) || (i->second.size != size))
+                {
+                    throw InternalError("LogLikelihoodBlock::BinnedPoisson: inconsistent declarations of the modifier '" + name + "'");
+                }
+
+                return i->second.first;
+            }
+
+            ParameterSet p{ type, number_of_parameters, size, 1.0, 0.0, 10.0, scalar };
+            if (("normsys" == type) || ("histosys" == type))
+            {
+                p.init = 0.0;
+                p.min  = -5.0;
+                p.max  = +5.0;
+            }
+            else if (("shapesys" == type) || ("staterror" == type))
+            {
+                p.min = 1.0e-10;
+            }
+
+            parameter_sets.emplace(name, p);
+            parameter_order.push_back(name);
+            number_of_parameters += size;
+
+            return p.first;
+        };
+
+        try
         {
-            sum += weight;
-        }
+            std::map<std::string, std::vector<double>> observations;
+            for (auto && o : root["observations"])
+            {
+                observations[o["name"].as<std::string>()] = o["data"].as<std::vector<double>>();
+            }
 
-        std::vector<double> norm_weights(weights);
+            for (auto && c : root["channels"])
+            {
+                const auto name = c["name"].as<std::string>();
+                auto       o    = observations.find(name);
+                if (observations.end() == o)
+                {
+                    throw InternalError("LogLikelihoodBlock::BinnedPoisson: no observations for channel '" + name + "'");
+                }
 
-        std::transform(weights.cbegin(), weights.cend(), norm_weights.begin(), std::bind(std::multiplies<double>(), 1.0 / sum, std::placeholders::_1));
-        Log::instance()->message("MixtureBlock()", ll_debug) << "sum = " << sum << ", norm. weights " << stringify_container(norm_weights);
+                const std::size_t offset = observed.size(), bins = o->second.size();
+                observed.insert(observed.end(), o->second.begin(), o->second.end());
+                ++channels;
 
-        return LogLikelihoodBlockPtr(new implementation::MixtureBlock(components, norm_weights, test_stat));
-    }
+                for (auto && s : c["samples"])
+                {
+                    Sample sample;
+                    sample.offset  = offset;
+                    sample.nominal = s["data"].as<std::vector<double>>();
 
-    LogLikelihoodBlockPtr
-    LogLikelihoodBlock::MultivariateGaussian(ObservableCache cache, const std::vector<ObservablePtr> & observables, gsl_vector * mean, gsl_matrix * covariance,
-                                             gsl_matrix * response, const unsigned & number_of_observations)
-    {
-        std::vector<ObservableCache::ObservableId> ids;
-        for (auto & o : observables)
-        {
-            ids.push_back(cache.add(o));
-        }
+                    if (sample.nominal.size() != bins)
+                    {
+                        throw InternalError("LogLikelihoodBlock::BinnedPoisson: sample '" + s["name"].as<std::string>() + "' in channel '" + name + "' has "
+                                            + stringify(sample.nominal.size()) + " bins, expected " + stringify(bins));
+                    }
 
-        return LogLikelihoodBlockPtr(new implementation::MultivariateGaussianBlock(cache, std::move(ids), mean, covariance, response, number_of_observations));
-    }
+                    for (auto && m : s["modifiers"])
+                    {
+                        const auto modifier = m["name"].as<std::string>();
+                        const auto type     = m["type"].as<std::string>();
 
-    LogLikelihoodBlockPtr
-    LogLikelihoodBlock::Unbinned1D(ObservableCache cache, const QualifiedName & pdf_name, const std::vector<Kinematics> & kinematics, const Options & options,
-                                   const std::vector<double> & resolution, const std::vector<Kinematics> & observations)
-    {
-        if (kinematics.empty())
-        {
-            throw InternalError("LogLikelihoodBlock::Unbinned1D: kinematics must not be empty");
-        }
+                        if (("normfactor" == type) || ("lumi" == type))
+                        {
+                            sample.factors.push_back(parameter(modifier, type, 1, true));
+                        }
+                        else if ("normsys" == type)
+                        {
+                            sample.normsys.emplace_back(parameter(modifier, type, 1, true), m["data"]["hi"].as<double>(), m["data"]["lo"].as<double>());
+                        }
+                        else if ("histosys" == type)
+                        {
+                            const auto hi = m["data"]["hi_data"].as<std::vector<double>>();
+                            const auto lo = m["data"]["lo_data"].as<std::vector<double>>();
+                            if ((hi.size() != bins) || (lo.size() != bins))
+                            {
+                                throw InternalError("LogLikelihoodBlock::BinnedPoisson: histosys modifier '" + modifier + "' does not match the number of bins");
+                            }
 
-        if (kinematics.size() != resolution.size())
+                            sample.histosys.emplace_back(parameter(modifier, type, 1, true), sample.nominal, hi, lo);
+                        }
+                        else if (("shapesys" == type) || ("staterror" == type) || ("shapefactor" == type))
+                        {
+                            sample.bin_factors.push_back(parameter(modifier, type, bins, false));
+                        }
+                        else
+                        {
+                            throw InternalError("LogLikelihoodBlock::BinnedPoisson: unsupported modifier type '" + type + "'");
+                        }
+                    }
+
+                    samples.push_back(std::move(sample));
+                }
+            }
+
+            // the first measurement's configuration determines the initial values and the bounds of the parameters
+            if (root["measurements"] && (root["measurements"].size() > 0))
+            {
+                for (auto && p : root["measurements"][0]["config"]["parameters"])
+                {
+                    auto i = parameter_sets.find(p["name"].as<std::string>());
+                    if (parameter_sets.end() == i)
+                    {
+                        continue;
+                    }
+
+                    if (p["inits"])
+                    {
+                        i->second.init = p["inits"][0].as<double>();
+                    }
+
+                    if (p["bounds"])
+                    {
+                        i->second.min = p["bounds"][0][0].as<double>();
+                        i->second.max = p["bounds"][0][1].as<double>();
+                    }
+                }
+            }
+        }
+        catch (YAML::Exception & e)
         {
-            throw InternalError("LogLikelihoodBlock::Unbinned1D: kinematics and resolution must have the same size");
+            throw InternalError("LogLikelihoodBlock::BinnedPoisson: malformed workspace '" + workspace + "': " + e.what());
         }
 
-        if (observations.empty())
+        // map the pyhf parameters onto EOS observables or parameters, in the same way as eos.PyhfLogLikelihood
+        Parameters                                 parameters = cache.parameters();
+        std::vector<ObservableCache::ObservableId> ids(number_of_parameters);
+        for (const auto & name : parameter_order)
         {
-            throw InternalError("LogLikelihoodBlock::Unbinned1D: observations must not be empty");
+            const auto & p = parameter_sets.at(name);
+            for (std::size_t i = 0; i < p.size; ++i)
+            {
+                const std::string element = p.scalar ? name : name + "[" + stringify(i) + "]";
+
+                auto          m              = parameter_map.find(element);
+                QualifiedName qualified_name = (parameter_map.end() != m) ? m->second : QualifiedName("pyhf::" + element);
+
+                if (! Observables().has(qualified_name))
+                {
+                    if (! parameters.has(qualified_name))
+                    {
+                        parameters.declare_and_insert(qualified_name, element, Unit::Undefined(), p.init, p.min, p.max);
+                    }
+
+                    parameters[qualified_name] = p.init;
+                }
+
+                ids[p.first + i] = cache.add(Observable::make(qualified_name, parameters, Kinematics(), Options()));
+            }
         }
 
-        return LogLikelihoodBlockPtr(
-                new implementation::Unbinned1DLikelihoodBlock<1>(cache, pdf_name, kinematics, options, resolution, observations, std::array<std::size_t, 1>{ kinematics.size() }));
+        return LogLikelihoodBlockPtr(new implementation::BinnedPoissonBlock(cache, ids, samples, observed, channels));
     }
 
     LogLikelihoodBlockPtr
@@ -1714,69 +2995,171 @@ namespace eos
             // Container for all external likelihood blocks
             std::vector<LogLikelihoodBlockPtr> external_blocks;
 
+            // The value of each block as of its last evaluation, and the observables it depends on
+            struct BlockState
+            {
+                    LogLikelihoodBlockPtr block;
+
+                    std::vector<ObservableCache::ObservableId> ids;
+
+                    // set if the block depends on nothing but the predictions of ids
+                    bool tracked;
+
+                    // set if value holds the result of a previous evaluation
+                    bool valid;
+
+                    double value;
+
+                    // the cache's generation at the last evaluation
+                    unsigned long generation;
+            };
+
+            mutable std::vector<BlockState> block_states;
+
+            // Set if block_states reflects the current set of blocks
+            mutable bool block_states_valid;
+
             Implementation(const Parameters & parameters) :
                 parameters(parameters),
-                cache(parameters)
+                cache(parameters),
+                block_states_valid(false)
             {
             }
 
-            std::pair<double, double>
-            bootstrap_p_value(const unsigned & datasets)
-            {
-                // Algorithm:
-                // 1. For fixed parameters, create data sets under the model.
-                // 2. Use the likelihood as test statistic, T=L, calculate it for each data set.
-                // 3. Compare with likelihood of "observed" data set to define p-value
-                //      p = #llh < llh(obs) / #trials
+            // number of pseudo experiments that share one random number generator
+            static constexpr unsigned long toys_per_chunk = 1024;
 
-                // observed value
-                double t_obs = 0;
+            // all blocks with at least one observation
+            std::vector<LogLikelihoodBlockPtr>
+            observed_blocks() const
+            {
+                std::vector<LogLikelihoodBlockPtr> result;
 
-                // set up for sampling
                 for (const auto & constraint : constraints)
                 {
                     for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks(); b != b_end; ++b)
                     {
-                        if (! (*b)->number_of_observations())
+                        if ((*b)->number_of_observations())
                         {
-                            continue;
+                            result.push_back(*b);
                         }
-                        t_obs += (*b)->evaluate();
                     }
                 }
 
-                Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational) << "The value of the test statistic (total likelihood) "
-                                                                                              << "for the current parameters is = " << t_obs;
+                for (const auto & block : external_blocks)
+                {
+                    if (block->number_of_observations())
+                    {
+                        result.push_back(block);
+                    }
+                }
 
-                // count data sets with smaller likelihood
-                unsigned n_low = 0;
+                return result;
+            }
+
+            // derive the seed of a chunk's random number generator from the global seed (splitmix64)
+            static unsigned long
+            chunk_seed(const unsigned long & seed, const unsigned long & chunk)
+            {
+                std::uint64_t z = static_cast<std::uint64_t>(seed) + (static_cast<std::uint64_t>(chunk) + 1u) * 0x9e3779b97f4a7c15ull;
+                z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
 
-                // test value
-                double t;
+                return static_cast<unsigned long>(z ^ (z >> 31));
+            }
 
-                gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
-                gsl_rng_set(rng, datasets);
+            void
+            simulate(const unsigned long & toys, const unsigned long & seed, const std::function<void(const unsigned long &, std::span<const double>)> & consumer) const
+            {
+                const auto          blocks = observed_blocks();
+                const unsigned long chunks = (toys + toys_per_chunk - 1) / toys_per_chunk;
 
-                Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational) << "Begin sampling " << datasets << " simulated "
-                                                                                              << "values of the likelihood";
+                // simulate one chunk per thread at a time, and hand the results over in order
+                const unsigned                   wave = std::max(1u, ThreadPool::instance()->number_of_threads());
+                std::vector<std::vector<double>> results(wave, std::vector<double>(toys_per_chunk));
+                std::vector<std::exception_ptr>  errors(wave);
+
+                unsigned long first_chunk = 0;
+
+                const auto simulate_chunk = [&](const unsigned & w)
+                {
+                    const unsigned long chunk = first_chunk + w;
+                    const unsigned long first = chunk * toys_per_chunk;
+                    std::span<double>   t(results[w].data(), std::min(toys_per_chunk, toys - first));
 
-                // collect samples
-                for (unsigned i = 0; i < datasets; ++i)
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, chunk_seed(seed, chunk));
+
+                    try
+                    {
+                        std::fill(t.begin(), t.end(), 0.0);
+
+                        std::vector<double> llh(t.size());
+                        for (const auto & b : blocks)
+                        {
+                            b->sample_batch(rng, llh);
+
+                            for (std::size_t i = 0; i < t.size(); ++i)
+                            {
+                                t[i] += llh[i];
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[w] = std::current_exception();
+                    }
+
+                    gsl_rng_free(rng);
+                };
+
+                for (; first_chunk < chunks; first_chunk += wave)
                 {
-                    t = 0.0;
-                    for (const auto & constraint : constraints)
+                    const unsigned n = static_cast<unsigned>(std::min<unsigned long>(wave, chunks - first_chunk));
+
+                    ThreadPool::instance()->enqueue_range(n, simulate_chunk).wait();
+
+                    for (unsigned w = 0; w < n; ++w)
                     {
-                        for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks(); b != b_end; ++b)
+                        if (errors[w])
                         {
-                            t += (*b)->sample(rng);
+                            std::rethrow_exception(errors[w]);
                         }
                     }
 
-                    if (t < t_obs)
+                    for (unsigned w = 0; w < n; ++w)
                     {
-                        ++n_low;
+                        const unsigned long first = (first_chunk + w) * toys_per_chunk;
+                        consumer(first, std::span<const double>(results[w].data(), std::min(toys_per_chunk, toys - first)));
                     }
                 }
+            }
+
+            std::pair<double, double>
+            bootstrap_p_value(const unsigned & datasets)
+            {
+                // Algorithm:
+                // 1. For fixed parameters, create data sets under the model.
+                // 2. Use the likelihood as test statistic, T=L, calculate it for each data set.
+                // 3. Compare with likelihood of "observed" data set to define p-value
+                //      p = #llh < llh(obs) / #trials
+
+                // observed value
+                double t_obs = 0;
+                for (const auto & b : observed_blocks())
+                {
+                    t_obs += b->evaluate();
+                }
+
+                Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational) << "The value of the test statistic (total likelihood) "
+                                                                                              << "for the current parameters is = " << t_obs;
+
+                Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational) << "Begin sampling " << datasets << " simulated "
+                                                                                              << "values of the likelihood";
+
+                // count data sets with smaller likelihood
+                unsigned n_low = 0;
+                simulate(datasets, datasets, [&](const unsigned long &, std::span<const double> t) { n_low += std::count_if(t.begin(), t.end(), [&](const double & v) { return v < t_obs; }); });
 
                 // mode of binomial posterior
                 double p = n_low / double(datasets);
@@ -1788,44 +3171,171 @@ namespace eos
 
                 Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational) << "The simulated p-value is " << p << " with uncertainty " << uncertainty;
 
-                gsl_rng_free(rng);
-
                 return std::make_pair(p, uncertainty);
             }
 
+            // Blocks are only ever appended, so the states of all known blocks are retained
+            void
+            make_block_states() const
+            {
+                std::vector<BlockState> previous_states;
+                std::swap(previous_states, block_states);
+
+                const auto add = [&](const LogLikelihoodBlockPtr & b)
+                {
+                    const auto i = block_states.size();
+                    if ((i < previous_states.size()) && (previous_states[i].block == b))
+                    {
+                        block_states.push_back(std::move(previous_states[i]));
+                        return;
+                    }
+
+                    BlockState state{ b, {}, false, false, 0.0, 0 };
+                    state.tracked = b->observable_ids(state.ids);
+                    block_states.push_back(std::move(state));
+                };
+
+                // all constraint-based likelihood blocks
+                for (const auto & constraint : constraints)
+                {
+                    for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks(); b != b_end; ++b)
+                    {
+                        add(*b);
+                    }
+                }
+
+                // all external likelihood blocks
+                for (const auto & block : external_blocks)
+                {
+                    add(block);
+                }
+
+                block_states_valid = true;
+            }
+
             double
             log_likelihood() const
             {
+                if (! block_states_valid)
+                {
+                    make_block_states();
+                }
+
+                const unsigned long generation = cache.generation();
+
+                // only re-evaluate those blocks for which any prediction has changed since their last evaluation
                 double result = 0.0;
+                for (auto & state : block_states)
+                {
+                    bool stale = ! (state.valid && state.tracked);
+                    for (auto i = state.ids.cbegin(), i_end = state.ids.cend(); (! stale) && (i != i_end); ++i)
+                    {
+                        stale = cache.generation(*i) > state.generation;
+                    }
+
+                    if (stale)
+                    {
+                        state.value      = state.block->evaluate();
+                        state.generation = generation;
+                        state.valid      = true;
+                    }
+
+                    if (! std::isfinite(state.value))
+                    {
+                        return -std::numeric_limits<double>::infinity();
+                    }
+
+                    result += state.value;
+                }
+
+                return result;
+            }
+
+            void
+            gradient(const std::vector<Parameter> & parameters, std::span<double> gradient)
+            {
+                if (parameters.size() != gradient.size())
+                {
+                    throw InternalError("LogLikelihood::gradient: expected a buffer for " + stringify(parameters.size()) + " derivatives, got "
+                                        + stringify(gradient.size()));
+                }
+
+                // predict the observables at the current point
+                cache.update();
+
+                // collect the derivatives of the blocks with respect to the observables,
+                // and the blocks that can only be differentiated numerically
+                std::vector<double>                d_observables(cache.size(), 0.0);
+                std::vector<LogLikelihoodBlockPtr> numerical_blocks;
+
+                const auto collect = [&](const LogLikelihoodBlockPtr & b)
+                {
+                    if (! b->add_gradient(d_observables))
+                    {
+                        numerical_blocks.push_back(b);
+                    }
+                };
 
-                // loop over all constraint-based likelihood blocks
                 for (const auto & constraint : constraints)
                 {
                     for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks(); b != b_end; ++b)
                     {
-                        double llh = (*b)->evaluate();
-                        if (! std::isfinite(llh))
-                        {
-                            return -std::numeric_limits<double>::infinity();
-                        }
-
-                        result += llh;
+                        collect(*b);
                     }
                 }
 
-                // loop over all external likelihood blocks
                 for (const auto & block : external_blocks)
                 {
-                    double llh = block->evaluate();
-                    if (! std::isfinite(llh))
+                    collect(block);
+                }
+
+                std::vector<unsigned> ids;
+                for (unsigned i = 0; i < d_observables.size(); ++i)
+                {
+                    if (0.0 != d_observables[i])
                     {
-                        return -std::numeric_limits<double>::infinity();
+                        ids.push_back(i);
+                    }
+                }
+
+                for (unsigned k = 0; k < parameters.size(); ++k)
+                {
+                    Parameter p = parameters[k];
+
+                    if (! cache.depends_on(p.id()))
+                    {
+                        gradient[k] = 0.0;
+                        continue;
                     }
 
-                    result += llh;
+                    // The log likelihood linearised in the observables has the same derivative as the log likelihood
+                    // itself. Only the observables using the parameter are re-evaluated by the cache.
+                    const auto linearised = [&](const double & x) -> double
+                    {
+                        p.set(x);
+                        cache.update();
+
+                        double result = 0.0;
+                        for (const auto & i : ids)
+                        {
+                            result += d_observables[i] * cache[ObservableCache::ObservableId(i)];
+                        }
+
+                        for (const auto & b : numerical_blocks)
+                        {
+                            result += b->evaluate();
+                        }
+
+                        return result;
+                    };
+
+                    const double x0 = p.evaluate();
+                    gradient[k]     = derivative<1u, deriv::TwoSided>(linearised, x0);
+                    p.set(x0);
                 }
 
-                return result;
+                // restore the predictions at the current point
+                cache.update();
             }
     };
 
@@ -1841,6 +3351,7 @@ namespace eos
     {
         LogLikelihoodBlockPtr b = LogLikelihoodBlock::Gaussian(_imp->cache, observable, min, central, max, number_of_observations);
         _imp->constraints.push_back(Constraint(observable->name(), std::vector<ObservablePtr>{ observable }, std::vector<LogLikelihoodBlockPtr>{ b }));
+        _imp->block_states_valid = false;
     }
 
     void
@@ -1859,12 +3370,14 @@ namespace eos
 
         // retain a proper copy of the constraint to iterate over
         _imp->constraints.push_back(Constraint(constraint.name(), observables, blocks));
+        _imp->block_states_valid = false;
     }
 
     void
     LogLikelihood::add(const LogLikelihoodBlockPtr & block)
     {
         _imp->external_blocks.push_back(block->clone(_imp->cache));
+        _imp->block_states_valid = false;
     }
 
     LogLikelihood::ConstraintIterator
@@ -1879,12 +3392,32 @@ namespace eos
         return ConstraintIterator(_imp->constraints.end());
     }
 
+    void
+    LogLikelihood::gradient(const std::vector<Parameter> & parameters, std::span<double> gradient) const
+    {
+        _imp->gradient(parameters, gradient);
+    }
+
     std::pair<double, double>
     LogLikelihood::bootstrap_p_value(const unsigned & datasets)
     {
         return _imp->bootstrap_p_value(datasets);
     }
 
+    void
+    LogLikelihood::simulate(const unsigned long & toys, const unsigned long & seed,
+                            const std::function<void(const unsigned long &, std::span<const double>)> & consumer) const
+    {
+        _imp->simulate(toys, seed, consumer);
+    }
+
+    void
+    LogLikelihood::simulate(const unsigned long & seed, std::span<double> test_statistics) const
+    {
+        _imp->simulate(test_statistics.size(), seed,
+                       [&](const unsigned long & first, std::span<const double> t) { std::copy(t.begin(), t.end(), test_statistics.begin() + first); });
+    }
+
     LogLikelihood
     LogLikelihood::clone() const
     {
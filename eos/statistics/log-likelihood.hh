@@ -35,6 +35,11 @@
 #include <gsl/gsl_vector.h>
 
 #include <cmath>
+#include <functional>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace eos
 {
@@ -61,6 +66,31 @@ namespace eos
             /// Compute the logarithm of the likelihood for this block.
             virtual double evaluate() const = 0;
 
+            /*!
+             * Compute the partial derivatives of the logarithm of the likelihood for this block
+             * with respect to the predictions of its observables, at the predictions currently
+             * held by the observable cache.
+             *
+             * The default implementation does not provide any derivatives. Blocks without
+             * analytic derivatives are differentiated numerically by LogLikelihood::gradient().
+             *
+             * @param gradient The buffer, indexed by ObservableCache::ObservableId, to which the derivatives are added.
+             * @return Whether the derivatives have been added.
+             */
+            virtual bool add_gradient(std::span<double> gradient) const;
+
+            /*!
+             * Retrieve the ids of the observables whose predictions this block reads.
+             *
+             * LogLikelihood uses this information to re-evaluate a block only when at least one of its
+             * predictions has changed. The default implementation does not provide any ids, and the
+             * block is re-evaluated every time.
+             *
+             * @param ids The container to which the ids are appended.
+             * @return Whether the block's value depends on nothing but the predictions of the appended ids.
+             */
+            virtual bool observable_ids(std::vector<ObservableCache::ObservableId> & ids) const;
+
             /// The number of experimental observations (not observables!) used in this block.
             virtual unsigned number_of_observations() const = 0;
 
@@ -74,6 +104,17 @@ namespace eos
              */
             virtual double sample(gsl_rng * rng) const = 0;
 
+            /*!
+             * Sample from the logarithm of the likelihood for this block for a batch of pseudo experiments.
+             *
+             * The default implementation calls sample() once per pseudo experiment. Blocks with expensive
+             * preparations, such as a convolution, override it to prepare only once per batch.
+             *
+             * @param rng     The random number generator.
+             * @param results The buffer receiving one value per pseudo experiment.
+             */
+            virtual void sample_batch(gsl_rng * rng, std::span<double> results) const;
+
             /*!
              * Calculate the significance of the deviation between
              * the observables' current value and the mode in
@@ -325,6 +366,43 @@ namespace eos
              */
             static LogLikelihoodBlockPtr Unbinned1D(ObservableCache cache, const QualifiedName & pdf_name, const std::vector<Kinematics> & kinematics, const Options & options,
                                                     const std::vector<double> & resolution, const std::vector<Kinematics> & observations);
+
+            /*!
+             * Create a new LogLikelihoodBlock for an unbinned likelihood of a signal PDF that factorises as
+             * sum_i J_i(q2) f_i(angles), e.g., B->K^*ll::P(q2,cos(theta_l),cos(theta_K),phi).
+             *
+             * The angular basis functions f_i are computed once per event upon construction, and stored
+             * with the events as a structure of arrays. The coefficients J_i are evaluated on the q2 grid
+             * once per parameter point through the observable cache, and linearly interpolated to the
+             * events. The PDF is normalised with the integral of the interpolated coefficients over
+             * the grid, which is exact for the interpolation.
+             *
+             * @param cache    The observable cache used by the total log-likelihood.
+             * @param pdf_name The name of the SignalPDF.
+             * @param options  Options forwarded to the observables providing the coefficients J_i.
+             * @param q2_grid  The strictly increasing q2 grid, which also determines the q2 range of the PDF.
+             * @param events   The observed events, with one row per event and one column per kinematic
+             *                 variable of the SignalPDF, in the order of their declaration.
+             */
+            static LogLikelihoodBlockPtr UnbinnedFactorized(ObservableCache cache, const QualifiedName & pdf_name, const Options & options, const std::vector<double> & q2_grid,
+                                                            std::span<const double> events);
+
+            /*!
+             * Create a new LogLikelihoodBlock for a binned likelihood of Poisson-distributed event counts,
+             * as specified by a HistFactory workspace in the JSON format used by pyhf.
+             *
+             * Only the main term of the likelihood is evaluated; the constraint terms of the modifiers
+             * must be accounted for through priors. The normfactor, lumi, normsys, histosys, shapesys,
+             * staterror, and shapefactor modifiers are supported, using pyhf's default interpolation
+             * codes 4 (normsys) and 4p (histosys).
+             *
+             * @param cache         The observable cache used by the total log-likelihood.
+             * @param workspace     The path to a JSON file specifying the workspace, or the JSON specification itself.
+             * @param parameter_map Maps the names of pyhf parameters onto the names of EOS observables or parameters.
+             *                      Unmapped pyhf parameters default to the EOS parameters 'pyhf::<name>', which are
+             *                      declared if they do not exist yet.
+             */
+            static LogLikelihoodBlockPtr BinnedPoisson(ObservableCache cache, const std::string & workspace, const std::map<std::string, QualifiedName> & parameter_map = {});
     };
 
     /*!
@@ -400,6 +478,33 @@ namespace eos
              */
             std::pair<double, double> bootstrap_p_value(const unsigned & datasets);
 
+            /*!
+             * Simulate pseudo experiments for the current setting of the parameters, and
+             * compute the test statistic, i.e., the total log likelihood, for each of them.
+             *
+             * The pseudo experiments are simulated concurrently in chunks of a fixed size. Each
+             * chunk draws from its own random number generator, seeded from the seed and the
+             * index of the chunk, so that the results do not depend on the number of threads.
+             * Only blocks with at least one observation take part.
+             *
+             * @param toys     The number of pseudo experiments.
+             * @param seed     The seed from which the random number generators are seeded.
+             * @param consumer Receives consecutive chunks of test statistics, in the order of the
+             *                 pseudo experiments and in the calling thread, together with the index
+             *                 of the first pseudo experiment in the chunk.
+             */
+            void simulate(const unsigned long & toys, const unsigned long & seed,
+                          const std::function<void(const unsigned long &, std::span<const double>)> & consumer) const;
+
+            /*!
+             * Simulate pseudo experiments for the current setting of the parameters, and
+             * store the test statistic for each of them.
+             *
+             * @param seed            The seed from which the random number generators are seeded.
+             * @param test_statistics The buffer receiving one test statistic per pseudo experiment.
+             */
+            void simulate(const unsigned long & seed, std::span<double> test_statistics) const;
+
             /*!
              * Create an independent instance of this LogLikelihood that uses the same set of observables and measurements.
              */
@@ -424,9 +529,26 @@ namespace eos
 
             /*!
              * Evaluate the log likelihood, i.e., return @f[ \log \mathcal{L} = \log P(D | \vec{\theta}, M)=  - \frac{\chi^2}{2} + C@f].
-             * @note: all observables are recalculated
+             * @note: Only the observables whose parameters or kinematics have changed are recalculated, and
+             *        only the blocks for which any of these predictions have changed are re-evaluated.
              */
             double operator() () const;
+
+            /*!
+             * Compute the gradient of the log likelihood with respect to a set of parameters at their current values.
+             *
+             * The derivatives of the blocks with respect to their observables are computed analytically where
+             * available, and the derivatives of the observables with respect to the parameters are computed
+             * by finite differences. Only the observables which use a parameter are re-evaluated, and the
+             * derivative with respect to a parameter that is not used by any observable vanishes without any
+             * further evaluation. Blocks without analytic derivatives are differentiated as a whole.
+             *
+             * @param parameters The parameters with respect to which the log likelihood shall be differentiated.
+             * @param gradient   The buffer receiving one derivative per parameter.
+             *
+             * @note The parameters are restored to their current values.
+             */
+            void gradient(const std::vector<Parameter> & parameters, std::span<double> gradient) const;
             ///@}
     };
 
@@ -22,17 +22,86 @@
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/log-posterior_TEST.hh>
 #include <eos/statistics/test-statistic-impl.hh>
+#include <eos/utils/thread.hh>
 
 #include <test/test.hh>
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 using namespace test;
 using namespace eos;
 
 namespace eos
 {
+    // Forwards to another block, and counts the evaluations
+    struct CountingBlock : public LogLikelihoodBlock
+    {
+            LogLikelihoodBlockPtr block;
+
+            std::shared_ptr<unsigned> evaluations;
+
+            CountingBlock(const LogLikelihoodBlockPtr & block, const std::shared_ptr<unsigned> & evaluations) :
+                block(block),
+                evaluations(evaluations)
+            {
+            }
+
+            virtual ~CountingBlock() {}
+
+            virtual std::string
+            as_string() const
+            {
+                return block->as_string();
+            }
+
+            virtual LogLikelihoodBlockPtr
+            clone(ObservableCache cache) const
+            {
+                return LogLikelihoodBlockPtr(new CountingBlock(block->clone(cache), evaluations));
+            }
+
+            virtual double
+            evaluate() const
+            {
+                ++*evaluations;
+
+                return block->evaluate();
+            }
+
+            virtual bool
+            observable_ids(std::vector<ObservableCache::ObservableId> & ids) const
+            {
+                return block->observable_ids(ids);
+            }
+
+            virtual unsigned
+            number_of_observations() const
+            {
+                return block->number_of_observations();
+            }
+
+            virtual double
+            sample(gsl_rng * rng) const
+            {
+                return block->sample(rng);
+            }
+
+            virtual double
+            significance() const
+            {
+                return block->significance();
+            }
+
+            virtual TestStatistic
+            primary_test_statistic() const
+            {
+                return block->primary_test_statistic();
+            }
+    };
+
     class LogLikelihoodTest : public TestCase
     {
         public:
@@ -115,6 +184,63 @@ namespace eos
                     TEST_CHECK_NEARLY_EQUAL(llh2(), -3.116353440210579, eps);
                 }
 
+                // incremental evaluation: only the blocks whose predictions changed are re-evaluated
+                {
+                    Parameters p = Parameters::Defaults();
+                    p["mass::b(MSbar)"] = 4.2;
+                    p["mass::c"]        = 1.2;
+
+                    LogLikelihood   llh(p);
+                    ObservableCache cache = llh.observable_cache();
+
+                    auto mb = ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k));
+                    auto mc = ObservablePtr(new ObservableStub(p, "mass::c", k));
+
+                    auto evaluations_b = std::make_shared<unsigned>(0), evaluations_c = std::make_shared<unsigned>(0);
+                    llh.add(LogLikelihoodBlockPtr(new CountingBlock(LogLikelihoodBlock::Gaussian(cache, mb, +4.1, +4.2, +4.3), evaluations_b)));
+                    llh.add(LogLikelihoodBlockPtr(new CountingBlock(LogLikelihoodBlock::Gaussian(cache, mc, +1.15, +1.2, +1.25), evaluations_c)));
+
+                    const double norm_b = -std::log(std::sqrt(2.0 * M_PI) * 0.1), norm_c = -std::log(std::sqrt(2.0 * M_PI) * 0.05);
+
+                    TEST_CHECK_NEARLY_EQUAL(llh(), norm_b + norm_c, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 1u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 1u);
+
+                    // nothing changed
+                    TEST_CHECK_NEARLY_EQUAL(llh(), norm_b + norm_c, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 1u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 1u);
+
+                    // only m_c changed
+                    p["mass::c"] = 1.25;
+                    TEST_CHECK_NEARLY_EQUAL(llh(), norm_b + norm_c - 0.5, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 1u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 2u);
+                    TEST_CHECK_EQUAL(cache.generation(ObservableCache::ObservableId(0)) < cache.generation(), true);
+                    TEST_CHECK_EQUAL(cache.generation(ObservableCache::ObservableId(1)), cache.generation());
+
+                    // m_b set to its current value
+                    p["mass::b(MSbar)"] = 4.2;
+                    TEST_CHECK_NEARLY_EQUAL(llh(), norm_b + norm_c - 0.5, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 1u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 2u);
+
+                    // only m_b changed
+                    p["mass::b(MSbar)"] = 4.0;
+                    TEST_CHECK_NEARLY_EQUAL(llh(), norm_b + norm_c - 2.5, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 2u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 2u);
+
+                    // adding a block does not require to re-evaluate the others
+                    auto evaluations_e = std::make_shared<unsigned>(0);
+                    auto me            = ObservablePtr(new ObservableStub(p, "mass::e", k));
+                    llh.add(LogLikelihoodBlockPtr(new CountingBlock(LogLikelihoodBlock::Gaussian(cache, me, p["mass::e"] - 0.1, p["mass::e"], p["mass::e"] + 0.1), evaluations_e)));
+                    TEST_CHECK_NEARLY_EQUAL(llh(), 2.0 * norm_b + norm_c - 2.5, 1e-12);
+                    TEST_CHECK_EQUAL(*evaluations_b, 2u);
+                    TEST_CHECK_EQUAL(*evaluations_c, 2u);
+                    TEST_CHECK_EQUAL(*evaluations_e, 1u);
+                }
+
                 // iteration
                 {
                     std::cout << "FOO" << std::endl;
@@ -625,6 +751,78 @@ namespace eos
                     TEST_CHECK_RELATIVE_ERROR(mvg_covariance->evaluate(), mvg_correlation->evaluate(), eps);
                 }
 
+                // multivariate gaussian with many measurements of two observables
+                {
+                    ObservableCache            cache(p);
+                    std::vector<ObservablePtr> obs{ ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), ObservablePtr(new ObservableStub(p, "mass::c", k)) };
+
+                    // six measurements of each observable; the measurements are pairwise correlated
+                    const unsigned                       n = 12;
+                    std::array<std::array<double, 2>, 2> covariance{
+                        { { 0.01, 0.003 }, { 0.003, 0.0025 } }
+                    };
+
+                    gsl_vector * mean          = gsl_vector_alloc(n);
+                    gsl_matrix * covariance_12 = gsl_matrix_calloc(n, n);
+                    gsl_matrix * response      = gsl_matrix_calloc(n, 2);
+                    std::vector<LogLikelihoodBlockPtr> pairs;
+                    for (unsigned i = 0; i < n / 2; ++i)
+                    {
+                        const std::array<double, 2> pair_mean{ { 4.3 + 0.02 * i, 1.1 - 0.01 * i } };
+                        for (unsigned j = 0; j < 2; ++j)
+                        {
+                            gsl_vector_set(mean, 2 * i + j, pair_mean[j]);
+                            gsl_matrix_set(response, 2 * i + j, j, 1.0);
+                            for (unsigned l = 0; l < 2; ++l)
+                            {
+                                gsl_matrix_set(covariance_12, 2 * i + j, 2 * i + l, covariance[j][l]);
+                            }
+                        }
+
+                        pairs.push_back(LogLikelihoodBlock::MultivariateGaussian<2>(cache, { obs[0], obs[1] }, pair_mean, covariance));
+                    }
+
+                    auto block = LogLikelihoodBlock::MultivariateGaussian(cache, obs, mean, covariance_12, response, n);
+
+                    p["mass::b(MSbar)"] = 4.35;
+                    p["mass::c"]        = 1.2;
+                    cache.update();
+
+                    double              reference = 0.0;
+                    std::vector<double> reference_gradient(cache.size(), 0.0);
+                    for (const auto & pair : pairs)
+                    {
+                        reference += pair->evaluate();
+                        TEST_CHECK(pair->add_gradient(reference_gradient));
+                    }
+                    TEST_CHECK_RELATIVE_ERROR(block->evaluate(), reference, 1e-12);
+
+                    std::vector<double> gradient(cache.size(), 0.0);
+                    TEST_CHECK(block->add_gradient(gradient));
+                    for (unsigned i = 0; i < gradient.size(); ++i)
+                    {
+                        TEST_CHECK_RELATIVE_ERROR(gradient[i], reference_gradient[i], 1e-12);
+                    }
+
+                    // the block can be evaluated concurrently
+                    std::vector<double> results(4 * 100);
+                    {
+                        std::vector<std::unique_ptr<Thread>> threads;
+                        for (unsigned t = 0; t < 4; ++t)
+                        {
+                            threads.push_back(std::make_unique<Thread>(
+                                    [&, t]()
+                                    {
+                                        for (unsigned i = 0; i < 100; ++i)
+                                        {
+                                            results[t * 100 + i] = block->evaluate();
+                                        }
+                                    }));
+                        }
+                    }
+                    TEST_CHECK(std::all_of(results.cbegin(), results.cend(), [&](const double & r) { return r == block->evaluate(); }));
+                }
+
                 // bootstrap p-value calculation
                 {
                     Parameters    parameters = Parameters::Defaults();
@@ -642,6 +840,37 @@ namespace eos
                     TEST_CHECK_NEARLY_EQUAL(p_value, 0.852143788, 5e-3);
                 }
 
+                // pseudo experiments
+                {
+                    Parameters    parameters = Parameters::Defaults();
+                    LogLikelihood llh(parameters);
+                    llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.182, 1.192, 1.202);
+                    llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                    llh();
+
+                    // more toys than fit into a single chunk
+                    const unsigned long toys = 5000;
+                    std::vector<double> t1(toys), t2(toys);
+                    llh.simulate(17, t1);
+                    llh.simulate(17, t2);
+                    TEST_CHECK(t1 == t2);
+                    TEST_CHECK(std::all_of(t1.cbegin(), t1.cend(), [](const double & t) { return std::isfinite(t); }));
+
+                    // the chunks are streamed in order, and cover all toys
+                    std::vector<double> t3;
+                    llh.simulate(toys, 17,
+                                 [&](const unsigned long & first, std::span<const double> chunk)
+                                 {
+                                     TEST_CHECK_EQUAL(first, t3.size());
+                                     t3.insert(t3.end(), chunk.begin(), chunk.end());
+                                 });
+                    TEST_CHECK(t1 == t3);
+
+                    // a different seed yields different pseudo experiments
+                    llh.simulate(18, t2);
+                    TEST_CHECK(t1 != t2);
+                }
+
                 // mixture density
                 {
                     ObservableCache cache(p);
@@ -1060,11 +1289,193 @@ namespace eos
                 TEST_CHECK_NO_THROW(block->primary_test_statistic());
                 TEST_CHECK_NO_THROW(block->clone(cache));
 
-                // sample() and significance() are not implemented and must throw
-                gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
-                TEST_CHECK_THROWS(InternalError, block->sample(rng));
-                gsl_rng_free(rng);
+                // sampling a batch is equivalent to sampling one pseudo experiment at a time
+                {
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+
+                    gsl_rng_set(rng, 1234);
+                    std::vector<double> batch(3);
+                    block->sample_batch(rng, batch);
+
+                    gsl_rng_set(rng, 1234);
+                    for (const auto & b : batch)
+                    {
+                        TEST_CHECK(std::isfinite(b));
+                        TEST_CHECK_EQUAL(block->sample(rng), b);
+                    }
+
+                    gsl_rng_free(rng);
+                }
+
+                // significance() is not implemented and must throw
                 TEST_CHECK_THROWS(InternalError, block->significance());
             }
     } unbinned_log_likelihood_test;
+
+    class BinnedPoissonLogLikelihoodTest : public TestCase
+    {
+        public:
+            BinnedPoissonLogLikelihoodTest() :
+                TestCase("binned_poisson_log_likelihood_test")
+            {
+            }
+
+            virtual void
+            run() const
+            {
+                // A single channel with two bins, and two samples. The reference values have been
+                // computed independently with the HistFactory model as implemented by pyhf.
+                static const std::string workspace = R"({
+                    "channels": [ { "name": "single_channel", "samples": [
+                        { "name": "signal", "data": [ 5.0, 10.0 ], "modifiers": [
+                            { "name": "mu",       "type": "normfactor", "data": null },
+                            { "name": "sig_norm", "type": "normsys",    "data": { "hi": 1.1, "lo": 0.85 } },
+                            { "name": "stat_unc", "type": "staterror",  "data": [ 1.0, 2.0 ] } ] },
+                        { "name": "background", "data": [ 50.0, 60.0 ], "modifiers": [
+                            { "name": "bkg_unc",   "type": "histosys",  "data": { "hi_data": [ 45.0, 54.0 ], "lo_data": [ 55.0, 66.0 ] } },
+                            { "name": "stat_unc",  "type": "staterror", "data": [ 10.0, 12.0 ] },
+                            { "name": "shape_unc", "type": "shapesys",  "data": [ 10.0, 12.0 ] } ] } ] } ],
+                    "observations": [ { "name": "single_channel", "data": [ 60.0, 80.0 ] } ],
+                    "measurements": [ { "name": "measurement", "config": { "poi": "mu", "parameters": [
+                        { "name": "mu", "bounds": [ [ 0.0, 10.0 ] ], "inits": [ 1.0 ] } ] } } ],
+                    "version": "1.0.0"
+                })";
+
+                Parameters      p = Parameters::Defaults();
+                ObservableCache cache(p);
+
+                auto block = LogLikelihoodBlock::BinnedPoisson(cache, workspace, { { "shape_unc[1]", QualifiedName("pyhf::shape[1]") } });
+                TEST_CHECK_EQUAL(block->number_of_observations(), 2u);
+
+                // the parameters are declared with the suggested initial values
+                TEST_CHECK_EQUAL(p["pyhf::mu"].evaluate(), 1.0);
+                TEST_CHECK_EQUAL(p["pyhf::sig_norm"].evaluate(), 0.0);
+                TEST_CHECK_EQUAL(p["pyhf::stat_unc[0]"].evaluate(), 1.0);
+                TEST_CHECK_EQUAL(p["pyhf::shape[1]"].evaluate(), 1.0);
+                TEST_CHECK(! p.has("pyhf::shape_unc[1]"));
+
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.9816872314683, 1e-12);
+
+                // interpolation in the interior
+                p["pyhf::mu"]          = 2.0;
+                p["pyhf::bkg_unc"]     = 0.5;
+                p["pyhf::sig_norm"]    = -0.3;
+                p["pyhf::stat_unc[0]"] = 1.1;
+                p["pyhf::shape[1]"]    = 0.9;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.761322510241882, 1e-12);
+
+                // extrapolation
+                p["pyhf::mu"]          = 1.0;
+                p["pyhf::bkg_unc"]     = -1.7;
+                p["pyhf::sig_norm"]    = 1.4;
+                p["pyhf::stat_unc[0]"] = 1.0;
+                p["pyhf::shape[1]"]    = 1.0;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.236206735018072, 1e-12);
+
+                // clones evaluate to the same value
+                {
+                    ObservableCache clone_cache(p);
+                    auto            clone = block->clone(clone_cache);
+                    clone_cache.update();
+                    TEST_CHECK_EQUAL(clone->evaluate(), block->evaluate());
+                }
+
+                // pseudo experiments
+                {
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, 1234);
+
+                    std::vector<double> toys(1000);
+                    block->sample_batch(rng, toys);
+                    TEST_CHECK(std::all_of(toys.cbegin(), toys.cend(), [](const double & t) { return std::isfinite(t); }));
+
+                    gsl_rng_free(rng);
+                }
+
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::BinnedPoisson(cache, R"({ "channels": [ { "name": "c", "samples": [] } ], "observations": [] })"));
+            }
+    } binned_poisson_log_likelihood_test;
+
+    class UnbinnedFactorizedLogLikelihoodTest : public TestCase
+    {
+        public:
+            UnbinnedFactorizedLogLikelihoodTest() :
+                TestCase("unbinned_factorized_log_likelihood_test")
+            {
+            }
+
+            virtual void
+            run() const
+            {
+                static const QualifiedName pdf_name("B->K^*ll::P(q2,cos(theta_l),cos(theta_K),phi)");
+                static const Options       options{ { "model"_ok, "WET"_ov }, { "l"_ok, "mu"_ov } };
+
+                Parameters                p = Parameters::Defaults();
+                const std::vector<double> q2_grid{ 1.1, 2.0, 4.0, 6.0 };
+
+                // two events at the same q2 on the grid, for which the interpolation is exact
+                const std::vector<double> event_1{ 2.0, +0.3, -0.5, +1.2 };
+                const std::vector<double> event_2{ 2.0, -0.7, +0.2, -2.4 };
+
+                ObservableCache cache_1(p), cache_2(p);
+                auto            block_1 = LogLikelihoodBlock::UnbinnedFactorized(cache_1, pdf_name, options, q2_grid, event_1);
+                auto            block_2 = LogLikelihoodBlock::UnbinnedFactorized(cache_2, pdf_name, options, q2_grid, event_2);
+                TEST_CHECK_EQUAL(block_1->number_of_observations(), 1u);
+
+                cache_1.update();
+                cache_2.update();
+
+                // the normalisation cancels in the ratio of the densities, which must match the full signal PDF
+                {
+                    auto unnormalized_pdf = [&](const std::vector<double> & event) -> double
+                    {
+                        Kinematics k{
+                            { "q2", event[0] }, { "cos(theta_l)", event[1] }, { "cos(theta_K)", event[2] }, { "phi", event[3] }
+                        };
+
+                        return Observable::make("B->K^*ll::UnnormalizedPDF(q2,cos(theta_l),cos(theta_K),phi)", p, k, options + Options{ { "tag"_ok, "BFS2004"_ov } })->evaluate();
+                    };
+
+                    TEST_CHECK_RELATIVE_ERROR(block_1->evaluate() - block_2->evaluate(), std::log(unnormalized_pdf(event_1) / unnormalized_pdf(event_2)), 1e-8);
+                }
+
+                // several events evaluate to the sum of their individual log-likelihoods
+                {
+                    std::vector<double> events(event_1);
+                    events.insert(events.end(), event_2.cbegin(), event_2.cend());
+
+                    ObservableCache cache(p);
+                    auto            block = LogLikelihoodBlock::UnbinnedFactorized(cache, pdf_name, options, q2_grid, events);
+                    cache.update();
+                    TEST_CHECK_EQUAL(block->number_of_observations(), 2u);
+                    TEST_CHECK_RELATIVE_ERROR(block->evaluate(), block_1->evaluate() + block_2->evaluate(), 1e-12);
+
+                    ObservableCache clone_cache(p);
+                    auto            clone = block->clone(clone_cache);
+                    clone_cache.update();
+                    TEST_CHECK_EQUAL(clone->evaluate(), block->evaluate());
+
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, 1234);
+
+                    std::vector<double> toys(100);
+                    block->sample_batch(rng, toys);
+                    TEST_CHECK(std::all_of(toys.cbegin(), toys.cend(), [](const double & t) { return std::isfinite(t); }));
+
+                    gsl_rng_free(rng);
+
+                    TEST_CHECK_THROWS(InternalError, block->significance());
+                }
+
+                // invalid inputs
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::UnbinnedFactorized(cache_1, "B->Kll::PDF(q2,cos(theta_l))", options, q2_grid, event_1));
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::UnbinnedFactorized(cache_1, pdf_name, options, { 2.0 }, event_1));
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::UnbinnedFactorized(cache_1, pdf_name, options, { 2.0, 1.1, 4.0 }, event_1));
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::UnbinnedFactorized(cache_1, pdf_name, options, q2_grid, std::vector<double>{ 2.0, 0.3, -0.5 }));
+                TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::UnbinnedFactorized(cache_1, pdf_name, options, q2_grid, std::vector<double>{ 7.0, 0.3, -0.5, 1.2 }));
+            }
+    } unbinned_factorized_log_likelihood_test;
 } // namespace eos
@@ -21,13 +21,19 @@
 #include <eos/maths/power-of.hh>
 #include <eos/statistics/log-posterior.hh>
 #include <eos/utils/density-impl.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <gsl/gsl_cdf.h>
 
 #include <algorithm>
 #include <config.h>
+#include <exception>
+#include <limits>
 
 namespace eos
 {
@@ -39,10 +45,111 @@ namespace eos
             }
     };
 
+    template <> struct Implementation<LogPosterior>
+    {
+            Mutex mutex;
+
+            // one clone per worker, created on demand
+            std::vector<LogPosteriorPtr> clones;
+
+            // evaluate a function of the clones for a batch of points, distributed among the clones
+            template <typename EvaluatePoint_>
+            void
+            evaluate_batch(const LogPosterior & posterior, std::span<const double> points, std::span<double> results, const EvaluatePoint_ & evaluate_point, const char * caller)
+            {
+                const std::size_t dim = posterior._varied_parameters.size();
+                const std::size_t n   = results.size();
+
+                if (0 == dim)
+                {
+                    throw InternalError(std::string(caller) + ": prior is undefined");
+                }
+
+                if (points.size() != n * dim)
+                {
+                    throw InternalError(std::string(caller) + ": expected " + stringify(n * dim) + " values for " + stringify(n) + " points, got "
+                                        + stringify(points.size()));
+                }
+
+                if (0 == n)
+                {
+                    return;
+                }
+
+                Lock l(mutex);
+
+                // within a job of the thread pool, the batch is evaluated serially on a single clone
+                const std::size_t workers = ThreadPool::instance()->is_worker_thread() ? 1 : std::min<std::size_t>(ThreadPool::instance()->number_of_threads(), n);
+                while (clones.size() < workers)
+                {
+                    clones.push_back(posterior.clone());
+                }
+
+                // the clones might lag behind changes to our parameters since their creation
+                for (std::size_t w = 0; w < workers; ++w)
+                {
+                    auto clone_parameters = clones[w]->parameters();
+                    for (const auto & p : posterior._parameters)
+                    {
+                        clone_parameters[p.id()].set(p.evaluate());
+                    }
+                }
+
+                const std::size_t               chunk_size = (n + workers - 1) / workers;
+                std::vector<std::exception_ptr> errors(workers);
+
+                auto evaluate_chunk = [&](const unsigned & w)
+                {
+                    LogPosterior & clone = *clones[w];
+                    const auto     begin = w * chunk_size;
+                    const auto     end   = std::min(begin + chunk_size, n);
+
+                    try
+                    {
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            try
+                            {
+                                results[i] = evaluate_point(clone, points.subspan(i * dim, dim));
+                            }
+                            catch (eos::Exception & e)
+                            {
+                                Log::instance()->message(caller, ll_error) << "Encountered run time error (" << e.what() << ") when evaluating point " << i;
+                                results[i] = -std::numeric_limits<double>::infinity();
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[w] = std::current_exception();
+                    }
+                };
+
+                // the likelihood of each clone is evaluated serially within its job, since it is updated from a worker of the thread pool
+                if (1 == workers)
+                {
+                    evaluate_chunk(0);
+                }
+                else
+                {
+                    ThreadPool::instance()->enqueue_range(workers, evaluate_chunk).wait();
+                }
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+    };
+
     LogPosterior::LogPosterior(const LogLikelihood & log_likelihood) :
         _log_likelihood(log_likelihood),
         _parameters(log_likelihood.parameters()),
-        _informative_priors(0)
+        _informative_priors(0),
+        _imp(new Implementation<LogPosterior>())
     {
     }
 
@@ -82,6 +189,12 @@ namespace eos
             _varied_parameters.push_back(*p);
         }
 
+        // existing clones lack the new prior
+        {
+            Lock l(_imp->mutex);
+            _imp->clones.clear();
+        }
+
         return true;
     }
 
@@ -107,6 +220,121 @@ namespace eos
         return log_posterior();
     }
 
+    void
+    LogPosterior::evaluate_batch(std::span<const double> u_points, std::span<double> results) const
+    {
+        auto evaluate_point = [](LogPosterior & clone, std::span<const double> u) -> double
+        {
+            if (std::any_of(u.begin(), u.end(), [](const double & v) { return (v < 0.0) || (v >= 1.0); }))
+            {
+                return -std::numeric_limits<double>::infinity();
+            }
+
+            clone.set_generators(u);
+
+            return clone.evaluate();
+        };
+
+        _imp->evaluate_batch(*this, u_points, results, evaluate_point, "LogPosterior::evaluate_batch");
+    }
+
+    void
+    LogPosterior::evaluate_log_likelihood_batch(std::span<const double> points, std::span<double> results) const
+    {
+        auto evaluate_point = [](LogPosterior & clone, std::span<const double> point) -> double
+        {
+            for (std::size_t k = 0; k < point.size(); ++k)
+            {
+                clone._varied_parameters[k].set(point[k]);
+            }
+
+            return clone._log_likelihood();
+        };
+
+        _imp->evaluate_batch(*this, points, results, evaluate_point, "LogPosterior::evaluate_log_likelihood_batch");
+    }
+
+    void
+    LogPosterior::set_generators(std::span<const double> u)
+    {
+        if (u.size() != _varied_parameters.size())
+        {
+            throw InternalError("LogPosterior::set_generators: expected " + stringify(_varied_parameters.size()) + " generator values, got " + stringify(u.size()));
+        }
+
+        for (std::size_t i = 0; i < u.size(); ++i)
+        {
+            _varied_parameters[i].set_generator(u[i]);
+        }
+
+        for (const auto & prior : _priors)
+        {
+            prior->sample();
+        }
+    }
+
+    void
+    LogPosterior::inverse_cdf_jacobian(std::span<double> jacobian) const
+    {
+        const std::size_t dim = _varied_parameters.size();
+
+        if (jacobian.size() != dim * dim)
+        {
+            throw InternalError("LogPosterior::inverse_cdf_jacobian: expected a buffer for " + stringify(dim * dim) + " derivatives, got " + stringify(jacobian.size()));
+        }
+
+        std::fill(jacobian.begin(), jacobian.end(), 0.0);
+
+        // the varied parameters are ordered prior by prior
+        std::size_t offset = 0;
+        for (const auto & prior : _priors)
+        {
+            const auto        block = prior->inverse_cdf_jacobian();
+            const std::size_t n     = std::distance(prior->begin(), prior->end());
+
+            if (block.size() != n * n)
+            {
+                throw InternalError("LogPosterior::inverse_cdf_jacobian: a prior provides " + stringify(block.size()) + " derivatives for " + stringify(n) + " parameters");
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    jacobian[(offset + i) * dim + offset + j] = block[i * n + j];
+                }
+            }
+
+            offset += n;
+        }
+    }
+
+    void
+    LogPosterior::gradient(std::span<double> gradient) const
+    {
+        if (_priors.empty())
+        {
+            throw InternalError("LogPosterior::gradient: prior is undefined");
+        }
+
+        if (gradient.size() != _varied_parameters.size())
+        {
+            throw InternalError("LogPosterior::gradient: expected a buffer for " + stringify(_varied_parameters.size()) + " derivatives, got " + stringify(gradient.size()));
+        }
+
+        _log_likelihood.gradient(_varied_parameters, gradient);
+
+        // the varied parameters are ordered prior by prior
+        std::size_t k = 0;
+        for (const auto & prior : _priors)
+        {
+            for (const auto & d : prior->gradient())
+            {
+                gradient[k++] += d;
+            }
+        }
+    }
+
     Parameters
     LogPosterior::parameters() const
     {
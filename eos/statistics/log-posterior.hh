@@ -30,7 +30,9 @@
 #include <eos/utils/wrapped_forward_iterator.hh>
 
 #include <config.h>
+#include <memory>
 #include <set>
+#include <span>
 #include <vector>
 
 namespace eos
@@ -54,6 +56,9 @@ namespace eos
             /// Parameters with priors
             std::vector<Parameter> _varied_parameters;
 
+            /// Clones used to evaluate batches of points, shared among copies of this object
+            std::shared_ptr<Implementation<LogPosterior>> _imp;
+
         public:
             friend struct Implementation<LogPosterior>;
 
@@ -79,6 +84,69 @@ namespace eos
 
             /// Evaluate the Log(posterior) density at the current parameter values.
             virtual double evaluate() const;
+
+            /*!
+             * Evaluate the Log(posterior) density for a batch of points in the generator space [0, 1)^D.
+             *
+             * The points are distributed among several clones of this posterior, which are kept
+             * for subsequent batches and which evaluate their points concurrently. The values
+             * of this posterior's parameters remain unchanged.
+             *
+             * The density is -inf for points outside the unit hypercube and for points at which
+             * the evaluation raises an exception.
+             *
+             * @param u_points The points, with D generator values per point in the order of varied_parameters().
+             * @param results  The buffer receiving one value per point.
+             */
+            void evaluate_batch(std::span<const double> u_points, std::span<double> results) const;
+
+            /*!
+             * Evaluate the Log(likelihood) for a batch of points in the parameter space.
+             *
+             * As evaluate_batch(), the points are distributed among the clones of this posterior.
+             * The Log(prior) density is omitted, since nested samplers account for the prior through
+             * their mapping from the generator space onto the parameter space.
+             *
+             * The density is -inf for points at which the evaluation raises an exception.
+             *
+             * @param points  The points, with D parameter values per point in the order of varied_parameters().
+             * @param results The buffer receiving one value per point.
+             */
+            void evaluate_log_likelihood_batch(std::span<const double> points, std::span<double> results) const;
+
+            /*!
+             * Set the varied parameters from a point in the generator space [0, 1)^D.
+             *
+             * The generator values are mapped onto the parameter values through the
+             * priors' inverse CDFs.
+             *
+             * @param u The generator values, in the order of varied_parameters().
+             */
+            void set_generators(std::span<const double> u);
+
+            /*!
+             * Compute the Jacobian of the mapping from the generator space [0, 1)^D onto the
+             * varied parameters at the current generator values, cf. set_generators().
+             *
+             * The derivatives are provided natively by the priors' inverse CDFs. The Jacobian is
+             * block diagonal, with one block per prior.
+             *
+             * @param jacobian The buffer receiving the D x D derivatives in row-major order, with the derivative
+             *                 of the i-th varied parameter with respect to the j-th generator value at index i * D + j.
+             */
+            void inverse_cdf_jacobian(std::span<double> jacobian) const;
+
+            /*!
+             * Compute the gradient of the Log(posterior) density with respect to the varied parameters
+             * at their current values.
+             *
+             * The derivatives of the priors and of the Gaussian, LogGamma, and multivariate Gaussian
+             * likelihood blocks are computed analytically. The derivatives of the observables are
+             * computed by finite differences, cf. LogLikelihood::gradient().
+             *
+             * @param gradient The buffer receiving one derivative per varied parameter, in the order of varied_parameters().
+             */
+            void gradient(std::span<double> gradient) const;
             ///@}
 
             ///@name Accessors
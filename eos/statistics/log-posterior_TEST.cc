@@ -21,6 +21,8 @@
 #include <eos/statistics/log-posterior_TEST.hh>
 
 #include <config.h>
+#include <limits>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -117,6 +119,157 @@ class LogPosteriorTest : public TestCase
                 TEST_CHECK_EQUAL(log_posterior.log_prior(), clone->log_prior());
             }
 
+            // batch evaluation in the generator space
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.2, 1.25, 1.3);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::CurtailedGauss(parameters, "mass::b(MSbar)", 3.7, 4.9, 4.3, 4.4, 4.5));
+
+                std::vector<double> u_points;
+                for (unsigned i = 0; i < 40; ++i)
+                {
+                    u_points.push_back((i + 0.5) / 40.0);
+                }
+                u_points.push_back(-0.1);
+                u_points.push_back(1.0);
+
+                Parameter           m_b = log_posterior[0];
+                const double        m_b_before = m_b.evaluate();
+                std::vector<double> results(u_points.size());
+                log_posterior.evaluate_batch(u_points, results);
+
+                // the parameters of the posterior remain unchanged
+                TEST_CHECK_EQUAL(m_b.evaluate(), m_b_before);
+
+                auto reference = log_posterior.clone();
+                for (unsigned i = 0; i < 40; ++i)
+                {
+                    reference->set_generators(std::span<const double>(&u_points[i], 1));
+                    TEST_CHECK_RELATIVE_ERROR(results[i], reference->evaluate(), eps);
+                }
+                TEST_CHECK_EQUAL(results[40], -std::numeric_limits<double>::infinity());
+                TEST_CHECK_EQUAL(results[41], -std::numeric_limits<double>::infinity());
+
+                // changes to parameters that are not varied reach the clones
+                log_posterior.parameters()["mass::c"] = 1.3;
+                log_posterior.evaluate_batch(u_points, results);
+
+                reference = log_posterior.clone();
+                for (unsigned i = 0; i < 40; ++i)
+                {
+                    reference->set_generators(std::span<const double>(&u_points[i], 1));
+                    TEST_CHECK_RELATIVE_ERROR(results[i], reference->evaluate(), eps);
+                }
+
+                // the log(likelihood) in the parameter space omits the log(prior)
+                std::vector<double> m_b_points;
+                for (unsigned i = 0; i < 40; ++i)
+                {
+                    m_b_points.push_back(3.8 + i * 0.025);
+                }
+                log_posterior.evaluate_log_likelihood_batch(m_b_points, std::span<double>(results.data(), 40));
+
+                TEST_CHECK_EQUAL(m_b.evaluate(), m_b_before);
+
+                for (unsigned i = 0; i < 40; ++i)
+                {
+                    (*reference)[0].set(m_b_points[i]);
+                    TEST_CHECK_RELATIVE_ERROR(results[i], reference->log_likelihood()(), eps);
+                }
+
+                // mismatching buffer sizes
+                TEST_CHECK_THROWS(InternalError, log_posterior.evaluate_batch(std::span<const double>(u_points.data(), 3), std::span<double>(results.data(), 2)));
+                TEST_CHECK_THROWS(InternalError, log_posterior.evaluate_log_likelihood_batch(std::span<const double>(m_b_points.data(), 3), std::span<double>(results.data(), 2)));
+            }
+
+            // gradient
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                // m_b enters a Gaussian block, m_c and m_s a correlated multivariate Gaussian block
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(LogLikelihoodBlock::MultivariateGaussian<2>(llh.observable_cache(),
+                                                                    { ObservablePtr(new ObservableStub(parameters, "mass::c")), ObservablePtr(new ObservableStub(parameters, "mass::s(2GeV)")) },
+                                                                    { 1.25, 0.09 },
+                                                                    { { { 0.0025, 0.0001 }, { 0.0001, 0.0001 } } }));
+
+                // m_t is only constrained by its prior
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::CurtailedGauss(parameters, "mass::b(MSbar)", 3.7, 4.9, 4.3, 4.4, 4.5));
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.5));
+                log_posterior.add(LogPrior::Flat(parameters, "mass::s(2GeV)", 0.05, 0.15));
+                log_posterior.add(LogPrior::CurtailedGauss(parameters, "mass::t(pole)", 170.0, 176.0, 172.0, 173.0, 174.0));
+
+                const std::vector<double> point{ 4.25, 1.28, 0.095, 173.5 };
+                for (unsigned k = 0; k < point.size(); ++k)
+                {
+                    log_posterior[k].set(point[k]);
+                }
+
+                std::vector<double> gradient(point.size());
+                log_posterior.gradient(gradient);
+
+                // analytic results
+                const double d_c = 0.03, d_s = 0.005, det = 0.0025 * 0.0001 - 0.0001 * 0.0001;
+                TEST_CHECK_RELATIVE_ERROR(gradient[0], -(4.25 - 4.2) / 0.01 - (4.25 - 4.4) / 0.01, 1e-6);
+                TEST_CHECK_RELATIVE_ERROR(gradient[1], -(0.0001 * d_c - 0.0001 * d_s) / det, 1e-6);
+                TEST_CHECK_RELATIVE_ERROR(gradient[2], -(-0.0001 * d_c + 0.0025 * d_s) / det, 1e-6);
+                TEST_CHECK_RELATIVE_ERROR(gradient[3], -(173.5 - 173.0) / 1.0, 1e-6);
+
+                // the parameters remain unchanged
+                for (unsigned k = 0; k < point.size(); ++k)
+                {
+                    TEST_CHECK_EQUAL(log_posterior[k].evaluate(), point[k]);
+                }
+
+                // mismatching buffer size
+                TEST_CHECK_THROWS(InternalError, log_posterior.gradient(std::span<double>(gradient.data(), 3)));
+
+                // the Jacobian of the inverse CDFs is diagonal for four 1D priors
+                const std::vector<double> u{ 0.3, 0.4, 0.5, 0.6 };
+                log_posterior.set_generators(u);
+
+                std::vector<double> jacobian(u.size() * u.size());
+                log_posterior.inverse_cdf_jacobian(jacobian);
+
+                for (unsigned i = 0; i < u.size(); ++i)
+                {
+                    for (unsigned j = 0; j < u.size(); ++j)
+                    {
+                        if (i != j)
+                        {
+                            TEST_CHECK_EQUAL(jacobian[i * u.size() + j], 0.0);
+                        }
+                    }
+                }
+                TEST_CHECK_RELATIVE_ERROR(jacobian[1 * u.size() + 1], 0.5, 1e-14);
+                TEST_CHECK_RELATIVE_ERROR(jacobian[2 * u.size() + 2], 0.1, 1e-14);
+
+                // the Gaussian blocks agree with finite differences
+                for (const unsigned k : { 0u, 3u })
+                {
+                    const double        h    = 1e-6;
+                    std::vector<double> u_lo = u, u_hi = u;
+                    u_lo[k] -= h;
+                    u_hi[k] += h;
+
+                    log_posterior.set_generators(u_hi);
+                    const double x_hi = log_posterior[k].evaluate();
+                    log_posterior.set_generators(u_lo);
+                    const double x_lo = log_posterior[k].evaluate();
+
+                    TEST_CHECK_RELATIVE_ERROR(jacobian[k * u.size() + k], (x_hi - x_lo) / (2.0 * h), 1e-6);
+                }
+
+                TEST_CHECK_THROWS(InternalError, log_posterior.inverse_cdf_jacobian(std::span<double>(jacobian.data(), 4)));
+            }
+
             // stop if prior undefined
             {
                 Parameters parameters = Parameters::Defaults();
@@ -18,6 +18,7 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/derivative.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/statistics/log-prior.hh>
 #include <eos/utils/destringify.hh>
@@ -120,6 +121,12 @@ namespace eos
                     return _value;
                 }
 
+                virtual std::vector<double>
+                gradient() const
+                {
+                    return { 0.0 };
+                }
+
                 virtual LogPriorPtr
                 clone(const Parameters & parameters) const
                 {
@@ -132,6 +139,12 @@ namespace eos
                     _parameter.set(_parameter.evaluate_generator() * (_max - _min) + _min);
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    return { _max - _min };
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -243,6 +256,15 @@ namespace eos
                     return norm - 0.5 * power_of<2>((x - _central) / sigma);
                 }
 
+                virtual std::vector<double>
+                gradient() const
+                {
+                    const double x     = _parameter.evaluate();
+                    const double sigma = (x < _central) ? _sigma_lower : _sigma_upper;
+
+                    return { -(x - _central) / power_of<2>(sigma) };
+                }
+
                 virtual LogPriorPtr
                 clone(const Parameters & parameters) const
                 {
@@ -270,6 +292,19 @@ namespace eos
                     }
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    // dx/dp = 1 / F'(x) = 1 / (c N(x | x_{central}, \sigma)), with (c, \sigma) as in sample()
+                    const auto p = _parameter.evaluate_generator();
+
+                    const double c     = (p < _prob_lower) ? _c_b : _c_a;
+                    const double sigma = (p < _prob_lower) ? _sigma_lower : _sigma_upper;
+                    const double x     = gsl_cdf_gaussian_Pinv((p - _prob_lower) / c + 0.5, sigma);
+
+                    return { 1.0 / (c * gsl_ran_gaussian_pdf(x, sigma)) };
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -353,6 +388,19 @@ namespace eos
                     return 1.0 / (2.0 * _ln_lambda * x);
                 }
 
+                virtual std::vector<double>
+                gradient() const
+                {
+                    double x = _parameter.evaluate();
+
+                    if ((x < _min) || (_max < x))
+                    {
+                        return { 0.0 };
+                    }
+
+                    return { -1.0 / (2.0 * _ln_lambda * x * x) };
+                }
+
                 virtual LogPriorPtr
                 clone(const Parameters & parameters) const
                 {
@@ -368,6 +416,13 @@ namespace eos
                     _parameter.set(_mu_0 * std::pow(_lambda, 2.0 * _parameter.evaluate_generator() - 1.0));
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    // dx/dp = 2 \ln \lambda * \mu_0 * \lambda^(2 p - 1)
+                    return { 2.0 * _ln_lambda * _mu_0 * std::pow(_lambda, 2.0 * _parameter.evaluate_generator() - 1.0) };
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -442,6 +497,15 @@ namespace eos
                     _parameter.set(x);
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    const double u = _parameter.evaluate_generator();
+                    const double x = gsl_cdf_gaussian_Pinv(u, _sigma);
+
+                    return { 1.0 / gsl_ran_gaussian_pdf(x, _sigma) };
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -657,6 +721,21 @@ namespace eos
                     return _norm - 0.5 * chi_square;
                 }
 
+                virtual std::vector<double>
+                gradient() const
+                {
+                    // operator() leaves inv(covariance) * (mean - parameters) in _measurements_2
+                    (*this)();
+
+                    std::vector<double> result(_dim);
+                    for (auto i = 0u; i < _dim; ++i)
+                    {
+                        result[i] = gsl_vector_get(_measurements_2, i);
+                    }
+
+                    return result;
+                }
+
                 virtual LogPriorPtr
                 clone(const Parameters & parameters) const
                 {
@@ -693,6 +772,25 @@ namespace eos
                     }
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    // x = _chol * z + _mean with z_j = \Phi^{-1}(u_j), hence dx_i/du_j = _chol_{ij} / \phi(z_j)
+                    std::vector<double> result(_dim * _dim);
+                    for (auto j = 0u; j < _dim; ++j)
+                    {
+                        const double u    = _parameters[j].evaluate_generator();
+                        const double dzdu = 1.0 / gsl_ran_ugaussian_pdf(gsl_cdf_ugaussian_Pinv(u));
+
+                        for (auto i = 0u; i < _dim; ++i)
+                        {
+                            result[i * _dim + j] = gsl_matrix_get(_chol, i, j) * dzdu;
+                        }
+                    }
+
+                    return result;
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -766,6 +864,12 @@ namespace eos
                     return _ln_norm - lambda + _k * std::log(lambda);
                 }
 
+                virtual std::vector<double>
+                gradient() const
+                {
+                    return { _k / _parameter.evaluate() - _k };
+                }
+
                 virtual LogPriorPtr
                 clone(const Parameters & parameters) const
                 {
@@ -780,6 +884,15 @@ namespace eos
                     _parameter.set(lambda / _k);
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    const double u      = _parameter.evaluate_generator();
+                    const double lambda = gsl_cdf_gamma_Pinv(u, _k + 1.0, 1.0);
+
+                    return { 1.0 / (_k * gsl_ran_gamma_pdf(lambda, _k + 1.0, 1.0)) };
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -996,6 +1109,25 @@ namespace eos
                     }
                 }
 
+                virtual std::vector<double>
+                inverse_cdf_jacobian()
+                {
+                    // the sample is linear in the generator values: dx_i/du_j = _transform_{ij} * (max_j - min_j)
+                    const unsigned      dim = _parameters.size();
+                    std::vector<double> result(dim * dim);
+                    for (unsigned j = 0u; j < dim; ++j)
+                    {
+                        const double range = gsl_vector_get(_max, j) - gsl_vector_get(_min, j);
+
+                        for (unsigned i = 0u; i < dim; ++i)
+                        {
+                            result[i * dim + j] = gsl_matrix_get(_transform, i, j) * range;
+                        }
+                    }
+
+                    return result;
+                }
+
                 virtual void
                 compute_cdf()
                 {
@@ -1048,6 +1180,59 @@ namespace eos
         return LogPrior::Iterator(_varied_parameters.end());
     }
 
+    std::vector<double>
+    LogPrior::gradient() const
+    {
+        std::vector<double> result;
+        result.reserve(_varied_parameters.size());
+
+        for (Parameter p : _varied_parameters)
+        {
+            const double x0 = p.evaluate();
+            result.push_back(derivative<1u, deriv::TwoSided>(
+                    [&](const double & x) -> double
+                    {
+                        p.set(x);
+                        return (*this)();
+                    },
+                    x0));
+            p.set(x0);
+        }
+
+        return result;
+    }
+
+    std::vector<double>
+    LogPrior::inverse_cdf_jacobian()
+    {
+        const std::size_t   dim = _varied_parameters.size();
+        std::vector<double> result(dim * dim);
+
+        for (std::size_t j = 0; j < dim; ++j)
+        {
+            Parameter    p_j = _varied_parameters[j];
+            const double u_0 = p_j.evaluate_generator();
+
+            for (std::size_t i = 0; i < dim; ++i)
+            {
+                const Parameter p_i = _varied_parameters[i];
+                result[i * dim + j] = derivative<1u, deriv::TwoSided>(
+                        [&](const double & u) -> double
+                        {
+                            p_j.set_generator(u);
+                            this->sample();
+                            return p_i.evaluate();
+                        },
+                        u_0);
+            }
+
+            p_j.set_generator(u_0);
+        }
+        this->sample();
+
+        return result;
+    }
+
     LogPriorPtr
     LogPrior::Flat(const Parameters & parameters, const std::string & name, const double & min, const double & max)
     {
@@ -91,6 +91,14 @@ namespace eos
              */
             virtual double operator() () const = 0;
 
+            /*!
+             * Compute the derivatives of the natural logarithm of the prior with respect
+             * to its parameters, in the order of iteration.
+             *
+             * The default implementation uses finite differences.
+             */
+            virtual std::vector<double> gradient() const;
+
             /*!
              * Generate a prior sample from the inverse CDF and a set of generator values.
              *
@@ -99,6 +107,17 @@ namespace eos
              */
             virtual void sample() = 0;
 
+            /*!
+             * Compute the derivatives of the parameters with respect to their generator values,
+             * i.e., the Jacobian of the inverse CDF applied by sample(), at the current generator values.
+             *
+             * For n parameters in the order of iteration, the derivative of the i-th parameter with
+             * respect to the j-th generator value is stored at index i * n + j.
+             *
+             * The default implementation uses finite differences.
+             */
+            virtual std::vector<double> inverse_cdf_jacobian();
+
             /*!
              * Compute the vector of cummulative probabilities.
              *
@@ -27,6 +27,7 @@
 
 #include <cmath>
 #include <string>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -464,6 +465,57 @@ class LogPriorTest : public TestCase
                 TEST_CHECK_NEARLY_EQUAL((*c)(), (*mvg)(), eps);
             }
 
+            // C': inverse_cdf_jacobian() agrees with the finite differences of sample()
+            {
+                gsl_vector * mean = gsl_vector_alloc(2);
+                gsl_vector_set(mean, 0, 4.3);
+                gsl_vector_set(mean, 1, 1.1);
+                gsl_matrix * cov = gsl_matrix_alloc(2, 2);
+                gsl_matrix_set(cov, 0, 0, 0.01);
+                gsl_matrix_set(cov, 0, 1, 0.001);
+                gsl_matrix_set(cov, 1, 0, 0.001);
+                gsl_matrix_set(cov, 1, 1, 0.0025);
+
+                const std::vector<LogPriorPtr> priors{
+                    LogPrior::Flat(parameters, "mass::b(MSbar)", 4.2, 4.5),
+                    LogPrior::CurtailedGauss(parameters, "mass::b(MSbar)", 4.15, 4.57, 4.2, 4.3, 4.5),
+                    LogPrior::Scale(parameters, "mass::b(MSbar)", 2.0, 10.0, mu_0, lambda),
+                    LogPrior::Poisson(parameters, "mass::b(MSbar)", 3.0),
+                    LogPrior::MultivariateGaussian(parameters, { "mass::b(MSbar)", "mass::c" }, mean, cov),
+                    LogPrior::Transform(parameters, { "scnuee::Re{cVL}", "scnuee::Re{cVR}" }, { 0.1, -0.2 }, { { 0.8, 0.6 }, { -0.6, 0.8 } }, { -2.0, -1.0 }, { 2.0, 3.0 }),
+                };
+
+                // generator values on both sides of the central values
+                for (const auto & prior : priors)
+                {
+                    for (const auto & u : { std::vector<double>{ 0.05, 0.6 }, std::vector<double>{ 0.7, 0.2 } })
+                    {
+                        unsigned k = 0;
+                        for (auto p = prior->begin(), p_end = prior->end(); p != p_end; ++p)
+                        {
+                            p->set_generator(u[k++]);
+                        }
+
+                        const auto native    = prior->inverse_cdf_jacobian();
+                        const auto numerical = prior->LogPrior::inverse_cdf_jacobian();
+
+                        TEST_CHECK_EQUAL(native.size(), k * k);
+                        TEST_CHECK_EQUAL(numerical.size(), k * k);
+                        for (unsigned i = 0; i < native.size(); ++i)
+                        {
+                            TEST_CHECK_NEARLY_EQUAL(native[i], numerical[i], 1e-5 * std::max(1.0, std::abs(numerical[i])));
+                        }
+                    }
+                }
+
+                // the derivative of a 1D prior is the inverse of its density
+                LogPriorPtr cg    = priors[1];
+                Parameter   param = parameters["mass::b(MSbar)"];
+                param.set_generator(0.3);
+                cg->sample();
+                TEST_CHECK_RELATIVE_ERROR(cg->inverse_cdf_jacobian()[0], std::exp(-(*cg)()), 1e-12);
+            }
+
             // D: factory and constructor error paths
             {
                 // Flat: min >= max (RangeError, derived from Exception)
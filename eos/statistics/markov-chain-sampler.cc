@@ -0,0 +1,568 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_vector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <config.h>
+#include <exception>
+#include <limits>
+#include <memory>
+
+#ifdef EOS_USE_GSL_LINALG_CHOLESKY_DECOMP
+#  if (EOS_USE_GSL_LINALG_CHOLESKY_DECOMP == 1)
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp
+#  else
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp1
+#  endif
+#else
+#  error EOS_USE_GSL_LINALG_CHOLESKY_DECOMP not defined.
+#endif
+
+namespace eos
+{
+    MarkovChainSampler::Config::Config() :
+        _chains(4),
+        _preruns(3),
+        _prerun_samples(150),
+        _samples(1000),
+        _stride(5),
+        _cov_scale(0.1),
+        _seed(1701)
+    {
+    }
+
+    unsigned
+    MarkovChainSampler::Config::chains() const
+    {
+        return _chains;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::chains(const unsigned & x)
+    {
+        if (0 == x)
+        {
+            throw InternalError("MarkovChainSampler::Config: at least one chain is required");
+        }
+
+        _chains = x;
+
+        return *this;
+    }
+
+    unsigned
+    MarkovChainSampler::Config::preruns() const
+    {
+        return _preruns;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::preruns(const unsigned & x)
+    {
+        _preruns = x;
+
+        return *this;
+    }
+
+    unsigned
+    MarkovChainSampler::Config::prerun_samples() const
+    {
+        return _prerun_samples;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::prerun_samples(const unsigned & x)
+    {
+        _prerun_samples = x;
+
+        return *this;
+    }
+
+    unsigned
+    MarkovChainSampler::Config::samples() const
+    {
+        return _samples;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::samples(const unsigned & x)
+    {
+        _samples = x;
+
+        return *this;
+    }
+
+    unsigned
+    MarkovChainSampler::Config::stride() const
+    {
+        return _stride;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::stride(const unsigned & x)
+    {
+        if (0 == x)
+        {
+            throw InternalError("MarkovChainSampler::Config: the stride must be positive");
+        }
+
+        _stride = x;
+
+        return *this;
+    }
+
+    double
+    MarkovChainSampler::Config::cov_scale() const
+    {
+        return _cov_scale;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::cov_scale(const double & x)
+    {
+        if (! (x > 0.0))
+        {
+            throw InternalError("MarkovChainSampler::Config: the covariance scale must be positive");
+        }
+
+        _cov_scale = x;
+
+        return *this;
+    }
+
+    unsigned long
+    MarkovChainSampler::Config::seed() const
+    {
+        return _seed;
+    }
+
+    MarkovChainSampler::Config &
+    MarkovChainSampler::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+
+        return *this;
+    }
+
+    template <> struct Implementation<MarkovChainSampler>
+    {
+            // One adaptive Metropolis-Hastings chain operating on its own clone of the posterior
+            struct Chain
+            {
+                    LogPosteriorPtr log_posterior;
+
+                    std::vector<Parameter> parameters;
+
+                    unsigned dim;
+
+                    gsl_rng * rng;
+
+                    // lower-triangular Cholesky factor of the proposal covariance
+                    gsl_matrix * proposal;
+
+                    gsl_vector * step;
+
+                    // current point in u space and in parameter space, and its log(posterior)
+                    std::vector<double> u, x;
+
+                    double value;
+
+                    // candidate point in u space and in parameter space
+                    std::vector<double> u_candidate, x_candidate;
+
+                    // running mean and co-moments of all prerun samples
+                    unsigned long       moments_count;
+                    std::vector<double> mean, comoments, delta;
+
+                    // scale factor of the sample covariance within the proposal covariance
+                    double scale;
+
+                    Chain(const LogPosterior & log_posterior, const unsigned long & seed, const double & cov_scale) :
+                        log_posterior(log_posterior.clone()),
+                        parameters(this->log_posterior->varied_parameters()),
+                        dim(parameters.size()),
+                        rng(gsl_rng_alloc(gsl_rng_mt19937)),
+                        proposal(gsl_matrix_calloc(dim, dim)),
+                        step(gsl_vector_alloc(dim)),
+                        u(dim),
+                        x(dim),
+                        value(-std::numeric_limits<double>::infinity()),
+                        u_candidate(dim),
+                        x_candidate(dim),
+                        moments_count(0),
+                        mean(dim, 0.0),
+                        comoments(dim * dim, 0.0),
+                        delta(dim, 0.0),
+                        scale(2.38 * 2.38 / dim)
+                    {
+                        gsl_rng_set(rng, seed);
+
+                        // 1 / 12 is the variance of U(0, 1)
+                        for (unsigned i = 0; i < dim; ++i)
+                        {
+                            gsl_matrix_set(proposal, i, i, std::sqrt(cov_scale / 12.0));
+                        }
+                    }
+
+                    ~Chain()
+                    {
+                        gsl_vector_free(step);
+                        gsl_matrix_free(proposal);
+                        gsl_rng_free(rng);
+                    }
+
+                    // map u onto the parameter space and evaluate the log(posterior) there
+                    double
+                    log_target(const std::vector<double> & point, std::vector<double> & values)
+                    {
+                        for (const auto & v : point)
+                        {
+                            if ((v < 0.0) || (v >= 1.0))
+                            {
+                                return -std::numeric_limits<double>::infinity();
+                            }
+                        }
+
+                        try
+                        {
+                            log_posterior->set_generators(point);
+
+                            for (unsigned i = 0; i < dim; ++i)
+                            {
+                                values[i] = parameters[i].evaluate();
+                            }
+
+                            const double result = log_posterior->evaluate();
+
+                            return std::isnan(result) ? -std::numeric_limits<double>::infinity() : result;
+                        }
+                        catch (eos::Exception & e)
+                        {
+                            Log::instance()->message("MarkovChainSampler::log_target", ll_error)
+                                << "Encountered run time error (" << e.what() << ") when evaluating log(posterior); rejecting the point";
+
+                            return -std::numeric_limits<double>::infinity();
+                        }
+                    }
+
+                    // one Metropolis-Hastings step; returns true if the candidate is accepted
+                    bool
+                    advance()
+                    {
+                        for (unsigned i = 0; i < dim; ++i)
+                        {
+                            gsl_vector_set(step, i, gsl_ran_ugaussian(rng));
+                        }
+                        gsl_blas_dtrmv(CblasLower, CblasNoTrans, CblasNonUnit, proposal, step);
+
+                        for (unsigned i = 0; i < dim; ++i)
+                        {
+                            u_candidate[i] = u[i] + gsl_vector_get(step, i);
+                        }
+
+                        const double candidate_value = log_target(u_candidate, x_candidate);
+
+                        // the comparison fails if both values are -inf
+                        if (std::log(gsl_rng_uniform_pos(rng)) < candidate_value - value)
+                        {
+                            std::swap(u, u_candidate);
+                            std::swap(x, x_candidate);
+                            value = candidate_value;
+
+                            return true;
+                        }
+
+                        return false;
+                    }
+
+                    void
+                    accumulate()
+                    {
+                        // Welford's algorithm for the mean and the co-moments
+                        moments_count += 1;
+
+                        for (unsigned i = 0; i < dim; ++i)
+                        {
+                            delta[i]  = u[i] - mean[i];
+                            mean[i]  += delta[i] / moments_count;
+                        }
+
+                        for (unsigned i = 0; i < dim; ++i)
+                        {
+                            for (unsigned j = 0; j < dim; ++j)
+                            {
+                                comoments[i * dim + j] += delta[i] * (u[j] - mean[j]);
+                            }
+                        }
+                    }
+
+                    void
+                    adapt(const double & acceptance_rate)
+                    {
+                        const double old_scale = scale;
+
+                        // aim for an acceptance rate between 15% and 35%
+                        if (acceptance_rate > 0.35)
+                        {
+                            scale *= 1.5;
+                        }
+                        else if (acceptance_rate < 0.15)
+                        {
+                            scale /= 1.5;
+                        }
+                        scale = std::clamp(scale, 1.0e-4, 1.0e+2);
+
+                        if (moments_count > dim)
+                        {
+                            gsl_matrix * candidate = gsl_matrix_alloc(dim, dim);
+                            for (unsigned i = 0; i < dim; ++i)
+                            {
+                                for (unsigned j = 0; j < dim; ++j)
+                                {
+                                    gsl_matrix_set(candidate, i, j, scale * comoments[i * dim + j] / (moments_count - 1));
+                                }
+                            }
+
+                            // the sample covariance is singular if the chain has not moved in some direction
+                            gsl_error_handler_t * handler = gsl_set_error_handler_off();
+                            const int             status  = GSL_LINALG_CHOLESKY_DECOMP(candidate);
+                            gsl_set_error_handler(handler);
+
+                            if (GSL_SUCCESS == status)
+                            {
+                                for (unsigned i = 0; i < dim; ++i)
+                                {
+                                    for (unsigned j = 0; j < dim; ++j)
+                                    {
+                                        gsl_matrix_set(proposal, i, j, (j <= i) ? gsl_matrix_get(candidate, i, j) : 0.0);
+                                    }
+                                }
+                                gsl_matrix_free(candidate);
+
+                                return;
+                            }
+
+                            gsl_matrix_free(candidate);
+                        }
+
+                        // keep the shape of the previous proposal, but apply the change of scale
+                        gsl_matrix_scale(proposal, std::sqrt(scale / old_scale));
+                    }
+            };
+
+            LogPosterior log_posterior;
+
+            MarkovChainSampler::Config config;
+
+            unsigned dim;
+
+            Implementation(const LogPosterior & log_posterior, const MarkovChainSampler::Config & config) :
+                log_posterior(log_posterior),
+                config(config),
+                dim(log_posterior.varied_parameters().size())
+            {
+                if (0 == dim)
+                {
+                    throw InternalError("MarkovChainSampler: the posterior does not vary any parameter");
+                }
+            }
+
+            double
+            run_chain(Chain & chain, const double * start_point, double * samples, double * u_samples, double * log_posterior)
+            {
+                if (start_point)
+                {
+                    std::copy(start_point, start_point + dim, chain.u.begin());
+                }
+                else
+                {
+                    for (auto & v : chain.u)
+                    {
+                        v = gsl_rng_uniform(chain.rng);
+                    }
+                }
+                chain.value = chain.log_target(chain.u, chain.x);
+
+                // preruns; their samples are only used to adapt the proposal
+                for (unsigned r = 0; r < config.preruns(); ++r)
+                {
+                    unsigned accepted = 0;
+                    for (unsigned s = 0; s < config.prerun_samples(); ++s)
+                    {
+                        accepted += chain.advance() ? 1 : 0;
+                        chain.accumulate();
+                    }
+
+                    const double acceptance_rate = (config.prerun_samples() > 0) ? double(accepted) / config.prerun_samples() : 0.0;
+                    Log::instance()->message("MarkovChainSampler::run", ll_debug)
+                        << "Prerun " << r << ": acceptance rate is " << acceptance_rate;
+
+                    chain.adapt(acceptance_rate);
+                }
+
+                // main run with a fixed proposal
+                unsigned long accepted = 0;
+                for (unsigned n = 0; n < config.samples(); ++n)
+                {
+                    for (unsigned s = 0; s < config.stride(); ++s)
+                    {
+                        accepted += chain.advance() ? 1 : 0;
+                    }
+
+                    std::copy(chain.x.cbegin(), chain.x.cend(), samples + n * dim);
+                    if (u_samples)
+                    {
+                        std::copy(chain.u.cbegin(), chain.u.cend(), u_samples + n * dim);
+                    }
+                    log_posterior[n] = chain.value;
+                }
+
+                const unsigned long steps = static_cast<unsigned long>(config.samples()) * config.stride();
+
+                return (steps > 0) ? double(accepted) / steps : 0.0;
+            }
+
+            std::vector<double>
+            run(std::span<const double> start_points, std::span<double> samples, std::span<double> u_samples, std::span<double> log_posterior_values)
+            {
+                const std::size_t chains = config.chains();
+                const std::size_t N      = config.samples();
+
+                if ((! start_points.empty()) && (start_points.size() != chains * dim))
+                {
+                    throw InternalError("MarkovChainSampler::run: expected " + stringify(chains * dim) + " start point coordinates, got " + stringify(start_points.size()));
+                }
+
+                if (samples.size() != chains * N * dim)
+                {
+                    throw InternalError("MarkovChainSampler::run: expected a sample buffer of size " + stringify(chains * N * dim) + ", got " + stringify(samples.size()));
+                }
+
+                if ((! u_samples.empty()) && (u_samples.size() != chains * N * dim))
+                {
+                    throw InternalError("MarkovChainSampler::run: expected a u-space sample buffer of size " + stringify(chains * N * dim) + ", got " + stringify(u_samples.size()));
+                }
+
+                if (log_posterior_values.size() != chains * N)
+                {
+                    throw InternalError("MarkovChainSampler::run: expected a log(posterior) buffer of size " + stringify(chains * N) + ", got " + stringify(log_posterior_values.size()));
+                }
+
+                // clone the posterior for each chain in the calling thread
+                std::vector<std::unique_ptr<Chain>> chain_states;
+                chain_states.reserve(chains);
+                for (std::size_t c = 0; c < chains; ++c)
+                {
+                    chain_states.push_back(std::make_unique<Chain>(log_posterior, config.seed() + c, config.cov_scale()));
+                }
+
+                std::vector<double>             acceptance_rates(chains, 0.0);
+                std::vector<std::exception_ptr> errors(chains);
+
+                // The chains run on dedicated threads rather than as jobs of the thread pool:
+                // evaluating the likelihood updates its observable cache through the thread pool,
+                // and workers of the thread pool must not wait for other jobs. The number of threads
+                // is bounded by the size of the thread pool; each thread runs one chain after another.
+                {
+                    std::atomic<std::size_t> next_chain(0);
+
+                    auto run_chains = [&]()
+                    {
+                        for (std::size_t c = next_chain.fetch_add(1); c < chains; c = next_chain.fetch_add(1))
+                        {
+                            try
+                            {
+                                acceptance_rates[c] = run_chain(*chain_states[c],
+                                                                start_points.empty() ? nullptr : start_points.data() + c * dim,
+                                                                samples.data() + c * N * dim,
+                                                                u_samples.empty() ? nullptr : u_samples.data() + c * N * dim,
+                                                                log_posterior_values.data() + c * N);
+                            }
+                            catch (...)
+                            {
+                                errors[c] = std::current_exception();
+                            }
+                        }
+                    };
+
+                    const std::size_t                    number_of_threads = std::min<std::size_t>(chains, ThreadPool::instance()->number_of_threads());
+                    std::vector<std::unique_ptr<Thread>> threads;
+                    threads.reserve(number_of_threads);
+                    for (std::size_t t = 0; t < number_of_threads; ++t)
+                    {
+                        threads.push_back(std::make_unique<Thread>(run_chains));
+                    }
+
+                    // the destructors of the threads await their completion
+                }
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                for (std::size_t c = 0; c < chains; ++c)
+                {
+                    Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                        << "Chain " << c << ": acceptance rate in the main run is " << acceptance_rates[c];
+                }
+
+                return acceptance_rates;
+            }
+    };
+
+    MarkovChainSampler::MarkovChainSampler(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<MarkovChainSampler>(new Implementation<MarkovChainSampler>(log_posterior, config))
+    {
+    }
+
+    MarkovChainSampler::~MarkovChainSampler() = default;
+
+    unsigned
+    MarkovChainSampler::dimension() const
+    {
+        return _imp->dim;
+    }
+
+    std::vector<double>
+    MarkovChainSampler::run(std::span<const double> start_points, std::span<double> samples, std::span<double> u_samples, std::span<double> log_posterior)
+    {
+        return _imp->run(start_points, samples, u_samples, log_posterior);
+    }
+} // namespace eos
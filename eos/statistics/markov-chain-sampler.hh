@@ -0,0 +1,131 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <span>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Samples from a LogPosterior using several adaptive Metropolis-Hastings Markov chains.
+     *
+     * The chains operate in the generator space u in [0, 1)^D of the posterior's varied
+     * parameters, in the same way as eos.Analysis.sample. A point u is mapped to the parameter
+     * space through the inverse CDFs of the priors. Points outside the unit hypercube and points
+     * for which the posterior raises an exception have a target density of zero.
+     *
+     * Each chain evaluates its own clone of the posterior and uses its own random number
+     * generator, seeded with Config::seed() plus the index of the chain. The chains run
+     * concurrently on dedicated threads, one chain after another per thread. The number of
+     * these threads is bounded by the size of the thread pool, and the results do not depend on it.
+     *
+     * Each chain first runs a number of preruns. After each prerun, the covariance of its
+     * multivariate Gaussian proposal is adapted to the covariance of all prerun samples so far,
+     * and scaled according to the prerun's acceptance rate. The proposal is then frozen, and the
+     * main run stores every stride-th sample.
+     */
+    class MarkovChainSampler :
+        public PrivateImplementationPattern<MarkovChainSampler>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// Number of independent chains
+                    unsigned chains() const;
+                    Config & chains(const unsigned & x);
+
+                    /// Number of preruns used to adapt the proposal density
+                    unsigned preruns() const;
+                    Config & preruns(const unsigned & x);
+
+                    /// Number of steps in each prerun
+                    unsigned prerun_samples() const;
+                    Config & prerun_samples(const unsigned & x);
+
+                    /// Number of samples stored per chain
+                    unsigned samples() const;
+                    Config & samples(const unsigned & x);
+
+                    /// Number of steps per stored sample in the main run
+                    unsigned stride() const;
+                    Config & stride(const unsigned & x);
+
+                    /// Scale factor for the initial proposal covariance, relative to the variance 1/12 of U(0, 1)
+                    double   cov_scale() const;
+                    Config & cov_scale(const double & x);
+
+                    /// Seed of the first chain's random number generator
+                    unsigned long seed() const;
+                    Config &      seed(const unsigned long & x);
+
+                private:
+                    unsigned _chains, _preruns, _prerun_samples, _samples, _stride;
+
+                    double _cov_scale;
+
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The posterior from which to sample. Each chain samples from its own clone.
+             * @param config        The configuration of the chains.
+             */
+            MarkovChainSampler(const LogPosterior & log_posterior, const Config & config);
+
+            /// Destructor.
+            ~MarkovChainSampler();
+            ///@}
+
+            /// Retrieve the dimension D of the sampled space, i.e., the number of varied parameters.
+            unsigned dimension() const;
+
+            /*!
+             * Run all chains.
+             *
+             * All buffers are row-major and indexed by chain first, then by sample, then by parameter.
+             * The caller owns the buffers, and they are written to without intermediate copies.
+             *
+             * @param start_points  The start points of the chains in u space, of size chains x D.
+             *                      If empty, the chains start at random points.
+             * @param samples       The buffer receiving the parameter samples, of size chains x samples x D.
+             * @param u_samples     The buffer receiving the samples in u space, of size chains x samples x D.
+             *                      May be empty if these samples are not needed.
+             * @param log_posterior The buffer receiving the log(posterior) at each sample, of size chains x samples.
+             *
+             * @return The acceptance rate of each chain's main run.
+             */
+            std::vector<double> run(std::span<const double> start_points, std::span<double> samples,
+                                    std::span<double> u_samples, std::span<double> log_posterior);
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,131 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <test/test.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class MarkovChainSamplerTest : public TestCase
+{
+    public:
+        MarkovChainSamplerTest() :
+            TestCase("markov_chain_sampler_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            // two uncorrelated Gaussian likelihoods with flat priors:
+            // m_b = 4.2 +/- 0.1 and m_c = 1.25 +/- 0.05
+            Parameters parameters = Parameters::Defaults();
+
+            LogLikelihood llh(parameters);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.2, 1.25, 1.3);
+
+            LogPosterior log_posterior(llh);
+            log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", 3.7, 4.9));
+            log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 1.5));
+
+            const unsigned chains = 4, N = 2000, dim = 2;
+            const auto     config = MarkovChainSampler::Config().chains(chains).samples(N).stride(5).seed(1234);
+
+            MarkovChainSampler sampler(log_posterior, config);
+            TEST_CHECK_EQUAL(sampler.dimension(), dim);
+
+            std::vector<double> samples(chains * N * dim), u_samples(chains * N * dim), values(chains * N);
+            const auto          acceptance_rates = sampler.run({}, samples, u_samples, values);
+
+            TEST_CHECK_EQUAL(acceptance_rates.size(), chains);
+            for (const auto & rate : acceptance_rates)
+            {
+                TEST_CHECK(rate > 0.1);
+                TEST_CHECK(rate < 0.8);
+            }
+
+            // samples in parameter space and in u space are consistent, and the stored
+            // log(posterior) values belong to the stored samples
+            Parameter m_b = log_posterior.parameters()["mass::b(MSbar)"];
+            Parameter m_c = log_posterior.parameters()["mass::c"];
+            for (unsigned i = 0; i < chains * N; i += 997)
+            {
+                TEST_CHECK_NEARLY_EQUAL(samples[i * dim + 0], 3.7 + 1.2 * u_samples[i * dim + 0], 1e-12);
+                TEST_CHECK_NEARLY_EQUAL(samples[i * dim + 1], 1.0 + 0.5 * u_samples[i * dim + 1], 1e-12);
+
+                m_b = samples[i * dim + 0];
+                m_c = samples[i * dim + 1];
+                TEST_CHECK_NEARLY_EQUAL(values[i], log_posterior.evaluate(), 1e-12);
+            }
+
+            // moments of the posterior
+            std::vector<double> mean(dim, 0.0), variance(dim, 0.0);
+            for (unsigned i = 0; i < chains * N; ++i)
+            {
+                for (unsigned j = 0; j < dim; ++j)
+                {
+                    mean[j] += samples[i * dim + j] / (chains * N);
+                }
+            }
+            for (unsigned i = 0; i < chains * N; ++i)
+            {
+                for (unsigned j = 0; j < dim; ++j)
+                {
+                    variance[j] += std::pow(samples[i * dim + j] - mean[j], 2) / (chains * N - 1);
+                }
+            }
+
+            TEST_CHECK_NEARLY_EQUAL(mean[0], 4.2, 0.01);
+            TEST_CHECK_NEARLY_EQUAL(mean[1], 1.25, 0.005);
+            TEST_CHECK_NEARLY_EQUAL(std::sqrt(variance[0]), 0.1, 0.01);
+            TEST_CHECK_NEARLY_EQUAL(std::sqrt(variance[1]), 0.05, 0.005);
+
+            // the chains are reproducible, and do not depend on the order in which the threads run
+            {
+                std::vector<double> samples2(chains * N * dim), values2(chains * N);
+                MarkovChainSampler(log_posterior, config).run({}, samples2, {}, values2);
+
+                TEST_CHECK(samples == samples2);
+                TEST_CHECK(values == values2);
+            }
+
+            // start points in u space
+            {
+                const auto          single = MarkovChainSampler::Config().chains(1).preruns(0).samples(1).stride(1);
+                std::vector<double> start{ 0.5, 0.5 }, sample(dim), value(1);
+
+                MarkovChainSampler(log_posterior, single).run(start, sample, {}, value);
+                TEST_CHECK(std::isfinite(value[0]));
+            }
+
+            // buffers of the wrong size
+            {
+                std::vector<double> too_small(chains * N * dim - 1);
+                TEST_CHECK_THROWS(InternalError, sampler.run({}, too_small, {}, values));
+                TEST_CHECK_THROWS(InternalError, sampler.run(std::vector<double>(dim), samples, {}, values));
+            }
+        }
+} markov_chain_sampler_test;
@@ -300,5 +300,188 @@ class CacheableObservableTest : public TestCase
                 ObservableCache cache2(p);
                 TEST_CHECK_NO_THROW(cache2 = cache.clone(p));
             }
+
+            // Test selective re-evaluation of the cache
+            {
+                Parameters p   = Parameters::Defaults();
+                p["mass::B_u"] = 5.27934;
+
+                using TestCacheableObservable = class ConcreteCacheableObservable<TestCacheableObservableProvider, double>;
+
+                Kinematics    k{ { "q2", 2.0 } };
+                ObservablePtr cacheable_observable(new TestCacheableObservable("test::cacheable_observable1(q2)",
+                                                                               p,
+                                                                               k,
+                                                                               Options(),
+                                                                               &TestCacheableObservableProvider::prepare,
+                                                                               &TestCacheableObservableProvider::evaluate1,
+                                                                               std::make_tuple("q2")));
+                ObservablePtr cacheable_observable2(new TestCacheableObservable("test::cacheable_observable2(q2)",
+                                                                                p,
+                                                                                Kinematics({
+                                                                                    { "q2", 2.0 }
+                }),
+                                                                                Options(),
+                                                                                &TestCacheableObservableProvider::prepare,
+                                                                                &TestCacheableObservableProvider::evaluate1,
+                                                                                std::make_tuple("q2")));
+
+                ObservableCache cache(p);
+                auto            id1 = cache.add(cacheable_observable);
+                auto            id2 = cache.add(cacheable_observable2);
+
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.27934 - 2.0 * 2.0, 1.0e-5);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.27934 - 2.0 * 2.0, 1.0e-5);
+
+                // changing an unused parameter leaves the predictions unchanged
+                p["mass::c"] = 1.0;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.27934 - 2.0 * 2.0, 1.0e-5);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.27934 - 2.0 * 2.0, 1.0e-5);
+
+                // changing a used parameter updates the cacheable and the cached observable
+                p["mass::B_u"] = 5.0;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.0 - 2.0 * 2.0, 1.0e-5);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.0 - 2.0 * 2.0, 1.0e-5);
+
+                // changing a kinematic variable updates the cacheable and the cached observable
+                k.set("q2", 1.0);
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.0 - 2.0 * 1.0, 1.0e-5);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.0 - 2.0 * 1.0, 1.0e-5);
+            }
+
+            // Test the lookup of duplicate observables after a change of their kinematics
+            {
+                Parameters p = Parameters::Defaults();
+
+                using TestCacheableObservable = class ConcreteCacheableObservable<TestCacheableObservableProvider, double>;
+                using TestRegularObservable   = class ConcreteObservable<TestRegularObservableProvider, double>;
+
+                Kinematics    k1{ { "q2", 2.0 } };
+                ObservablePtr regular_observable1(
+                        new TestRegularObservable("test::regular_observable(q2)", p, k1, Options(), &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+                ObservablePtr cacheable_observable1(new TestCacheableObservable("test::cacheable_observable1(q2)",
+                                                                                p,
+                                                                                k1,
+                                                                                Options(),
+                                                                                &TestCacheableObservableProvider::prepare,
+                                                                                &TestCacheableObservableProvider::evaluate1,
+                                                                                std::make_tuple("q2")));
+
+                ObservableCache cache(p);
+                auto            id1 = cache.add(regular_observable1);
+                auto            id2 = cache.add(cacheable_observable1);
+
+                // change the kinematics of the observables already in the cache
+                k1.set("q2", 3.0);
+
+                Kinematics    k2{ { "q2", 3.0 } };
+                ObservablePtr regular_observable2(
+                        new TestRegularObservable("test::regular_observable(q2)", p, k2, Options(), &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+                ObservablePtr cacheable_observable2(new TestCacheableObservable("test::cacheable_observable1(q2)",
+                                                                                p,
+                                                                                k2,
+                                                                                Options(),
+                                                                                &TestCacheableObservableProvider::prepare,
+                                                                                &TestCacheableObservableProvider::evaluate1,
+                                                                                std::make_tuple("q2")));
+                ObservablePtr cacheable_observable3(new TestCacheableObservable("test::cacheable_observable2(q2)",
+                                                                                p,
+                                                                                k2,
+                                                                                Options(),
+                                                                                &TestCacheableObservableProvider::prepare,
+                                                                                &TestCacheableObservableProvider::evaluate2,
+                                                                                std::make_tuple("q2")));
+
+                // observables identical to those in the cache with their current kinematics are merged...
+                TEST_CHECK_EQUAL(cache.add(regular_observable2), id1);
+                TEST_CHECK_EQUAL(cache.add(cacheable_observable2), id2);
+                TEST_CHECK_EQUAL(cache.size(), 2u);
+
+                // ... and cacheable observables with the current kinematics are cached
+                auto id3 = cache.add(cacheable_observable3);
+                TEST_CHECK_EQUAL(cache.size(), 3u);
+
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id3], 9.0, 1.0e-12);
+
+                // observables with the previous kinematics are not merged
+                Kinematics    k3{ { "q2", 2.0 } };
+                ObservablePtr regular_observable3(
+                        new TestRegularObservable("test::regular_observable(q2)", p, k3, Options(), &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+                TEST_CHECK(cache.add(regular_observable3) != id1);
+                TEST_CHECK_EQUAL(cache.size(), 4u);
+            }
+
+            // Test batch prediction for parameter samples
+            {
+                Parameters p   = Parameters::Defaults();
+                p["mass::B_u"] = 5.27934;
+
+                using TestCacheableObservable = class ConcreteCacheableObservable<TestCacheableObservableProvider, double>;
+                using TestRegularObservable   = class ConcreteObservable<TestRegularObservableProvider, double>;
+
+                ObservablePtr cacheable_observable(new TestCacheableObservable("test::cacheable_observable1(q2)",
+                                                                               p,
+                                                                               Kinematics({
+                                                                                   { "q2", 2.0 }
+                }),
+                                                                               Options(),
+                                                                               &TestCacheableObservableProvider::prepare,
+                                                                               &TestCacheableObservableProvider::evaluate1,
+                                                                               std::make_tuple("q2")));
+                ObservablePtr regular_observable(new TestRegularObservable("test::regular_observable(q2)",
+                                                                           p,
+                                                                           Kinematics({
+                                                                               { "q2", 3.0 }
+                }),
+                                                                           Options(),
+                                                                           &TestRegularObservableProvider::evaluate1,
+                                                                           std::make_tuple("q2")));
+
+                ObservablePtr cacheable_observable2(new TestCacheableObservable("test::cacheable_observable2(q2)",
+                                                                                p,
+                                                                                Kinematics({
+                                                                                    { "q2", 2.0 }
+                }),
+                                                                                Options(),
+                                                                                &TestCacheableObservableProvider::prepare,
+                                                                                &TestCacheableObservableProvider::evaluate1,
+                                                                                std::make_tuple("q2")));
+
+                ObservableCache cache(p);
+                auto            id1 = cache.add(cacheable_observable);
+                auto            id2 = cache.add(regular_observable);
+                auto            id3 = cache.add(cacheable_observable2);
+                cache.update();
+
+                const unsigned      n = 100;
+                std::vector<double> samples(n), predictions(3 * n);
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    samples[i] = 4.0 + 0.01 * i;
+                }
+
+                cache.predict({ p["mass::B_u"] }, samples, { id2, id1, id3 }, predictions);
+
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    // the regular observable reads the mass only upon construction
+                    TEST_CHECK_NEARLY_EQUAL(predictions[3 * i + 0], 5.27934 - 2.0 * 3.0, 1.0e-12);
+                    TEST_CHECK_NEARLY_EQUAL(predictions[3 * i + 1], samples[i] - 2.0 * 2.0, 1.0e-12);
+                    TEST_CHECK_NEARLY_EQUAL(predictions[3 * i + 2], samples[i] - 2.0 * 2.0, 1.0e-12);
+                }
+
+                // the cache and its parameters remain unchanged
+                TEST_CHECK_EQUAL(double(p["mass::B_u"]), 5.27934);
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.27934 - 2.0 * 2.0, 1.0e-12);
+
+                // the buffers must match the number of samples
+                std::vector<double> too_few_predictions(n);
+                TEST_CHECK_THROWS(InternalError, cache.predict({ p["mass::B_u"] }, samples, { id2, id1, id3 }, too_few_predictions));
+            }
         }
 } cacheable_observable_test;
@@ -146,6 +146,8 @@ namespace eos
 
             Options _options;
 
+            // not taken from the DecayPool: prepare() returns a pointer to the intermediate result that is
+            // stored in the decay object, and which the cached observables keep using until the next prepare()
             std::shared_ptr<Decay_> _decay;
 
             std::function<const typename Decay_::IntermediateResult *(const Decay_ *, const Args_ &...)> _prepare_fn;
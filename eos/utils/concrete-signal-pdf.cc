@@ -20,16 +20,19 @@
 #include <eos/utils/concrete-signal-pdf.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <set>
+
 namespace eos
 {
     ConcreteSignalPDF::ConcreteSignalPDF(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options,
-                                         const QualifiedName & unnormalized_pdf, const QualifiedName & normalization) :
+                                         const QualifiedName & unnormalized_pdf, const QualifiedName & normalization, const std::vector<std::string> & variables) :
         _name(name),
         _parameters(parameters),
         _kinematics(kinematics),
         _options(options),
         _unnormalized_pdf(Observable::make(unnormalized_pdf, parameters, kinematics, options)),
-        _normalization(Observable::make(normalization, parameters, kinematics, options))
+        _normalization(Observable::make(normalization, parameters, kinematics, options)),
+        _variables(variables)
     {
         if (_unnormalized_pdf == nullptr)
         {
@@ -40,6 +43,27 @@ namespace eos
         {
             throw InternalError("ConcreteSignalPDF: failed to construct normalization from " + normalization.str());
         }
+
+        // describe the sampling variables by the bounds v_min and v_max, if these are declared
+        std::set<std::string> declared;
+        for (const auto & k : _kinematics)
+        {
+            declared.insert(k.name());
+        }
+
+        for (const auto & v : _variables)
+        {
+            MutablePtr variable(new KinematicVariable(_kinematics[v]));
+            double     min = -std::numeric_limits<double>::infinity(), max = +std::numeric_limits<double>::infinity();
+
+            if (declared.contains(v + "_min") && declared.contains(v + "_max"))
+            {
+                min = _kinematics[v + "_min"].evaluate();
+                max = _kinematics[v + "_max"].evaluate();
+            }
+
+            _descriptions.push_back(ParameterDescription{ variable, min, max, false });
+        }
     }
 
     const QualifiedName &
@@ -102,13 +126,13 @@ namespace eos
     DensityPtr
     ConcreteSignalPDF::clone() const
     {
-        return DensityPtr(new ConcreteSignalPDF(_name, _parameters.clone(), _kinematics.clone(), _options, _unnormalized_pdf->name(), _normalization->name()));
+        return DensityPtr(new ConcreteSignalPDF(_name, _parameters.clone(), _kinematics.clone(), _options, _unnormalized_pdf->name(), _normalization->name(), _variables));
     }
 
     DensityPtr
     ConcreteSignalPDF::clone(const Parameters & parameters) const
     {
-        return DensityPtr(new ConcreteSignalPDF(_name, parameters, _kinematics.clone(), _options, _unnormalized_pdf->name(), _normalization->name()));
+        return DensityPtr(new ConcreteSignalPDF(_name, parameters, _kinematics.clone(), _options, _unnormalized_pdf->name(), _normalization->name(), _variables));
     }
 
     Density::Iterator
@@ -177,7 +201,7 @@ namespace eos
     SignalPDFPtr
     ConcreteSignalPDFEntry::make(const Parameters & parameters, const Kinematics & kinematics, const Options & options) const
     {
-        return SignalPDFPtr(new ConcreteSignalPDF(_name, parameters, kinematics, _default_options + options, _numerator, _normalization));
+        return SignalPDFPtr(new ConcreteSignalPDF(_name, parameters, kinematics, _default_options + options, _numerator, _normalization, _numerator_kinematic_names));
     }
 
     std::ostream &
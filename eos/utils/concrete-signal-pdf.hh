@@ -268,12 +268,15 @@ namespace eos
 
             ObservablePtr _normalization;
 
-            // TODO: remove
+            // the names of the sampling variables, i.e., the kinematic variables of the unnormalized PDF
+            std::vector<std::string> _variables;
+
+            // the sampling variables and their bounds v_min and v_max; the bounds are infinite if they are not declared
             std::vector<ParameterDescription> _descriptions;
 
         public:
             ConcreteSignalPDF(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options,
-                              const QualifiedName & unnormalized_pdf, const QualifiedName & normalization);
+                              const QualifiedName & unnormalized_pdf, const QualifiedName & normalization, const std::vector<std::string> & variables);
 
             virtual const QualifiedName & name() const;
 
@@ -21,16 +21,23 @@
 #define EOS_GUARD_EOS_UTILS_CONCRETE_OBSERVABLE_HH 1
 
 #include <eos/observable-impl.hh>
+#include <eos/utils/decay-pool.hh>
 #include <eos/utils/join.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/tuple-maker.hh>
 #include <eos/utils/units.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <algorithm>
 #include <array>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace eos
 {
@@ -46,7 +53,8 @@ namespace eos
 
             Options _options;
 
-            Decay_ _decay;
+            // shared with all other observables that use the same parameters and options
+            std::shared_ptr<SharedDecay<Decay_>> _decay;
 
             std::function<double(const Decay_ *, const Args_ &...)> _function;
 
@@ -54,6 +62,19 @@ namespace eos
 
             std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type...> _argument_tuple;
 
+            using ValueTuple = std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type...>;
+
+            // minimal number of points evaluated per worker; each concurrent worker acquires its own decay object
+            static constexpr std::size_t min_points_per_worker = 32;
+
+            // replace those function arguments that are varied in a batch evaluation by the values at one point
+            template <std::size_t... I_>
+            static void
+            _assign_point(ValueTuple & values, const std::array<int, sizeof...(Args_)> & slots, const double * point, std::index_sequence<I_...>)
+            {
+                ((slots[I_] >= 0 ? void(std::get<I_ + 1>(values) = point[slots[I_]]) : void()), ...);
+            }
+
         public:
             ConcreteObservable(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options,
                                const std::function<double(const Decay_ *, const Args_ &...)> &            function,
@@ -62,12 +83,12 @@ namespace eos
                 _parameters(parameters),
                 _kinematics(kinematics),
                 _options(options),
-                _decay(parameters, options),
+                _decay(DecayPool<Decay_>::instance()->get(parameters, options)),
                 _function(function),
                 _kinematics_names(kinematics_names),
-                _argument_tuple(impl::TupleMaker<sizeof...(Args_)>::make(_kinematics, _kinematics_names, &_decay))
+                _argument_tuple(impl::TupleMaker<sizeof...(Args_)>::make(_kinematics, _kinematics_names, &_decay->decay))
             {
-                uses(_decay);
+                uses(_decay->decay);
                 auto _register_kinematics = [this](const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type... args)
                 {
                     std::array<const KinematicVariable, sizeof...(Args_)> kinematics_array = { args... };
@@ -91,9 +112,118 @@ namespace eos
             {
                 std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type...> values = _argument_tuple;
 
+                auto lease          = _decay->acquire();
+                std::get<0>(values) = lease.get();
+
                 return std::apply(_function, values);
             }
 
+            virtual void
+            evaluate_batch(const std::vector<std::string> & variables, std::span<const double> points, std::span<double> results)
+            {
+                const std::size_t n         = impl::batch_size(variables, points, results);
+                const std::size_t dimension = variables.size();
+
+                // map each function argument onto the varied kinematic variable, if any; comparing the ids also resolves aliases
+                std::vector<KinematicVariable::Id> ids;
+                for (const auto & variable : variables)
+                {
+                    ids.push_back(_kinematics[variable].id());
+                }
+
+                std::array<int, sizeof...(Args_)> slots;
+                auto                              _map_arguments = [&](const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type... args)
+                {
+                    std::array<const KinematicVariable, sizeof...(Args_)> kinematics_array = { args... };
+                    for (std::size_t a = 0; a < sizeof...(Args_); ++a)
+                    {
+                        auto i   = std::find(ids.cbegin(), ids.cend(), kinematics_array[a].id());
+                        slots[a] = (ids.cend() == i) ? -1 : static_cast<int>(i - ids.cbegin());
+                    }
+                };
+                std::apply(_map_arguments, _argument_tuple);
+
+                // reject variables that do not enter any of the function arguments
+                for (std::size_t v = 0; v < dimension; ++v)
+                {
+                    if (std::find(slots.cbegin(), slots.cend(), static_cast<int>(v)) == slots.cend())
+                    {
+                        throw InternalError("ConcreteObservable::evaluate_batch: kinematic variable '" + variables[v] + "' is not used by observable '" + _name.str() + "'");
+                    }
+                }
+
+                // the values of all kinematic variables that are not varied are fixed for the entire batch
+                const ValueTuple values = _argument_tuple;
+
+                auto evaluate_points = [&](const Decay_ * decay, std::size_t begin, std::size_t end)
+                {
+                    ValueTuple point_values   = values;
+                    std::get<0>(point_values) = decay;
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        _assign_point(point_values, slots, points.data() + i * dimension, std::index_sequence_for<Args_...>());
+                        results[i] = std::apply(_function, point_values);
+                    }
+                };
+
+                // when called from within a job of the thread pool, waiting on further jobs could stall all workers
+                const std::size_t workers = ThreadPool::instance()->is_worker_thread()
+                                                    ? 1
+                                                    : std::min<std::size_t>(ThreadPool::instance()->number_of_threads() + 1, n / min_points_per_worker);
+                if (workers <= 1)
+                {
+                    auto lease = _decay->acquire();
+                    evaluate_points(lease.get(), 0, n);
+                    return;
+                }
+
+                // the calling thread evaluates the first chunk, while the remaining chunks are evaluated by the thread pool;
+                // each chunk acquires a decay object of its own
+                const std::size_t               chunk_size = (n + workers - 1) / workers;
+                std::vector<std::exception_ptr> errors(workers);
+
+                Ticket ticket = ThreadPool::instance()->enqueue_range(workers - 1,
+                                                                      [&](const unsigned & w)
+                                                                      {
+                                                                          const std::size_t begin = (w + 1) * chunk_size;
+                                                                          const std::size_t end   = std::min(begin + chunk_size, n);
+                                                                          if (begin >= end)
+                                                                          {
+                                                                              return;
+                                                                          }
+
+                                                                          try
+                                                                          {
+                                                                              auto lease = _decay->acquire();
+                                                                              evaluate_points(lease.get(), begin, end);
+                                                                          }
+                                                                          catch (...)
+                                                                          {
+                                                                              errors[w + 1] = std::current_exception();
+                                                                          }
+                                                                      });
+
+                try
+                {
+                    auto lease = _decay->acquire();
+                    evaluate_points(lease.get(), 0, std::min(chunk_size, n));
+                }
+                catch (...)
+                {
+                    errors[0] = std::current_exception();
+                }
+
+                ticket.wait();
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+
             virtual Parameters
             parameters()
             {
@@ -0,0 +1,296 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_DECAY_POOL_HH
+#define EOS_GUARD_EOS_UTILS_DECAY_POOL_HH 1
+
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/parameters.hh>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * A set of interchangeable decay objects that is shared by several users.
+     *
+     * Decay objects are not thread-safe, since many of them keep intermediate
+     * results in their private implementation. Users therefore acquire one of
+     * the decay objects for the duration of an evaluation. Concurrent users
+     * obtain distinct decay objects, which are constructed on demand and kept
+     * for later reuse.
+     */
+    template <typename Decay_> class SharedDecay
+    {
+        private:
+            Parameters _parameters;
+
+            Options _options;
+
+            Mutex _mutex;
+
+            // additional decay objects, constructed on demand
+            std::vector<std::unique_ptr<Decay_>> _instances;
+
+            // decay objects that are currently not acquired by any user
+            std::vector<Decay_ *> _idle;
+
+        public:
+            /*!
+             * The decay object constructed first.
+             *
+             * Users register their parameters and references through this object.
+             * Use acquire() to access it for evaluation.
+             */
+            Decay_ decay;
+
+            /// An exclusive reference to one of the decay objects, released upon destruction.
+            class Lease
+            {
+                private:
+                    SharedDecay * _shared;
+
+                    Decay_ * _decay;
+
+                public:
+                    Lease(SharedDecay * shared, Decay_ * decay) :
+                        _shared(shared),
+                        _decay(decay)
+                    {
+                    }
+
+                    Lease(const Lease &) = delete;
+
+                    Lease & operator= (const Lease &) = delete;
+
+                    ~Lease()
+                    {
+                        Lock l(_shared->_mutex);
+                        _shared->_idle.push_back(_decay);
+                    }
+
+                    const Decay_ *
+                    get() const
+                    {
+                        return _decay;
+                    }
+            };
+
+            SharedDecay(const Parameters & parameters, const Options & options) :
+                _parameters(parameters),
+                _options(options),
+                decay(parameters, options)
+            {
+                _idle.push_back(&decay);
+            }
+
+            /// Retrieve the parameters used by all of the decay objects.
+            const Parameters &
+            parameters() const
+            {
+                return _parameters;
+            }
+
+            /// Acquire a decay object that is not in use by any other user.
+            Lease
+            acquire()
+            {
+                {
+                    Lock l(_mutex);
+
+                    if (! _idle.empty())
+                    {
+                        Decay_ * result = _idle.back();
+                        _idle.pop_back();
+
+                        return Lease(this, result);
+                    }
+                }
+
+                // all decay objects are in use; construct another one outside of the lock
+                auto instance = std::make_unique<Decay_>(_parameters, _options);
+                Decay_ * result = instance.get();
+
+                Lock l(_mutex);
+                _instances.push_back(std::move(instance));
+
+                return Lease(this, result);
+            }
+
+            /// Retrieve the number of decay objects constructed so far.
+            unsigned
+            number_of_instances()
+            {
+                Lock l(_mutex);
+
+                return 1u + _instances.size();
+            }
+    };
+
+    /*!
+     * DecayPool hands out shared decay objects of one type.
+     *
+     * Two requests for a decay object share the same object if they use the same
+     * Parameters object (i.e., not a clone thereof) and equal Options. The pool
+     * does not own the decay objects, and keeps only weak references to them. A
+     * decay object is destroyed, and its entry removed from the pool, as soon as
+     * the last of its users releases it.
+     *
+     * The decay object is constructed outside of the pool's lock. If two threads
+     * request the same decay object concurrently, the object constructed first is
+     * kept, and the other one is discarded.
+     */
+    template <typename Decay_> class DecayPool : public InstantiationPolicy<DecayPool<Decay_>, Singleton>
+    {
+        private:
+            struct State
+            {
+                    Mutex mutex;
+
+                    // weak references to all decay objects, keyed by the canonical string representation of their options
+                    std::map<std::string, std::vector<std::weak_ptr<SharedDecay<Decay_>>>> entries;
+            };
+
+            // Shared with the deleters of the decay objects, which might outlive the pool at program exit.
+            std::shared_ptr<State> _state;
+
+            // Requires the mutex to be held
+            static std::shared_ptr<SharedDecay<Decay_>>
+            _find(const std::vector<std::weak_ptr<SharedDecay<Decay_>>> & entries, const Parameters & parameters)
+            {
+                for (const auto & entry : entries)
+                {
+                    auto result = entry.lock();
+                    if ((! result) || (result->parameters() != parameters))
+                    {
+                        continue;
+                    }
+
+                    return result;
+                }
+
+                return nullptr;
+            }
+
+            // Remove the entries of decay objects that have already been destroyed.
+            static void
+            _purge(const std::weak_ptr<State> & weak_state, const std::string & key)
+            {
+                auto state = weak_state.lock();
+                if (! state)
+                {
+                    return;
+                }
+
+                Lock l(state->mutex);
+
+                auto i = state->entries.find(key);
+                if (state->entries.end() == i)
+                {
+                    return;
+                }
+
+                auto & entries = i->second;
+                entries.erase(std::remove_if(entries.begin(), entries.end(), [](const auto & entry) { return entry.expired(); }), entries.end());
+
+                if (entries.empty())
+                {
+                    state->entries.erase(i);
+                }
+            }
+
+        public:
+            DecayPool() :
+                _state(new State)
+            {
+            }
+
+            ~DecayPool() {}
+
+            /*!
+             * Retrieve a decay object for the given parameters and options.
+             *
+             * @param parameters The parameters to be used by the decay object.
+             * @param options    The options to be used by the decay object.
+             */
+            std::shared_ptr<SharedDecay<Decay_>>
+            get(const Parameters & parameters, const Options & options)
+            {
+                const std::string key = options.as_string();
+
+                {
+                    Lock l(_state->mutex);
+
+                    auto i = _state->entries.find(key);
+                    if (_state->entries.end() != i)
+                    {
+                        if (auto result = _find(i->second, parameters))
+                        {
+                            return result;
+                        }
+                    }
+                }
+
+                std::weak_ptr<State> state = _state;
+                std::shared_ptr<SharedDecay<Decay_>> decay(new SharedDecay<Decay_>(parameters, options),
+                        [state, key](SharedDecay<Decay_> * d)
+                        {
+                            delete d;
+                            _purge(state, key);
+                        });
+
+                Lock l(_state->mutex);
+
+                auto & entries = _state->entries[key];
+                if (auto result = _find(entries, parameters))
+                {
+                    return result;
+                }
+
+                entries.push_back(decay);
+
+                return decay;
+            }
+
+            /// Retrieve the number of decay objects that are currently pooled.
+            unsigned
+            size()
+            {
+                Lock l(_state->mutex);
+
+                unsigned result = 0;
+                for (const auto & [key, entries] : _state->entries)
+                {
+                    result += entries.size();
+                }
+
+                return result;
+            }
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,146 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/concrete_observable.hh>
+#include <eos/utils/decay-pool.hh>
+#include <eos/utils/reference-name.hh>
+
+#include <test/test.hh>
+
+#include <algorithm>
+#include <set>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    struct TestDecay : public ParameterUser
+    {
+            static unsigned instances;
+
+            static const std::set<ReferenceName> references;
+
+            UsedParameter m_B;
+
+            TestDecay(const Parameters & p, const Options &) :
+                m_B(p["mass::B_d"], *this)
+            {
+                ++instances;
+            }
+
+            double
+            mass_squared(const double & q2) const
+            {
+                return m_B * m_B - q2;
+            }
+    };
+
+    unsigned TestDecay::instances = 0;
+
+    const std::set<ReferenceName> TestDecay::references{};
+} // namespace
+
+class DecayPoolTest : public TestCase
+{
+    public:
+        DecayPoolTest() :
+            TestCase("decay_pool_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Options    o{ { "l"_ok, "mu"_ov }, { "model"_ok, "SM"_ov } };
+            auto       pool = DecayPool<TestDecay>::instance();
+
+            // decay objects are shared for identical parameters and options
+            {
+                auto d1 = pool->get(p, o);
+                auto d2 = pool->get(p, Options{ { "model"_ok, "SM"_ov }, { "l"_ok, "mu"_ov } });
+                TEST_CHECK(d1.get() == d2.get());
+                TEST_CHECK_EQUAL(TestDecay::instances, 1u);
+
+                // ... but not across different options or cloned parameters
+                auto d3 = pool->get(p, Options{ { "l"_ok, "e"_ov }, { "model"_ok, "SM"_ov } });
+                auto d4 = pool->get(p.clone(), o);
+                TEST_CHECK(d1.get() != d3.get());
+                TEST_CHECK(d1.get() != d4.get());
+                TEST_CHECK(d3.get() != d4.get());
+                TEST_CHECK_EQUAL(TestDecay::instances, 3u);
+                TEST_CHECK_EQUAL(pool->size(), 3u);
+            }
+
+            // decay objects are destroyed and removed from the pool once their last user releases them
+            TEST_CHECK_EQUAL(pool->size(), 0u);
+
+            // concurrent users acquire distinct decay objects, which are reused afterwards
+            {
+                TestDecay::instances = 0;
+
+                auto d = pool->get(p, o);
+                TEST_CHECK_EQUAL(d->number_of_instances(), 1u);
+
+                {
+                    auto l1 = d->acquire();
+                    auto l2 = d->acquire();
+                    TEST_CHECK(l1.get() != l2.get());
+                    TEST_CHECK(l1.get() == &d->decay || l2.get() == &d->decay);
+                    TEST_CHECK_EQUAL(d->number_of_instances(), 2u);
+                }
+
+                {
+                    auto l1 = d->acquire();
+                    auto l2 = d->acquire();
+                    TEST_CHECK(l1.get() != l2.get());
+                    TEST_CHECK_EQUAL(d->number_of_instances(), 2u);
+                }
+
+                TEST_CHECK_EQUAL(TestDecay::instances, 2u);
+            }
+            TEST_CHECK_EQUAL(pool->size(), 0u);
+
+            // concrete observables with identical parameters and options share their decay object
+            {
+                TestDecay::instances = 0;
+
+                Kinematics k{ { "q2", 1.0 } };
+                const std::function<double(const TestDecay *, const double &)> f = &TestDecay::mass_squared;
+
+                ConcreteObservable<TestDecay, double> o1("Test::obs1", p, k, o, f, std::make_tuple("q2"));
+                ConcreteObservable<TestDecay, double> o2("Test::obs2", p, k, o, f, std::make_tuple("q2"));
+                TEST_CHECK_EQUAL(TestDecay::instances, 1u);
+
+                const double m_B = p["mass::B_d"].evaluate();
+                TEST_CHECK_NEARLY_EQUAL(o1.evaluate(), m_B * m_B - 1.0, 1e-12);
+                TEST_CHECK_NEARLY_EQUAL(o2.evaluate(), m_B * m_B - 1.0, 1e-12);
+                TEST_CHECK_EQUAL(TestDecay::instances, 1u);
+
+                // both observables depend on the parameter used by the shared decay object
+                TEST_CHECK(o1.end() != std::find(o1.begin(), o1.end(), p["mass::B_d"].id()));
+                TEST_CHECK(o2.end() != std::find(o2.begin(), o2.end(), p["mass::B_d"].id()));
+
+                // a clone uses independent parameters, and hence its own decay object
+                auto o3 = o1.clone();
+                TEST_CHECK_EQUAL(TestDecay::instances, 2u);
+            }
+        }
+} decay_pool_test;
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/observable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/expression-compiler.hh>
+#include <eos/utils/stringify.hh>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace eos::exp
+{
+    /*
+     * ExpressionProgram
+     */
+
+    ExpressionProgram::ExpressionProgram() {}
+
+    ExpressionProgram::~ExpressionProgram() {}
+
+    unsigned
+    ExpressionProgram::emit(const Instruction & instruction, const unsigned & level, const std::uint64_t & payload)
+    {
+        const auto key    = std::make_tuple(instruction.opcode, instruction.lhs, instruction.rhs, payload);
+        const auto result = _registers.insert(std::make_pair(key, static_cast<unsigned>(_instructions.size())));
+        if (! result.second)
+        {
+            return result.first->second;
+        }
+
+        _instructions.push_back(instruction);
+        _levels.push_back(level);
+
+        return result.first->second;
+    }
+
+    void
+    ExpressionProgram::add(const Expression & expression, const ObservableCache::ObservableId & id)
+    {
+        ExpressionCompiler compiler(*this, _outputs.size());
+        const unsigned     index = std::visit(compiler, expression);
+
+        _outputs.push_back(std::make_tuple(id, index, _levels[index]));
+        _output_levels[id.value()] = _levels[index];
+    }
+
+    void
+    ExpressionProgram::schedule()
+    {
+        const unsigned n = _instructions.size();
+
+        // constants are materialised once, and are not part of any group
+        _values.assign(n, std::numeric_limits<double>::quiet_NaN());
+        for (unsigned i = 0; i < n; ++i)
+        {
+            if (Opcode::constant == _instructions[i].opcode)
+            {
+                _values[i] = _instructions[i].value;
+            }
+        }
+        _errors.assign(n, nullptr);
+
+        const auto operands = [this](const unsigned & i) -> std::vector<unsigned>
+        {
+            const auto & instruction = _instructions[i];
+            switch (instruction.opcode)
+            {
+                case Opcode::sum:
+                case Opcode::difference:
+                case Opcode::product:
+                case Opcode::ratio:
+                case Opcode::power:
+                    return { instruction.lhs, instruction.rhs };
+                case Opcode::function:
+                    return { instruction.lhs };
+                default:
+                    return {};
+            }
+        };
+
+        // join each instruction with those of its operands that are computed at the same level
+        std::vector<unsigned> parent(n);
+        std::iota(parent.begin(), parent.end(), 0u);
+        const auto find = [&parent](unsigned i) -> unsigned
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i         = parent[i];
+            }
+
+            return i;
+        };
+
+        for (unsigned i = 0; i < n; ++i)
+        {
+            for (const auto & o : operands(i))
+            {
+                if ((Opcode::constant == _instructions[o].opcode) || (_levels[o] != _levels[i]))
+                {
+                    continue;
+                }
+
+                parent[find(o)] = find(i);
+            }
+        }
+
+        // collect the instructions of each group in the order of their registers, which is a topological order
+        std::vector<int> group_of_root(n, -1);
+        std::vector<int> group_of(n, -1);
+        std::vector<Group> groups;
+        for (unsigned i = 0; i < n; ++i)
+        {
+            if (Opcode::constant == _instructions[i].opcode)
+            {
+                continue;
+            }
+
+            const unsigned root = find(i);
+            if (group_of_root[root] < 0)
+            {
+                group_of_root[root] = groups.size();
+                groups.push_back(Group{ _levels[i], {}, {}, {} });
+            }
+
+            group_of[i] = group_of_root[root];
+            groups[group_of[i]].instructions.push_back(i);
+        }
+
+        // expressions that fold to a constant still need to provide their prediction
+        for (const auto & [id, index, level] : _outputs)
+        {
+            if (group_of[index] < 0)
+            {
+                groups.push_back(Group{ 0, {}, { std::make_tuple(id, index) }, { id } });
+            }
+        }
+
+        // determine the outputs and the consumers of each group
+        std::vector<unsigned> visited(n, std::numeric_limits<unsigned>::max());
+        std::vector<unsigned> consumed(groups.size(), std::numeric_limits<unsigned>::max());
+        for (unsigned k = 0; k < _outputs.size(); ++k)
+        {
+            const auto & [id, index, level] = _outputs[k];
+
+            if (group_of[index] >= 0)
+            {
+                groups[group_of[index]].outputs.push_back(std::make_tuple(id, index));
+            }
+
+            std::vector<unsigned> stack{ index };
+            while (! stack.empty())
+            {
+                const unsigned i = stack.back();
+                stack.pop_back();
+
+                if (visited[i] == k)
+                {
+                    continue;
+                }
+                visited[i] = k;
+
+                if ((group_of[i] >= 0) && (consumed[group_of[i]] != k))
+                {
+                    consumed[group_of[i]] = k;
+                    groups[group_of[i]].consumers.push_back(id);
+                }
+
+                for (const auto & o : operands(i))
+                {
+                    stack.push_back(o);
+                }
+            }
+        }
+
+        std::stable_sort(groups.begin(), groups.end(), [](const Group & a, const Group & b) { return a.level < b.level; });
+
+        _groups = std::move(groups);
+    }
+
+    unsigned
+    ExpressionProgram::size() const
+    {
+        return _instructions.size();
+    }
+
+    const std::vector<ExpressionProgram::Instruction> &
+    ExpressionProgram::instructions() const
+    {
+        return _instructions;
+    }
+
+    const std::vector<ExpressionProgram::Group> &
+    ExpressionProgram::groups() const
+    {
+        return _groups;
+    }
+
+    void
+    ExpressionProgram::evaluate(const unsigned & group, const double * predictions)
+    {
+        const auto &         instructions = _groups[group].instructions;
+        double *             values       = _values.data();
+        std::exception_ptr * errors       = _errors.data();
+
+        for (const auto & i : instructions)
+        {
+            const auto & instruction = _instructions[i];
+
+            // propagate an error raised for one of the operands
+            switch (instruction.opcode)
+            {
+                case Opcode::sum:
+                case Opcode::difference:
+                case Opcode::product:
+                case Opcode::ratio:
+                case Opcode::power:    errors[i] = errors[instruction.lhs] ? errors[instruction.lhs] : errors[instruction.rhs]; break;
+                case Opcode::function: errors[i] = errors[instruction.lhs]; break;
+                default:               errors[i] = nullptr; break;
+            }
+
+            if (errors[i])
+            {
+                values[i] = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+
+            try
+            {
+                switch (instruction.opcode)
+                {
+                    case Opcode::parameter:          values[i] = _parameters[instruction.index].evaluate(); break;
+                    case Opcode::kinematic_variable: values[i] = _kinematic_variables[instruction.index].evaluate(); break;
+                    case Opcode::prediction:         values[i] = predictions[instruction.index]; break;
+                    case Opcode::observable:         values[i] = _observables[instruction.index]->evaluate(); break;
+                    case Opcode::sum:                values[i] = values[instruction.lhs] + values[instruction.rhs]; break;
+                    case Opcode::difference:         values[i] = values[instruction.lhs] - values[instruction.rhs]; break;
+                    case Opcode::product:            values[i] = values[instruction.lhs] * values[instruction.rhs]; break;
+                    case Opcode::ratio:              values[i] = values[instruction.lhs] / values[instruction.rhs]; break;
+                    case Opcode::power:              values[i] = std::pow(values[instruction.lhs], values[instruction.rhs]); break;
+                    case Opcode::function:           values[i] = instruction.function(values[instruction.lhs]); break;
+                    case Opcode::constant:           break;
+                }
+            }
+            catch (...)
+            {
+                values[i] = std::numeric_limits<double>::quiet_NaN();
+                errors[i] = std::current_exception();
+            }
+        }
+    }
+
+    double
+    ExpressionProgram::operator[] (const unsigned & index) const
+    {
+        return _values[index];
+    }
+
+    const std::exception_ptr &
+    ExpressionProgram::error(const unsigned & index) const
+    {
+        return _errors[index];
+    }
+
+    /*
+     * ExpressionCompiler
+     */
+
+    ExpressionCompiler::ExpressionCompiler(ExpressionProgram & program, const unsigned & scope) :
+        _program(program),
+        _scope(scope)
+    {
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const BinaryExpression & e)
+    {
+        using Opcode = ExpressionProgram::Opcode;
+
+        unsigned lhs = std::visit(*this, *e.lhs);
+        unsigned rhs = std::visit(*this, *e.rhs);
+
+        const auto & instructions = _program._instructions;
+        if ((Opcode::constant == instructions[lhs].opcode) && (Opcode::constant == instructions[rhs].opcode))
+        {
+            return (*this)(ConstantExpression(BinaryExpression::Method(e.op)(instructions[lhs].value, instructions[rhs].value)));
+        }
+
+        Opcode opcode;
+        switch (e.op)
+        {
+            case '+': opcode = Opcode::sum; break;
+            case '-': opcode = Opcode::difference; break;
+            case '*': opcode = Opcode::product; break;
+            case '/': opcode = Opcode::ratio; break;
+            case '^': opcode = Opcode::power; break;
+            default:  throw InternalError("Unknown binary operator '" + stringify(e.op) + "' encountered in ExpressionCompiler::operator() ()");
+        }
+
+        // sums and products commute exactly in floating-point arithmetic
+        if (((Opcode::sum == opcode) || (Opcode::product == opcode)) && (rhs < lhs))
+        {
+            std::swap(lhs, rhs);
+        }
+
+        const unsigned level = std::max(_program._levels[lhs], _program._levels[rhs]);
+
+        return _program.emit(ExpressionProgram::Instruction{ opcode, lhs, rhs, 0, 0.0, nullptr }, level, 0);
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const FunctionExpression & e)
+    {
+        using Opcode = ExpressionProgram::Opcode;
+
+        const unsigned arg = std::visit(*this, *e.arg);
+
+        const auto & instructions = _program._instructions;
+        if (Opcode::constant == instructions[arg].opcode)
+        {
+            return (*this)(ConstantExpression(e.f(instructions[arg].value)));
+        }
+
+        return _program.emit(ExpressionProgram::Instruction{ Opcode::function, arg, 0, 0, 0.0, e.f }, _program._levels[arg], reinterpret_cast<std::uintptr_t>(e.f));
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ConstantExpression & e)
+    {
+        return _program.emit(ExpressionProgram::Instruction{ ExpressionProgram::Opcode::constant, 0, 0, 0, e.value, nullptr }, 0, std::bit_cast<std::uint64_t>(e.value));
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ObservableNameExpression &)
+    {
+        throw InternalError("Encountered ObservableNameExpression in ExpressionCompiler::operator() ()");
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ObservableExpression & e)
+    {
+        const unsigned size   = _program._instructions.size();
+        const unsigned result = _program.emit(ExpressionProgram::Instruction{ ExpressionProgram::Opcode::observable, 0, 0, static_cast<unsigned>(_program._observables.size()), 0.0, nullptr },
+                                              0,
+                                              reinterpret_cast<std::uintptr_t>(e.observable.get()));
+        if (result == size)
+        {
+            _program._observables.push_back(e.observable);
+        }
+
+        return result;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ParameterNameExpression &)
+    {
+        throw InternalError("Encountered ParameterNameExpression in ExpressionCompiler::operator() ()");
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const ParameterExpression & e)
+    {
+        const unsigned size   = _program._instructions.size();
+        const unsigned result = _program.emit(ExpressionProgram::Instruction{ ExpressionProgram::Opcode::parameter, 0, 0, static_cast<unsigned>(_program._parameters.size()), 0.0, nullptr },
+                                              0,
+                                              e.parameter.id());
+        if (result == size)
+        {
+            _program._parameters.push_back(e.parameter);
+        }
+
+        return result;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const KinematicVariableNameExpression &)
+    {
+        throw InternalError("Encountered KinematicVariableNameExpression in ExpressionCompiler::operator() ()");
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const KinematicVariableExpression & e)
+    {
+        // the ids of kinematic variables are only unique within one Kinematics object
+        const std::uint64_t payload = (static_cast<std::uint64_t>(_scope) << 32) | e.kinematic_variable.id();
+
+        const unsigned size   = _program._instructions.size();
+        const unsigned result = _program.emit(
+                ExpressionProgram::Instruction{ ExpressionProgram::Opcode::kinematic_variable, 0, 0, static_cast<unsigned>(_program._kinematic_variables.size()), 0.0, nullptr },
+                0,
+                payload);
+        if (result == size)
+        {
+            _program._kinematic_variables.push_back(e.kinematic_variable);
+        }
+
+        return result;
+    }
+
+    unsigned
+    ExpressionCompiler::operator() (const CachedObservableExpression & e)
+    {
+        // the prediction of another expression is available only after the level of that expression has been evaluated
+        const auto     i     = _program._output_levels.find(e.id.value());
+        const unsigned level = (_program._output_levels.end() == i) ? 0 : i->second + 1;
+
+        return _program.emit(ExpressionProgram::Instruction{ ExpressionProgram::Opcode::prediction, 0, 0, e.id.value(), 0.0, nullptr }, level, e.id.value());
+    }
+} // namespace eos::exp
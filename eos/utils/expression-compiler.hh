@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH
+#define EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH 1
+
+#include <eos/observable-fwd.hh>
+#include <eos/utils/expression-fwd.hh>
+#include <eos/utils/expression.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/parameters.hh>
+
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace eos::exp
+{
+    /*
+     * A set of expressions, lowered to a flat register bytecode.
+     *
+     * Each instruction writes to the register with the same index as the instruction, and reads its operands
+     * from registers with smaller indices. Constant subexpressions are folded, and identical subexpressions
+     * are emitted only once across all expressions of the program.
+     *
+     * The expressions are added in the order in which they depend on each other, i.e., an expression that reads
+     * the prediction of another expression of the same program must be added after it. Each expression has a
+     * level, which exceeds the levels of all expressions whose predictions it reads. After schedule(), the
+     * instructions of each level are partitioned into groups that do not share any register. The groups of
+     * one level can be evaluated concurrently, once all groups of the lower levels have been evaluated.
+     */
+    class ExpressionProgram
+    {
+        public:
+            enum class Opcode : std::uint8_t
+            {
+                constant,
+                parameter,
+                kinematic_variable,
+                prediction,
+                observable,
+                sum,
+                difference,
+                product,
+                ratio,
+                power,
+                function
+            };
+
+            struct Instruction
+            {
+                    Opcode opcode;
+
+                    // the registers of the operands
+                    unsigned lhs, rhs;
+
+                    // the index of the parameter, kinematic variable, observable, or prediction
+                    unsigned index;
+
+                    double value;
+
+                    FunctionExpression::FunctionType function;
+            };
+
+            // The instructions of one group, and the predictions that depend on them
+            struct Group
+            {
+                    unsigned level;
+
+                    std::vector<unsigned> instructions;
+
+                    // the registers holding the predictions of the expressions that are computed by this group
+                    std::vector<std::tuple<ObservableCache::ObservableId, unsigned>> outputs;
+
+                    // all expressions that read any of this group's registers, directly or through other groups
+                    std::vector<ObservableCache::ObservableId> consumers;
+            };
+
+        private:
+            friend class ExpressionCompiler;
+
+            std::vector<Instruction> _instructions;
+
+            std::vector<unsigned> _levels;
+
+            std::vector<Parameter> _parameters;
+
+            std::vector<KinematicVariable> _kinematic_variables;
+
+            std::vector<ObservablePtr> _observables;
+
+            // maps the opcode, the operands, and the payload of each instruction to its register
+            std::map<std::tuple<Opcode, unsigned, unsigned, std::uint64_t>, unsigned> _registers;
+
+            // the ObservableId, register, and level of each expression
+            std::vector<std::tuple<ObservableCache::ObservableId, unsigned, unsigned>> _outputs;
+
+            // maps the ObservableId of each expression to its level
+            std::map<unsigned, unsigned> _output_levels;
+
+            std::vector<Group> _groups;
+
+            std::vector<double> _values;
+
+            // the error raised when computing each register, either by its own instruction or by one of its operands
+            std::vector<std::exception_ptr> _errors;
+
+            unsigned emit(const Instruction & instruction, const unsigned & level, const std::uint64_t & payload);
+
+        public:
+            ExpressionProgram();
+            ~ExpressionProgram();
+
+            /*!
+             * Compile an expression, whose value is the prediction for a given observable.
+             *
+             * @param expression The expression, in which all observables are replaced by cached observables.
+             * @param id         The id of the prediction.
+             */
+            void add(const Expression & expression, const ObservableCache::ObservableId & id);
+
+            /// Partition the instructions into levels and groups. Must be called after the last call to add().
+            void schedule();
+
+            /// Retrieve the number of instructions.
+            unsigned size() const;
+
+            /// Retrieve the instructions.
+            const std::vector<Instruction> & instructions() const;
+
+            /// Retrieve the groups, ordered by their level.
+            const std::vector<Group> & groups() const;
+
+            /*!
+             * Evaluate the instructions of a group.
+             *
+             * If an instruction raises an error, its register and the registers of all instructions that depend on it
+             * are set to NaN, and the error is retained for these registers. All other instructions are evaluated as usual.
+             *
+             * @param group       The index of the group.
+             * @param predictions The predictions of the observable cache, including those of all expressions of lower levels.
+             */
+            void evaluate(const unsigned & group, const double * predictions);
+
+            /// Retrieve the value of a register.
+            double operator[] (const unsigned & index) const;
+
+            /// Retrieve the error raised during the last evaluation of a register, if any.
+            const std::exception_ptr & error(const unsigned & index) const;
+    };
+
+    // Visit the expression tree, and emit the instructions of the program
+    class ExpressionCompiler
+    {
+        private:
+            ExpressionProgram & _program;
+
+            // identifies the expression being compiled; kinematic variables are only shared within one expression
+            unsigned _scope;
+
+        public:
+            ExpressionCompiler(ExpressionProgram & program, const unsigned & scope);
+            ~ExpressionCompiler() = default;
+
+            unsigned operator() (const BinaryExpression & e);
+
+            unsigned operator() (const FunctionExpression & e);
+
+            unsigned operator() (const ConstantExpression & e);
+
+            unsigned operator() (const ObservableNameExpression & e);
+
+            unsigned operator() (const ObservableExpression & e);
+
+            unsigned operator() (const ParameterNameExpression & e);
+
+            unsigned operator() (const ParameterExpression & e);
+
+            unsigned operator() (const KinematicVariableNameExpression & e);
+
+            unsigned operator() (const KinematicVariableExpression & e);
+
+            unsigned operator() (const CachedObservableExpression & e);
+    };
+} // namespace eos::exp
+
+#endif
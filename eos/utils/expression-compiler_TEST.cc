@@ -0,0 +1,270 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/expression-compiler.hh>
+#include <eos/utils/expression-evaluator.hh>
+#include <eos/utils/expression-maker.hh>
+#include <eos/utils/expression-observable.hh>
+#include <eos/utils/expression-parser-impl.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <test/test.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos::exp;
+using namespace eos;
+
+namespace
+{
+    ExpressionPtr
+    parse(const std::string & input)
+    {
+        using It = std::string::const_iterator;
+
+        ExpressionParser<It> parser;
+        ExpressionPtr        result;
+        It                   first(input.begin()), last(input.end());
+        if (! qi::phrase_parse(first, last, parser, ascii::space, result) || (first != last))
+        {
+            throw InternalError("Cannot parse '" + input + "'");
+        }
+
+        return result;
+    }
+
+    unsigned
+    count(const ExpressionProgram & program, const ExpressionProgram::Opcode & opcode)
+    {
+        const auto & instructions = program.instructions();
+
+        return std::count_if(instructions.cbegin(), instructions.cend(), [&](const ExpressionProgram::Instruction & i) { return i.opcode == opcode; });
+    }
+
+    double
+    fail_if_negative(const double & x)
+    {
+        if (x < 0.0)
+        {
+            throw InternalError("negative argument");
+        }
+
+        return x;
+    }
+} // namespace
+
+class ExpressionCompilerTest : public TestCase
+{
+    public:
+        ExpressionCompilerTest() :
+            TestCase("expression_compiler_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            using Opcode = ExpressionProgram::Opcode;
+            using Id     = ObservableCache::ObservableId;
+
+            Parameters p = Parameters::Defaults();
+            p["mass::c"]        = 1.25;
+            p["mass::b(MSbar)"] = 4.2;
+
+            Kinematics k({
+                { "q2", 2.0 }
+            });
+
+            ExpressionMaker     maker(p, k, Options());
+            ExpressionEvaluator evaluator;
+
+            // constant folding and common subexpressions across expressions
+            {
+                Expression e1 = std::visit(maker, *parse("[[mass::c]] * [[mass::b(MSbar)]] + 2 * 3"));
+                Expression e2 = std::visit(maker, *parse("exp(0) * ([[mass::b(MSbar)]] * [[mass::c]]) - {q2}"));
+                Expression e3 = std::visit(maker, *parse("2^3 - 1"));
+
+                ExpressionProgram program;
+                program.add(e1, Id(0));
+                program.add(e2, Id(1));
+                program.add(e3, Id(2));
+                program.schedule();
+
+                // one load per parameter and kinematic variable, and the product of both parameters is shared
+                TEST_CHECK_EQUAL(count(program, Opcode::parameter), 2u);
+                TEST_CHECK_EQUAL(count(program, Opcode::kinematic_variable), 1u);
+                TEST_CHECK_EQUAL(count(program, Opcode::function), 0u);
+                TEST_CHECK_EQUAL(count(program, Opcode::product), 2u);
+                TEST_CHECK_EQUAL(count(program, Opcode::sum), 1u);
+                TEST_CHECK_EQUAL(count(program, Opcode::difference), 1u);
+                TEST_CHECK_EQUAL(count(program, Opcode::power), 0u);
+
+                // the first two expressions share the product; the third one is a constant
+                const auto & groups = program.groups();
+                TEST_CHECK_EQUAL(groups.size(), 2u);
+
+                std::vector<double> predictions(3, 0.0);
+                for (unsigned g = 0; g < groups.size(); ++g)
+                {
+                    TEST_CHECK_EQUAL(groups[g].level, 0u);
+
+                    program.evaluate(g, predictions.data());
+                    for (const auto & [id, index] : groups[g].outputs)
+                    {
+                        predictions[id.value()] = program[index];
+                    }
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(predictions[0], std::visit(evaluator, e1), 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(predictions[1], std::visit(evaluator, e2), 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(predictions[2], 7.0, 1e-14);
+            }
+
+            // expressions that read the predictions of other expressions are evaluated at higher levels
+            {
+                ObservableCache cache(p);
+                const Id        mc = cache.add(ObservablePtr(new ObservableStub(p, "mass::c")));
+
+                const auto cached = [&](const Id & id) { return ExpressionPtr(new Expression(CachedObservableExpression(cache, id, KinematicsSpecification()))); };
+                const auto constant = [](const double & value) { return ExpressionPtr(new Expression(ConstantExpression(value))); };
+
+                // Id(1) = 2 * m_c, Id(2) = m_b / m_c, Id(3) = Id(1) + Id(2), Id(4) = Id(3) * m_b
+                Expression e1 = BinaryExpression('*', constant(2.0), cached(mc));
+                Expression e2 = std::visit(maker, *parse("[[mass::b(MSbar)]] / [[mass::c]]"));
+                Expression e3 = BinaryExpression('+', cached(Id(1)), cached(Id(2)));
+                Expression e4 = BinaryExpression('*', cached(Id(3)), ExpressionPtr(new Expression(std::visit(maker, *parse("[[mass::b(MSbar)]]")))));
+
+                ExpressionProgram program;
+                program.add(e1, Id(1));
+                program.add(e2, Id(2));
+                program.add(e3, Id(3));
+                program.add(e4, Id(4));
+                program.schedule();
+
+                const auto & groups = program.groups();
+                TEST_CHECK_EQUAL(groups.size(), 4u);
+                TEST_CHECK_EQUAL(groups[0].level, 0u);
+                TEST_CHECK_EQUAL(groups[1].level, 0u);
+                TEST_CHECK_EQUAL(groups[2].level, 1u);
+                TEST_CHECK_EQUAL(groups[3].level, 2u);
+
+                // the load of m_b is computed at level 0, but also read at level 2
+                const auto consumes = [&](const unsigned & g, const Id & id)
+                {
+                    return std::find(groups[g].consumers.cbegin(), groups[g].consumers.cend(), id) != groups[g].consumers.cend();
+                };
+                TEST_CHECK(consumes(1, Id(2)));
+                TEST_CHECK(consumes(1, Id(4)));
+                TEST_CHECK(! consumes(0, Id(4)));
+
+                std::vector<double> predictions{ 1.25, 0.0, 0.0, 0.0, 0.0 };
+                for (unsigned g = 0; g < groups.size(); ++g)
+                {
+                    program.evaluate(g, predictions.data());
+                    for (const auto & [id, index] : groups[g].outputs)
+                    {
+                        predictions[id.value()] = program[index];
+                    }
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(predictions[1], 2.5, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(predictions[2], 4.2 / 1.25, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(predictions[4], (2.5 + 4.2 / 1.25) * 4.2, 1e-14);
+            }
+
+            // expression observables in an observable cache
+            {
+                ObservableCache cache(p);
+                const Id        id1 = cache.add(ObservablePtr(new ExpressionObservable("test::e1", p, k, Options(), parse("[[mass::c]] * [[mass::b(MSbar)]] + {q2}"))));
+                const Id        id2 = cache.add(ObservablePtr(new ExpressionObservable("test::e2", p, k, Options(), parse("[[mass::b(MSbar)]] * [[mass::c]] * 2"))));
+                const Id        id3 = cache.add(ObservablePtr(new ExpressionObservable("test::e3", p, k, Options(), parse("[[mass::tau]]^2"))));
+
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 1.25 * 4.2 + 2.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 1.25 * 4.2 * 2.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(cache[id3], std::pow(p["mass::tau"].evaluate(), 2), 1e-14);
+
+                p["mass::c"] = 1.3;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 1.3 * 4.2 + 2.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 1.3 * 4.2 * 2.0, 1e-14);
+                TEST_CHECK(cache.generation(id3) < cache.generation());
+
+                k["q2"] = 3.0;
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 1.3 * 4.2 + 3.0, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(cache[id2], 1.3 * 4.2 * 2.0, 1e-14);
+
+                // adding another expression recompiles the program
+                const Id id4 = cache.add(ObservablePtr(new ExpressionObservable("test::e4", p, k, Options(), parse("[[mass::c]] - 1"))));
+                cache.update();
+                TEST_CHECK_NEARLY_EQUAL(cache[id4], 0.3, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(cache[id1], 1.3 * 4.2 + 3.0, 1e-14);
+            }
+
+            // an error only affects the expressions that depend on the failing instruction
+            {
+                p["mass::c"] = 1.25;
+
+                FunctionExpression f;
+                f.f     = &fail_if_negative;
+                f.fname = "fail_if_negative";
+                f.arg   = ExpressionPtr(new Expression(std::visit(maker, *parse("[[mass::c]] - 2"))));
+
+                // both expressions share the load of m_c, and thus form a single group
+                Expression e1 = BinaryExpression('*', ExpressionPtr(new Expression(f)), ExpressionPtr(new Expression(std::visit(maker, *parse("[[mass::b(MSbar)]]")))));
+                Expression e2 = std::visit(maker, *parse("[[mass::c]] * 2"));
+
+                ExpressionProgram program;
+                program.add(e1, Id(0));
+                program.add(e2, Id(1));
+                program.schedule();
+
+                const auto & groups = program.groups();
+                TEST_CHECK_EQUAL(groups.size(), 1u);
+                TEST_CHECK_EQUAL(groups[0].outputs.size(), 2u);
+
+                std::vector<double> predictions(2, 0.0);
+                TEST_CHECK_NO_THROW(program.evaluate(0, predictions.data()));
+
+                const unsigned r1 = std::get<1>(groups[0].outputs[0]);
+                const unsigned r2 = std::get<1>(groups[0].outputs[1]);
+                TEST_CHECK(program.error(r1) != nullptr);
+                TEST_CHECK(std::isnan(program[r1]));
+                TEST_CHECK(program.error(r2) == nullptr);
+                TEST_CHECK_NEARLY_EQUAL(program[r2], 1.25 * 2.0, 1e-14);
+
+                // the error is cleared once the instruction succeeds
+                p["mass::c"] = 2.5;
+                program.evaluate(0, predictions.data());
+                TEST_CHECK(program.error(r1) == nullptr);
+                TEST_CHECK_NEARLY_EQUAL(program[r1], 0.5 * 4.2, 1e-14);
+                TEST_CHECK_NEARLY_EQUAL(program[r2], 2.5 * 2.0, 1e-14);
+            }
+
+            // names must be resolved before compilation
+            {
+                ExpressionProgram program;
+                TEST_CHECK_THROWS(InternalError, program.add(*parse("[[mass::c]]"), Id(0)));
+            }
+        }
+} expression_compiler_test;
@@ -1,6 +1,6 @@
 /* vim: set sw=4 sts=4 et foldmethod=syntax : */
 /*
- * Copyright (c) 2011 Danny van Dyk
+ * Copyright (c) 2011, 2026 Danny van Dyk
  *
  * This file is part of the EOS project. EOS is free software;
  * you can redistribute it and/or modify it under the terms of the GNU General
@@ -16,13 +16,22 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/utils/destringify.hh>
 #include <eos/utils/memoise.hh>
 
+#include <cstdlib>
+
 namespace eos
 {
     MemoisationControl::MemoisationControl() :
-        _mutex(new Mutex)
+        _mutex(new Mutex),
+        _capacity(100000u)
     {
+        const char * env_capacity = std::getenv("EOS_MEMOISE_CAPACITY");
+        if (env_capacity)
+        {
+            _capacity = destringify<unsigned long>(env_capacity);
+        }
     }
 
     MemoisationControl::~MemoisationControl()
@@ -31,11 +40,14 @@ namespace eos
     }
 
     void
-    MemoisationControl::register_clear_function(const std::function<void()> & clear_function)
+    MemoisationControl::register_memoiser(const std::function<void()> & clear_function, const std::function<MemoisationStatistics()> & statistics_function,
+                                          const std::function<void(const unsigned long &)> & capacity_function)
     {
         Lock l(*_mutex);
 
         _clear_functions.push_back(clear_function);
+        _statistics_functions.push_back(statistics_function);
+        _capacity_functions.push_back(capacity_function);
     }
 
     void
@@ -48,4 +60,43 @@ namespace eos
             _clear_function();
         }
     }
+
+    MemoisationStatistics
+    MemoisationControl::statistics() const
+    {
+        Lock l(*_mutex);
+
+        MemoisationStatistics result{ 0, 0, 0, 0 };
+        for (auto & _statistics_function : _statistics_functions)
+        {
+            MemoisationStatistics s  = _statistics_function();
+            result.hits             += s.hits;
+            result.misses           += s.misses;
+            result.evictions        += s.evictions;
+            result.entries          += s.entries;
+        }
+
+        return result;
+    }
+
+    unsigned long
+    MemoisationControl::capacity() const
+    {
+        Lock l(*_mutex);
+
+        return _capacity;
+    }
+
+    void
+    MemoisationControl::set_capacity(const unsigned long & capacity)
+    {
+        Lock l(*_mutex);
+
+        _capacity = capacity;
+
+        for (auto & _capacity_function : _capacity_functions)
+        {
+            _capacity_function(capacity);
+        }
+    }
 } // namespace eos
@@ -1,7 +1,7 @@
 /* vim: set sw=4 sts=4 et foldmethod=syntax : */
 
 /*
- * Copyright (c) 2010, 2011, 2013, 2022 Danny van Dyk
+ * Copyright (c) 2010, 2011, 2013, 2022, 2026 Danny van Dyk
  * Copyright (c) 2010 Christian Wacker
  *
  * This file is part of the EOS project. EOS is free software;
@@ -26,8 +26,12 @@
 #include <eos/utils/lock.hh>
 #include <eos/utils/mutex.hh>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <list>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -96,23 +100,78 @@ namespace eos
         };
     } // namespace implementation
 
+    /*!
+     * Statistics on the use of one or more Memoiser objects.
+     */
+    struct MemoisationStatistics
+    {
+            /// Number of lookups that found an existing memoisation.
+            unsigned long hits;
+
+            /// Number of lookups that required a call to the memoised function.
+            unsigned long misses;
+
+            /// Number of memoisations that have been evicted to respect the capacity.
+            unsigned long evictions;
+
+            /// Number of memoisations currently held.
+            unsigned long entries;
+    };
+
     class MemoisationControl : public InstantiationPolicy<MemoisationControl, Singleton>
     {
         private:
             Mutex * const _mutex;
 
+            unsigned long _capacity;
+
             std::vector<std::function<void()>> _clear_functions;
 
+            std::vector<std::function<MemoisationStatistics()>> _statistics_functions;
+
+            std::vector<std::function<void(const unsigned long &)>> _capacity_functions;
+
         public:
             MemoisationControl();
 
             ~MemoisationControl();
 
-            void register_clear_function(const std::function<void()> & clear_function);
-
+            /*!
+             * Register a Memoiser with the control.
+             *
+             * @param clear_function      Removes all of the memoiser's memoisations.
+             * @param statistics_function Retrieves the memoiser's statistics.
+             * @param capacity_function   Changes the memoiser's capacity.
+             */
+            void register_memoiser(const std::function<void()> & clear_function, const std::function<MemoisationStatistics()> & statistics_function,
+                                   const std::function<void(const unsigned long &)> & capacity_function);
+
+            /// Remove the memoisations of all memoisers.
             void clear();
+
+            /// Retrieve the statistics, summed over all memoisers.
+            MemoisationStatistics statistics() const;
+
+            /// Retrieve the maximal number of memoisations held by each memoiser.
+            unsigned long capacity() const;
+
+            /*!
+             * Change the maximal number of memoisations held by each memoiser.
+             *
+             * The default capacity can be set through the environment variable EOS_MEMOISE_CAPACITY.
+             *
+             * @param capacity The new capacity of each existing and future memoiser.
+             */
+            void set_capacity(const unsigned long & capacity);
     };
 
+    /*!
+     * Memoiser keeps the results of calls to functions with a common signature.
+     *
+     * The memoisations are distributed across independently locked shards, which are
+     * each evicted in least-recently-used order once they exceed their share of the capacity.
+     * The memoised function is called outside of any lock.
+     */
     template <typename Result_, typename... Params_> class Memoiser : public InstantiationPolicy<Memoiser<Result_, Params_...>, Singleton>
     {
         public:
@@ -120,58 +179,150 @@ namespace eos
             using KeyType      = std::tuple<FunctionType, Params_...>;
 
         private:
-            Mutex * const _mutex;
+            static constexpr unsigned number_of_shards = 16;
+
+            struct Shard
+            {
+                    Mutex mutex;
+
+                    // all memoisations, with the most recently used ones at the front
+                    std::list<std::pair<KeyType, Result_>> entries;
+
+                    std::unordered_map<KeyType, typename std::list<std::pair<KeyType, Result_>>::iterator> index;
+            };
+
+            std::array<Shard, number_of_shards> _shards;
+
+            std::atomic<unsigned long> _shard_capacity;
+
+            std::atomic<unsigned long> _hits, _misses, _evictions;
+
+            static unsigned
+            _shard_index(const KeyType & key)
+            {
+                // mix the bits of the hash, since the tuple hash merely combines the raw bits of its elements
+                uint64_t h = std::hash<KeyType>()(key);
+                h         ^= h >> 33;
+                h         *= 0xff51afd7ed558ccdul;
+                h         ^= h >> 33;
+
+                return h % number_of_shards;
+            }
+
+            static unsigned long
+            _per_shard(const unsigned long & capacity)
+            {
+                return std::max(1ul, (capacity + number_of_shards - 1) / number_of_shards);
+            }
 
-            std::unordered_map<KeyType, Result_> _memoisations;
+            // Requires the shard's mutex to be held
+            void
+            _evict(Shard & shard)
+            {
+                while (shard.entries.size() > _shard_capacity)
+                {
+                    shard.index.erase(shard.entries.back().first);
+                    shard.entries.pop_back();
+                    _evictions += 1;
+                }
+            }
 
         public:
             Memoiser() :
-                _mutex(new Mutex)
+                _shard_capacity(_per_shard(MemoisationControl::instance()->capacity())),
+                _hits(0),
+                _misses(0),
+                _evictions(0)
             {
-                MemoisationControl::instance()->register_clear_function(std::bind(&Memoiser<Result_, Params_...>::clear, this));
+                MemoisationControl::instance()->register_memoiser(std::bind(&Memoiser<Result_, Params_...>::clear, this),
+                                                                  std::bind(&Memoiser<Result_, Params_...>::statistics, this),
+                                                                  std::bind(&Memoiser<Result_, Params_...>::set_capacity, this, std::placeholders::_1));
             }
 
-            ~Memoiser() { delete _mutex; }
+            ~Memoiser() {}
 
             Result_
             operator() (const FunctionType & f, const Params_ &... p)
             {
-                Lock l(*_mutex);
-
                 KeyType key(f, p...);
-                auto    i = _memoisations.find(key);
+                Shard & shard = _shards[_shard_index(key)];
 
-                if (_memoisations.end() != i)
                 {
-                    return i->second;
+                    Lock l(shard.mutex);
+
+                    auto i = shard.index.find(key);
+                    if (shard.index.end() != i)
+                    {
+                        _hits += 1;
+                        shard.entries.splice(shard.entries.begin(), shard.entries, i->second);
+
+                        return i->second->second;
+                    }
                 }
 
+                _misses += 1;
+
                 Result_ result = f(p...);
 
-                if (_memoisations.size() > 100000u)
                 {
-                    _memoisations.clear();
+                    Lock l(shard.mutex);
+
+                    // another thread might have memoised the same call in the meantime
+                    if (shard.index.end() == shard.index.find(key))
+                    {
+                        shard.entries.emplace_front(key, result);
+                        shard.index.emplace(key, shard.entries.begin());
+                        _evict(shard);
+                    }
                 }
 
-                _memoisations.insert(std::pair<KeyType, Result_>(key, result));
-
                 return result;
             }
 
             void
             clear()
             {
-                Lock l(*_mutex);
+                for (auto & shard : _shards)
+                {
+                    Lock l(shard.mutex);
+
+                    shard.index.clear();
+                    shard.entries.clear();
+                }
+            }
+
+            void
+            set_capacity(const unsigned long & capacity)
+            {
+                _shard_capacity = _per_shard(capacity);
+
+                for (auto & shard : _shards)
+                {
+                    Lock l(shard.mutex);
+
+                    _evict(shard);
+                }
+            }
 
-                _memoisations.clear();
+            MemoisationStatistics
+            statistics()
+            {
+                return MemoisationStatistics{ _hits, _misses, _evictions, number_of_memoisations() };
             }
 
             unsigned
-            number_of_memoisations() const
+            number_of_memoisations()
             {
-                Lock l(*_mutex);
+                unsigned result = 0;
+
+                for (auto & shard : _shards)
+                {
+                    Lock l(shard.mutex);
 
-                return _memoisations.size();
+                    result += shard.entries.size();
+                }
+
+                return result;
             }
     };
 
@@ -1,7 +1,7 @@
 /* vim: set sw=4 sts=4 et foldmethod=syntax : */
 
 /*
- * Copyright (c) 2010, 2011 Danny van Dyk
+ * Copyright (c) 2010, 2011, 2026 Danny van Dyk
  *
  * This file is part of the EOS project. EOS is free software;
  * you can redistribute it and/or modify it under the terms of the GNU General
@@ -107,5 +107,31 @@ class MemoiseTest : public TestCase
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f2, 0.0, 0.0));
             }
+
+            /* Test statistics and eviction */
+            {
+                const MemoisationStatistics before = MemoisationControl::instance()->statistics();
+
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+
+                const MemoisationStatistics after = MemoisationControl::instance()->statistics();
+                TEST_CHECK_EQUAL(before.hits + 1, after.hits);
+                TEST_CHECK_EQUAL(before.misses + 1, after.misses);
+                TEST_CHECK_EQUAL(1, number_of_memoisations(f1, 0.0, 0.0));
+
+                // Reducing the capacity evicts memoisations, but never exceeds the capacity
+                const unsigned long capacity = MemoisationControl::instance()->capacity();
+                MemoisationControl::instance()->set_capacity(16);
+                for (unsigned i = 0; i < 1000; ++i)
+                {
+                    TEST_CHECK_EQUAL(i / 4.0, memoise(f1, double(i), 4.0));
+                }
+                TEST_CHECK(number_of_memoisations(f1, 0.0, 0.0) <= 16);
+                TEST_CHECK(MemoisationControl::instance()->statistics().evictions >= 1000 - 16);
+
+                MemoisationControl::instance()->set_capacity(capacity);
+                MemoisationControl::instance()->clear();
+            }
         }
 } memoise_test;
@@ -19,19 +19,24 @@
  */
 
 #include <eos/utils/expression-cacher.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-observable.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
 #include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
 #include <limits>
 #include <map>
 #include <tuple>
 #include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -57,8 +62,14 @@ namespace eos
             // Contains each cacheable observable and its associated index
             std::multimap<std::type_index, std::tuple<CacheableObservable *, ObservableCache::ObservableId>> cacheable_observables;
 
-            // Contains each cached observable and its associated index
-            std::vector<std::tuple<ObservablePtr, ObservableCache::ObservableId>> cached_observables;
+            // Maps the hash key of each unique observable to its index
+            std::unordered_multimap<std::size_t, unsigned> observable_index;
+
+            // Maps the hash key of each cacheable observable, based on its type rather than its name, to its entry in cacheable_observables
+            std::unordered_multimap<std::size_t, std::tuple<CacheableObservable *, ObservableCache::ObservableId>> cacheable_observable_index;
+
+            // Contains each cached observable, its associated index, and the index of the cacheable observable it was created from
+            std::vector<std::tuple<ObservablePtr, ObservableCache::ObservableId, ObservableCache::ObservableId>> cached_observables;
 
             // Contains each expression observable and its associated index
             std::vector<std::tuple<ObservablePtr, ObservableCache::ObservableId>> expression_observables;
@@ -66,13 +77,108 @@ namespace eos
             // Contains values of all observables
             std::vector<double> predictions;
 
+            // Associates a parameter with the observables that use it
+            struct ParameterDependency
+            {
+                    Parameter parameter;
+
+                    // the parameter's generation as seen during the last update
+                    unsigned long generation;
+
+                    // indices of all observables that use this parameter
+                    std::vector<unsigned> observables;
+            };
+
+            // Contains the dependency index, i.e., one entry per parameter used by any observable
+            std::vector<ParameterDependency> dependencies;
+
+            // Maps a parameter id to its entry in the dependency index
+            std::map<Parameter::Id, unsigned> dependency_indices;
+
+            // Contains the kinematic variables of each observable, and their values as seen during the last update
+            std::vector<std::vector<KinematicVariable>> kinematic_variables;
+            std::vector<std::vector<double>>            kinematic_values;
+
+            // Marks observables that do not report any used parameter; these are re-evaluated in every update
+            std::vector<char> untracked;
+
+            // Marks observables that need to be re-evaluated in the next update
+            std::vector<char> dirty;
+
+            // Set if observables have been added since the last update
+            bool added;
+
+            // Counts the updates
+            unsigned long generation;
+
+            // Contains the update in which each prediction last changed its value
+            std::vector<unsigned long> changed;
+
+            // The bytecode of all expression observables, and whether it reflects the current set of expression observables
+            exp::ExpressionProgram program;
+            bool                   compiled;
+
+            // Minimal number of instructions per level for which the expression observables are evaluated in parallel
+            static constexpr std::size_t min_parallel_instructions = 4096;
+
             Implementation(const Parameters & parameters) :
-                parameters(parameters)
+                parameters(parameters),
+                added(false),
+                generation(0),
+                compiled(false)
             {
             }
 
             ~Implementation() {}
 
+            static void
+            combine_hash(std::size_t & seed, std::size_t value)
+            {
+                seed ^= value + 0x9e3779b97f4a7c15ul + (seed << 6) + (seed >> 2);
+            }
+
+            /*
+             * Compute a hash key from the options and the ids of the used kinematic variables.
+             *
+             * Observables that compare equal in identical_observables() yield the same key.
+             * The values of the kinematic variables do not enter the key, since they can be changed
+             * after an observable has been added. A matching key must therefore always be confirmed
+             * by a full comparison, which includes the current kinematics.
+             */
+            static std::size_t
+            hash_key(Observable & observable)
+            {
+                std::size_t result = 0;
+
+                combine_hash(result, std::hash<std::string>()(observable.options().as_string()));
+
+                const KinematicUser & kinematic_user = static_cast<const KinematicUser &>(observable);
+                for (auto k = kinematic_user.begin_kinematics(), k_end = kinematic_user.end_kinematics(); k != k_end; ++k)
+                {
+                    combine_hash(result, std::hash<KinematicVariable::Id>()(*k));
+                }
+
+                return result;
+            }
+
+            static std::size_t
+            observable_key(Observable & observable)
+            {
+                std::size_t result = hash_key(observable);
+                combine_hash(result, std::hash<std::string>()(observable.name().str()));
+
+                return result;
+            }
+
+            static std::size_t
+            cacheable_observable_key(const std::type_index & type_index, CacheableObservable & observable)
+            {
+                std::size_t result = hash_key(observable);
+                combine_hash(result, type_index.hash_code());
+
+                return result;
+            }
+
             static bool
             identical_observables(const ObservablePtr & lhs, const ObservablePtr & rhs)
             {
@@ -108,6 +214,304 @@ namespace eos
                 return true;
             }
 
+            // Record the parameters and kinematic variables used by a newly added observable
+            void
+            track(const ObservablePtr & observable, unsigned index)
+            {
+                const ParameterUser & parameter_user = static_cast<const ParameterUser &>(*observable);
+                for (const auto & id : parameter_user)
+                {
+                    auto i = dependency_indices.find(id);
+                    if (dependency_indices.end() == i)
+                    {
+                        Parameter parameter = parameters[id];
+                        i                   = dependency_indices.insert(std::make_pair(id, dependencies.size())).first;
+                        dependencies.push_back(ParameterDependency{ parameter, parameter.generation(), {} });
+                    }
+
+                    dependencies[i->second].observables.push_back(index);
+                }
+
+                Kinematics                     k = observable->kinematics();
+                std::vector<KinematicVariable> variables(k.begin(), k.end());
+                std::vector<double>            values;
+                values.reserve(variables.size());
+                for (const auto & v : variables)
+                {
+                    values.push_back(v.evaluate());
+                }
+
+                kinematic_variables.push_back(std::move(variables));
+                kinematic_values.push_back(std::move(values));
+                untracked.push_back(parameter_user.begin() == parameter_user.end());
+                dirty.push_back(true);
+                changed.push_back(generation);
+                added = true;
+            }
+
+            // Determine which observables need to be re-evaluated
+            void
+            mark_dirty()
+            {
+                // an observable needs to be re-evaluated for other reasons than a change of its parameters
+                bool forced = added;
+
+                for (auto & d : dependencies)
+                {
+                    const unsigned long generation = d.parameter.generation();
+                    if (generation == d.generation)
+                    {
+                        continue;
+                    }
+
+                    d.generation = generation;
+                    for (const auto & o : d.observables)
+                    {
+                        dirty[o] = true;
+                    }
+                }
+
+                for (unsigned i = 0; i < observables.size(); ++i)
+                {
+                    if (untracked[i])
+                    {
+                        dirty[i] = true;
+                        forced   = true;
+                    }
+
+                    auto & variables = kinematic_variables[i];
+                    auto & values    = kinematic_values[i];
+                    for (unsigned j = 0; j < variables.size(); ++j)
+                    {
+                        const double value = variables[j].evaluate();
+                        if (value == values[j])
+                        {
+                            continue;
+                        }
+
+                        values[j] = value;
+                        dirty[i]  = true;
+                        forced    = true;
+                    }
+                }
+
+                // cached observables read the intermediate result prepared by their cacheable observable
+                for (const auto & co : cached_observables)
+                {
+                    if (dirty[std::get<2>(co).value()])
+                    {
+                        dirty[std::get<1>(co).value()] = true;
+                    }
+                }
+
+                // expression observables can rely on any other observable; their parameter ids cover
+                // those of the referenced observables, but not any other reason for re-evaluation
+                if (forced)
+                {
+                    for (const auto & eo : expression_observables)
+                    {
+                        dirty[std::get<1>(eo).value()] = true;
+                    }
+                }
+
+                added = false;
+            }
+
+            // Store a prediction, and record whether it has changed
+            void
+            store(const unsigned & index, const double & value)
+            {
+                const double previous = predictions[index];
+                predictions[index]    = value;
+
+                // NaN does not compare equal to itself, but an invalid prediction that stays invalid has not changed
+                if ((value != previous) && ! (std::isnan(value) && std::isnan(previous)))
+                {
+                    changed[index] = generation;
+                }
+            }
+
+            void
+            log_error(const unsigned & index, const char * kind, const eos::Exception & e)
+            {
+                const auto & o = observables[index];
+                Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating " << kind << " observable '" << o->name() << "["
+                                                                              << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
+            }
+
+            // Evaluate a single observable and store its prediction
+            void
+            evaluate(const unsigned & index, const char * kind)
+            {
+                double value;
+                try
+                {
+                    value = observables[index]->evaluate();
+                }
+                catch (eos::Exception & e)
+                {
+                    log_error(index, kind, e);
+                    value = std::numeric_limits<double>::quiet_NaN();
+                }
+
+                store(index, value);
+            }
+
+            // Lower all expression observables to a common bytecode
+            void
+            compile()
+            {
+                program = exp::ExpressionProgram();
+                for (const auto & eo : expression_observables)
+                {
+                    const auto & expression = static_cast<const ExpressionObservable &>(*std::get<0>(eo)).expression();
+                    program.add(*expression, std::get<1>(eo));
+                }
+                program.schedule();
+
+                compiled = true;
+            }
+
+            // Evaluate one group of the expression bytecode, and store the predictions it provides
+            void
+            evaluate_expressions(const unsigned & g)
+            {
+                program.evaluate(g, predictions.data());
+
+                // only the expressions whose registers depend on a failed instruction are affected by its error
+                for (const auto & [id, index] : program.groups()[g].outputs)
+                {
+                    if (const auto & error = program.error(index))
+                    {
+                        try
+                        {
+                            std::rethrow_exception(error);
+                        }
+                        catch (eos::Exception & e)
+                        {
+                            log_error(id.value(), "expression", e);
+                        }
+                    }
+
+                    store(id.value(), program[index]);
+                }
+            }
+
+            // Update all dirty observables, either in parallel using the thread pool or serially in the calling thread
+            void
+            update(bool parallel)
+            {
+                ++generation;
+
+                // only re-evaluate observables whose parameters or kinematics changed since the last update
+                mark_dirty();
+
+                // collect the dirty observables of each kind
+                std::vector<unsigned> cacheable_indices, regular_indices, cached_indices;
+                for (const auto & co : cacheable_observables)
+                {
+                    if (dirty[std::get<1>(co.second).value()])
+                    {
+                        cacheable_indices.push_back(std::get<1>(co.second).value());
+                    }
+                }
+
+                for (const auto & ro : regular_observables)
+                {
+                    if (dirty[std::get<1>(ro).value()])
+                    {
+                        regular_indices.push_back(std::get<1>(ro).value());
+                    }
+                }
+
+                for (const auto & co : cached_observables)
+                {
+                    if (dirty[std::get<1>(co).value()])
+                    {
+                        cached_indices.push_back(std::get<1>(co).value());
+                    }
+                }
+
+                if (parallel)
+                {
+                    // evaluate all cacheable and all regular observables in parallel
+                    Ticket cacheable_ticket = ThreadPool::instance()->enqueue_range(cacheable_indices.size(),
+                                                                                    [&, this](const unsigned & i) { evaluate(cacheable_indices[i], "cacheable"); });
+                    Ticket regular_ticket   = ThreadPool::instance()->enqueue_range(regular_indices.size(),
+                                                                                  [&, this](const unsigned & i) { evaluate(regular_indices[i], "regular"); });
+
+                    // await completion of the cacheable observables
+                    cacheable_ticket.wait();
+
+                    // evaluate all cached observables in parallel
+                    Ticket cached_ticket = ThreadPool::instance()->enqueue_range(cached_indices.size(),
+                                                                                 [&, this](const unsigned & i) { evaluate(cached_indices[i], "cached"); });
+
+                    // await completion of the regular and the cached observables
+                    regular_ticket.wait();
+                    cached_ticket.wait();
+                }
+                else
+                {
+                    // the cacheable observables must be evaluated before the cached observables
+                    for (const auto & i : cacheable_indices)
+                    {
+                        evaluate(i, "cacheable");
+                    }
+
+                    for (const auto & i : regular_indices)
+                    {
+                        evaluate(i, "regular");
+                    }
+
+                    for (const auto & i : cached_indices)
+                    {
+                        evaluate(i, "cached");
+                    }
+                }
+
+                // evaluate the expression observables level by level
+                //
+                // An expression observable can rely on another expression observable,
+                // which is then evaluated at a lower level. The groups of one level
+                // do not share any register and can be evaluated in parallel; this only
+                // pays off for large numbers of instructions, since each instruction is cheap.
+                if (! compiled)
+                {
+                    compile();
+                }
+
+                const auto & groups = program.groups();
+                for (unsigned first = 0, last = 0; first < groups.size(); first = last)
+                {
+                    std::vector<unsigned> dirty_groups;
+                    std::size_t           instructions = 0;
+                    for (last = first; (last < groups.size()) && (groups[last].level == groups[first].level); ++last)
+                    {
+                        const auto & consumers = groups[last].consumers;
+                        if (std::any_of(consumers.cbegin(), consumers.cend(), [this](const ObservableCache::ObservableId & id) { return dirty[id.value()]; }))
+                        {
+                            dirty_groups.push_back(last);
+                            instructions += groups[last].instructions.size();
+                        }
+                    }
+
+                    if (parallel && (dirty_groups.size() > 1) && (instructions >= min_parallel_instructions))
+                    {
+                        ThreadPool::instance()->enqueue_range(dirty_groups.size(), [&, this](const unsigned & i) { evaluate_expressions(dirty_groups[i]); }).wait();
+                    }
+                    else
+                    {
+                        for (const auto & g : dirty_groups)
+                        {
+                            evaluate_expressions(g);
+                        }
+                    }
+                }
+
+                std::fill(dirty.begin(), dirty.end(), false);
+            }
+
             ObservableCache::ObservableId
             add(const ObservablePtr & observable, const ObservableCache & cache)
             {
@@ -116,16 +520,19 @@ namespace eos
                     throw InternalError("ObservableCache::add(): Mismatch of Parameters between different observables detected.");
                 }
 
-                // compare each observable for options, kinematics and name
-                unsigned index = 0;
-                for (auto i = observables.begin(), i_end = observables.end(); i != i_end; ++i, ++index)
+                // compare the observable for options, kinematics and name with all observables that share its hash key
+                const std::size_t key   = observable_key(*observable);
+                auto              range = observable_index.equal_range(key);
+                for (auto i = range.first, i_end = range.second; i != i_end; ++i)
                 {
-                    if (identical_observables(*i, observable))
+                    if (identical_observables(observables[i->second], observable))
                     {
-                        return ObservableCache::ObservableId(index);
+                        return ObservableCache::ObservableId(i->second);
                     }
                 }
 
+                unsigned index = observables.size();
+
                 CacheableObservable *  cacheable_observable  = dynamic_cast<CacheableObservable *>(observable.get());
                 ExpressionObservable * expression_observable = dynamic_cast<ExpressionObservable *>(observable.get());
 
@@ -143,6 +550,9 @@ namespace eos
                     observables.push_back(cached_expression_observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
                     expression_observables.push_back(std::make_tuple(cached_expression_observable, ObservableCache::ObservableId(index)));
+                    compiled = false;
+                    observable_index.insert(std::make_pair(observable_key(*cached_expression_observable), index));
+                    track(cached_expression_observable, index);
 
                     return ObservableCache::ObservableId(index);
                 }
@@ -150,8 +560,9 @@ namespace eos
                 {
                     std::type_index type_index(typeid(*cacheable_observable));
 
-                    // have we encountered this type of cacheable observable before?
-                    auto range = cacheable_observables.equal_range(type_index);
+                    // have we encountered this type of cacheable observable with the same hash key before?
+                    const std::size_t cacheable_key = cacheable_observable_key(type_index, *cacheable_observable);
+                    auto              range         = cacheable_observable_index.equal_range(cacheable_key);
                     for (auto c = range.first, c_end = range.second; c != c_end; ++c)
                     {
                         // have we encountered this cacheable observable with the same properties before?
@@ -185,7 +596,9 @@ namespace eos
                         // add the newly created cached observable
                         observables.push_back(cached_observable);
                         predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                        cached_observables.push_back(std::make_tuple(cached_observable, ObservableCache::ObservableId(index)));
+                        cached_observables.push_back(std::make_tuple(cached_observable, ObservableCache::ObservableId(index), std::get<1>(c->second)));
+                        observable_index.insert(std::make_pair(observable_key(*cached_observable), index));
+                        track(cached_observable, index);
 
                         return ObservableCache::ObservableId(index);
                     }
@@ -194,6 +607,9 @@ namespace eos
                     observables.push_back(observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
                     cacheable_observables.insert(std::make_pair(type_index, std::make_tuple(cacheable_observable, ObservableCache::ObservableId(index))));
+                    cacheable_observable_index.insert(std::make_pair(cacheable_key, std::make_tuple(cacheable_observable, ObservableCache::ObservableId(index))));
+                    observable_index.insert(std::make_pair(key, index));
+                    track(observable, index);
 
                     return ObservableCache::ObservableId(index);
                 }
@@ -203,6 +619,8 @@ namespace eos
                     observables.push_back(observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
                     regular_observables.push_back(std::make_tuple(observable, ObservableCache::ObservableId(index)));
+                    observable_index.insert(std::make_pair(key, index));
+                    track(observable, index);
 
                     return ObservableCache::ObservableId(index);
                 }
@@ -227,120 +645,8 @@ namespace eos
     void
     ObservableCache::update()
     {
-        // parallelize the evaluation of the observables
-        std::vector<Ticket> cacheable_tickets;
-        cacheable_tickets.reserve(_imp->cacheable_observables.size());
-
-        // evaluate all cacheable observables in parallel
-        for (auto co : _imp->cacheable_observables)
-        {
-            auto f = [=, this]()
-            {
-                auto & o  = std::get<0>(co.second);
-                auto & id = std::get<1>(co.second);
-                try
-                {
-                    _imp->predictions[id.value()] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating cacheable observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[id.value()] = std::numeric_limits<double>::quiet_NaN();
-                }
-            };
-            cacheable_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
-        }
-
-        std::vector<Ticket> regular_tickets;
-        regular_tickets.reserve(_imp->regular_observables.size());
-
-        // evaluate all regular observables in parallel
-        for (auto ro : _imp->regular_observables)
-        {
-            auto f = [=, this]()
-            {
-                auto & o  = std::get<0>(ro);
-                auto & id = std::get<1>(ro);
-                try
-                {
-                    _imp->predictions[id.value()] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating regular observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[id.value()] = std::numeric_limits<double>::quiet_NaN();
-                }
-            };
-            regular_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
-        }
-
-        // await completion of the cacheable observables
-        for (auto ticket : cacheable_tickets)
-        {
-            ticket.wait();
-        }
-
-        std::vector<Ticket> cached_tickets;
-        cached_tickets.reserve(_imp->cached_observables.size());
-
-        // evaluate all cached observables in parallel
-        for (auto co : _imp->cached_observables)
-        {
-            auto f = [=, this]()
-            {
-                auto & o  = std::get<0>(co);
-                auto & id = std::get<1>(co);
-                try
-                {
-                    _imp->predictions[id.value()] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating cached observable '" << o->name() << "["
-                                                                                  << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                    _imp->predictions[id.value()] = std::numeric_limits<double>::quiet_NaN();
-                }
-            };
-            cached_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
-        }
-
-        // await completion of the regular observables
-        for (auto ticket : regular_tickets)
-        {
-            ticket.wait();
-        }
-
-        // await completion of the cached observables
-        for (auto ticket : cached_tickets)
-        {
-            ticket.wait();
-        }
-
-        // evaluate all expression observables in a serial fashion
-        //
-        // This is necessary, since an expression observable can rely on
-        // another expression observable, which would be located earlier in
-        // the sequence.
-        // Serial evaluation ensures that no race conditions arise.
-        // There is not reason to optimize this, since expression observables
-        // are evaluated very quickly.
-        for (auto eo : _imp->expression_observables)
-        {
-            auto & o  = std::get<0>(eo);
-            auto & id = std::get<1>(eo);
-            try
-            {
-                _imp->predictions[id.value()] = o->evaluate();
-            }
-            catch (eos::Exception & e)
-            {
-                Log::instance()->message("ObservableCache::update", ll_error) << "Exception encountered when evaluating expression observable '" << o->name() << "["
-                                                                              << o->kinematics().as_string() << "];" << o->options().as_string() << "': " << e.what();
-                _imp->predictions[id.value()] = std::numeric_limits<double>::quiet_NaN();
-            }
-        }
+        // within a job of the thread pool, waiting on further jobs could stall all workers
+        _imp->update(! ThreadPool::instance()->is_worker_thread());
     }
 
     Parameters
@@ -367,6 +673,30 @@ namespace eos
         return _imp->observables.size();
     }
 
+    unsigned long
+    ObservableCache::generation() const
+    {
+        return _imp->generation;
+    }
+
+    unsigned long
+    ObservableCache::generation(const ObservableCache::ObservableId & id) const
+    {
+        return _imp->changed[id.value()];
+    }
+
+    bool
+    ObservableCache::depends_on(const Parameter::Id & id) const
+    {
+        if (_imp->dependency_indices.end() != _imp->dependency_indices.find(id))
+        {
+            return true;
+        }
+
+        // observables that do not report their used parameters might use any parameter
+        return std::any_of(_imp->untracked.cbegin(), _imp->untracked.cend(), [](const char & u) { return u; });
+    }
+
     ObservableCache::Iterator
     ObservableCache::begin() const
     {
@@ -395,4 +725,113 @@ namespace eos
 
         return result;
     }
+
+    void
+    ObservableCache::predict(const std::vector<Parameter> & parameters, std::span<const double> samples, const std::vector<ObservableCache::ObservableId> & ids,
+                             std::span<double> predictions) const
+    {
+        if (parameters.empty())
+        {
+            throw InternalError("ObservableCache::predict: at least one varied parameter is required");
+        }
+
+        if (0 != samples.size() % parameters.size())
+        {
+            throw InternalError("ObservableCache::predict: number of values " + stringify(samples.size()) + " is not a multiple of the number of parameters "
+                                + stringify(parameters.size()));
+        }
+
+        const std::size_t n = samples.size() / parameters.size();
+        if (predictions.size() != n * ids.size())
+        {
+            throw InternalError("ObservableCache::predict: output buffer holds " + stringify(predictions.size()) + " values, but " + stringify(n * ids.size())
+                                + " are required");
+        }
+
+        for (const auto & id : ids)
+        {
+            if (id.value() >= _imp->observables.size())
+            {
+                throw InternalError("ObservableCache::predict: unknown observable id " + stringify(id.value()));
+            }
+        }
+
+        if (0 == n)
+        {
+            return;
+        }
+
+        // create one independent clone of this cache per worker; this must happen in the calling
+        // thread, since cloning updates the clone using the thread pool
+        const std::size_t                   workers = std::min<std::size_t>(ThreadPool::instance()->number_of_threads(), n);
+        std::vector<ObservableCache>        caches;
+        std::vector<std::vector<Parameter>> cache_parameters(workers);
+        caches.reserve(workers);
+        for (std::size_t w = 0; w < workers; ++w)
+        {
+            caches.push_back(this->clone(_imp->parameters.clone()));
+
+            const auto p = caches.back().parameters();
+            for (const auto & parameter : parameters)
+            {
+                cache_parameters[w].push_back(p[parameter.id()]);
+            }
+        }
+
+        const std::size_t               chunk_size = (n + workers - 1) / workers;
+        std::vector<std::exception_ptr> errors(workers);
+
+        Ticket ticket = ThreadPool::instance()->enqueue_range(workers,
+                                                              [&](const unsigned & w)
+                                                              {
+                                                                  auto &       cache = caches[w];
+                                                                  auto &       p     = cache_parameters[w];
+                                                                  const auto   begin = w * chunk_size;
+                                                                  const auto   end   = std::min(begin + chunk_size, n);
+
+                                                                  try
+                                                                  {
+                                                                      for (std::size_t i = begin; i < end; ++i)
+                                                                      {
+                                                                          const double * sample = samples.data() + i * p.size();
+                                                                          double *       result = predictions.data() + i * ids.size();
+
+                                                                          for (std::size_t j = 0; j < p.size(); ++j)
+                                                                          {
+                                                                              p[j].set(sample[j]);
+                                                                          }
+
+                                                                          try
+                                                                          {
+                                                                              // workers of the thread pool must not wait for other jobs
+                                                                              cache._imp->update(false);
+                                                                              for (std::size_t j = 0; j < ids.size(); ++j)
+                                                                              {
+                                                                                  result[j] = cache._imp->predictions[ids[j].value()];
+                                                                              }
+                                                                          }
+                                                                          catch (eos::Exception & e)
+                                                                          {
+                                                                              Log::instance()->message("ObservableCache::predict", ll_error)
+                                                                                  << "Skipping prediction for sample " << i << " due to runtime error: " << e.what();
+                                                                              std::fill(result, result + ids.size(), std::numeric_limits<double>::quiet_NaN());
+                                                                          }
+                                                                      }
+                                                                  }
+                                                                  catch (...)
+                                                                  {
+                                                                      errors[w] = std::current_exception();
+                                                                  }
+                                                              });
+
+        ticket.wait();
+
+        for (const auto & error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
 } // namespace eos
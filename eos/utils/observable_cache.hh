@@ -27,6 +27,9 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/strong-typedef.hh>
 
+#include <span>
+#include <vector>
+
 namespace eos
 {
     class ObservableCache : public PrivateImplementationPattern<ObservableCache>
@@ -62,7 +65,12 @@ namespace eos
              */
             ObservableId add(const ObservablePtr & observable);
 
-            /// Update the predictions for all observables.
+            /*!
+             * Update the predictions for all observables.
+             *
+             * Only those observables are re-evaluated whose used parameters or kinematic
+             * variables have changed since the last update.
+             */
             void update();
 
             /// Retrieve the cache's common Parameters object.
@@ -82,9 +90,29 @@ namespace eos
              */
             double operator[] (const ObservableCache::ObservableId & id) const;
 
+            /// Retrieve the number of updates performed so far.
+            unsigned long generation() const;
+
+            /*!
+             * Retrieve the number of the update in which the prediction for a given observable last changed.
+             *
+             * A prediction that is re-evaluated to the same value does not count as changed. Comparing this
+             * number with generation() at an earlier time tells whether the prediction changed in between.
+             *
+             * @param id The unique ObservableCache::ObservableId of the observable.
+             */
+            unsigned long generation(const ObservableCache::ObservableId & id) const;
+
             /// Retrieve the number of independent predictions from the cache.
             unsigned size() const;
 
+            /*!
+             * Determine whether any prediction might depend on a given parameter.
+             *
+             * @param id The id of the parameter.
+             */
+            bool depends_on(const Parameter::Id & id) const;
+
             struct IteratorTag;
             using Iterator = WrappedForwardIterator<IteratorTag, ObservablePtr>;
             Iterator begin() const;
@@ -93,6 +121,21 @@ namespace eos
 
             /// Clone this cache whilst keeping the observables in the given order, i.e. all ids remain valid.
             ObservableCache clone(const Parameters & parameters) const;
+
+            /*!
+             * Predict a subset of the observables for a batch of parameter samples.
+             *
+             * The samples are distributed among the threads of the thread pool, each of which updates
+             * its own clone of this cache. This cache and its parameters remain unchanged.
+             *
+             * @param parameters  The varied parameters.
+             * @param samples     The values of the varied parameters, stored sample by sample with parameters.size() values each.
+             * @param ids         The ids of the observables whose predictions shall be retrieved.
+             * @param predictions The output buffer, stored sample by sample with ids.size() values each.
+             *                    The predictions for samples that raise an error are set to NaN.
+             */
+            void predict(const std::vector<Parameter> & parameters, std::span<const double> samples, const std::vector<ObservableCache::ObservableId> & ids,
+                         std::span<double> predictions) const;
     };
 
     extern template class WrappedForwardIterator<ObservableCache::IteratorTag, ObservablePtr>;
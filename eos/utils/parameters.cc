@@ -268,13 +268,29 @@ namespace eos
 
             Parameter::Id id;
 
+            // incremented whenever the numeric value changes
+            unsigned long generation;
+
             Data(const Parameter::Template & t, const Parameter::Id & i) :
                 Parameter::Template(t),
                 value(t.central),
                 generator_value(0.0),
-                id(i)
+                id(i),
+                generation(0)
             {
             }
+
+            inline void
+            set(const double & v)
+            {
+                if (v == value)
+                {
+                    return;
+                }
+
+                value = v;
+                ++generation;
+            }
     };
 
     struct Parameters::Data
@@ -810,7 +826,7 @@ namespace eos
                             Log::instance()->message("[parameters.override]", ll_informational)
                                     << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
-                            parameters_data->data[i->second].value = central;
+                            parameters_data->data[i->second].set(central);
                             if (has_min)
                             {
                                 parameters_data->data[i->second].min = min;
@@ -956,7 +972,7 @@ namespace eos
             throw UnknownParameterError(name);
         }
 
-        _imp->parameters_data->data[i->second].value = value;
+        _imp->parameters_data->data[i->second].set(value);
     }
 
     bool
@@ -1064,7 +1080,7 @@ namespace eos
     const Parameter &
     Parameter::operator= (const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->data[_index].set(value);
 
         return *this;
     }
@@ -1072,7 +1088,7 @@ namespace eos
     void
     Parameter::set(const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->data[_index].set(value);
     }
 
     void
@@ -1135,6 +1151,12 @@ namespace eos
         return _parameters_data->data[_index].id;
     }
 
+    unsigned long
+    Parameter::generation() const
+    {
+        return _parameters_data->data[_index].generation;
+    }
+
     /* ParameterUser */
 
     template <> struct WrappedForwardIteratorTraits<ParameterUser::ConstIteratorTag>
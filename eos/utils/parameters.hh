@@ -336,6 +336,14 @@ namespace eos
             /// Retrieve the Parameter's id.
             Id id() const;
 
+            /*!
+             * Retrieve the Parameter's generation.
+             *
+             * The generation is incremented whenever the Parameter's numeric value changes,
+             * and can be used to detect whether a parameter changed since it was last inspected.
+             */
+            unsigned long generation() const;
+
             /// Retrieve the Parameter's name as a LaTeX representation
             const std::string & latex() const;
 
@@ -55,6 +55,35 @@ class ParametersTest : public TestCase
                 TEST_CHECK_EQUAL(m_c(), m_c.central());
             }
 
+            // Generations
+            {
+                Parameters original = Parameters::Defaults();
+                Parameter  m_c      = original["mass::c"];
+                Parameter  m_b      = original["mass::b(MSbar)"];
+
+                const unsigned long generation = m_c.generation();
+
+                m_c = m_c() + 1.0;
+                TEST_CHECK_EQUAL(m_c.generation(), generation + 1);
+
+                // setting the same value does not change the generation
+                m_c.set(m_c());
+                TEST_CHECK_EQUAL(m_c.generation(), generation + 1);
+
+                original.set("mass::c", 0.0);
+                TEST_CHECK_EQUAL(m_c.generation(), generation + 2);
+                TEST_CHECK_EQUAL(m_b.generation(), 0ul);
+
+                // clones inherit the generation, but evolve independently
+                Parameters clone     = original.clone();
+                Parameter  m_c_clone = clone["mass::c"];
+                TEST_CHECK_EQUAL(m_c_clone.generation(), generation + 2);
+
+                m_c_clone = 1.0;
+                TEST_CHECK_EQUAL(m_c_clone.generation(), generation + 3);
+                TEST_CHECK_EQUAL(m_c.generation(), generation + 2);
+            }
+
             // Declaring a new parameter
             {
                 Parameters::declare("mass::boeing747", R"(\text{Boeing 747})", Unit::Undefined(), 100000.0, 90000.0, 110000.0);
@@ -21,10 +21,10 @@
 #ifndef EOS_GUARD_EOS_UTILS_RGE_IMPL_HH
 #define EOS_GUARD_EOS_UTILS_RGE_IMPL_HH 1
 
+#include <eos/maths/matrix.hh>
 #include <eos/utils/rge.hh>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
+#include <cmath>
 
 namespace eos
 {
@@ -45,35 +45,44 @@ namespace eos
     };
 
     template <unsigned nf_, unsigned dim_>
-    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::MultiplicativeRenormalizationGroupEvolution(const std::array<double, dim_> &                   gamma_0_ev,
-                                                                                                                      const std::array<std::array<double, dim_>, dim_> & V) :
+    MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>::MultiplicativeRenormalizationGroupEvolutionBase(const std::array<double, dim_> &                   gamma_0_ev,
+                                                                                                                const std::array<std::array<double, dim_>, dim_> & V) :
         _gamma_0_ev(gamma_0_ev),
-        _V(make_gsl_matrix(dim_, dim_)),
-        _Vinv(make_gsl_matrix(dim_, dim_)),
-        _U_0(make_gsl_matrix(dim_, dim_)),
-        _c_0_0(make_gsl_vector(dim_)),
-        _tmp_matrix(make_gsl_matrix(dim_, dim_)),
-        _tmp_vector(make_gsl_vector(dim_))
+        _V(V),
+        _Vinv(inverse(V))
+    {
+    }
+
+    template <unsigned nf_, unsigned dim_>
+    std::array<double, dim_>
+    MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>::_eigenvalues_U_0(const double & alpha_s_mu, const double & alpha_s_0) const
     {
+        const double eta    = alpha_s_0 / alpha_s_mu;
+        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
+
+        // cf. [BBL:1995A], p. 34, eq. (III.94)
+        std::array<double, dim_> result;
         for (unsigned i = 0; i < dim_; ++i)
         {
-            for (unsigned j = 0; j < dim_; ++j)
-            {
-                gsl_matrix_set(_V.get(), i, j, V[i][j]);
-            }
+            result[i] = std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0));
         }
 
-        // tmp_matrix <- V
-        gsl_matrix_memcpy(_tmp_matrix.get(), _V.get());
+        return result;
+    }
 
-        gsl_permutation * p = gsl_permutation_alloc(dim_);
-        int               signum;
-        // tmp_matrix stores L, U from LU decomposition: P * V = L * U
-        gsl_linalg_LU_decomp(_tmp_matrix.get(), p, &signum);
-        // Vinv <- V^-1
-        gsl_linalg_LU_invert(_tmp_matrix.get(), p, _Vinv.get());
+    template <unsigned nf_, unsigned dim_>
+    std::array<double, dim_>
+    MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>::_U_0(const std::array<double, dim_> & u, const std::array<double, dim_> & c) const
+    {
+        // U_0 is never formed explicitly; two matrix-vector products suffice
+        return _V * mult(u, _Vinv * c);
+    }
 
-        gsl_permutation_free(p);
+    template <unsigned nf_, unsigned dim_>
+    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::MultiplicativeRenormalizationGroupEvolution(const std::array<double, dim_> &                   gamma_0_ev,
+                                                                                                                      const std::array<std::array<double, dim_>, dim_> & V) :
+        MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>(gamma_0_ev, V)
+    {
     }
 
     template <unsigned nf_, unsigned dim_>
@@ -87,104 +96,39 @@ namespace eos
         // since
         //   gamma_0 = V^-1,T . diag[ gamma_0_ev ] . V^T,
 
-        const double eta    = alpha_s_0 / alpha_s_mu;
-        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
-
-        gsl_matrix_set_identity(_U_0.get());
-
-        // U_0 <- diag[ eta^(gamma_0_ev / (2 * beta_0)) ]
-        // cf. [BBL:1995A], p. 34, eq. (III.94)
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-        }
-        // tmp_matrix <- V . U_0
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
-        // U_0 <- tmp_matrix . V
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
-
-        // tmp_vector <- U_0 * c_0_0
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
-
-        std::array<double, dim_> result;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
-
-        return result;
+        return this->_U_0(this->_eigenvalues_U_0(alpha_s_mu, alpha_s_0), c_0_0);
     }
 
     template <unsigned nf_, unsigned dim_>
     MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::MultiplicativeRenormalizationGroupEvolution(const std::array<double, dim_> & gamma_0_ev,
                                                                                                                        const std::array<std::array<double, dim_>, dim_> & V,
                                                                                                                        const std::array<std::array<double, dim_>, dim_> & gamma_1) :
-        _gamma_0_ev(gamma_0_ev),
-        _V(make_gsl_matrix(dim_, dim_)),
-        _Vinv(make_gsl_matrix(dim_, dim_)),
-        _G(make_gsl_matrix(dim_, dim_)),
-        _U_0(make_gsl_matrix(dim_, dim_)),
-        _J(make_gsl_matrix(dim_, dim_)),
-        _c_0_0(make_gsl_vector(dim_)),
-        _c_0_1(make_gsl_vector(dim_)),
-        _tmp_matrix(make_gsl_matrix(dim_, dim_)),
-        _tmp_matrix_2(make_gsl_matrix(dim_, dim_)),
-        _tmp_vector(make_gsl_vector(dim_)),
-        _tmp_vector_2(make_gsl_vector(dim_)),
-        _tmp_vector_3(make_gsl_vector(dim_))
+        MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>(gamma_0_ev, V)
     {
-        // V <- V
-        // G <- gamma_1
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            for (unsigned j = 0; j < dim_; ++j)
-            {
-                gsl_matrix_set(_V.get(), i, j, V[i][j]);
-                gsl_matrix_set(_G.get(), i, j, gamma_1[i][j]);
-            }
-        }
-
-        // tmp_matrix <- V
-        gsl_matrix_memcpy(_tmp_matrix.get(), _V.get());
-
-        gsl_permutation * p = gsl_permutation_alloc(dim_);
-        int               signum;
-        // tmp_matrix stores L, U from LU decomposition: P . V = L . U
-        gsl_linalg_LU_decomp(_tmp_matrix.get(), p, &signum);
-        // Vinv <- V^-1
-        gsl_linalg_LU_invert(_tmp_matrix.get(), p, _Vinv.get());
-
-        gsl_permutation_free(p);
-
         // G = V^-1 . gamma_1^T . V, cf. [BBL:1995A], p. 34, eq. (III.96)
-        // tmp_matrix <- V^-1 . gamma_1^T
-        gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, _Vinv.get(), _G.get(), 0.0, _tmp_matrix.get());
-        // G <- tmp_matrix . V
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _V.get(), 0.0, _G.get());
+        const std::array<std::array<double, dim_>, dim_> G = this->_Vinv * transpose(gamma_1) * this->_V;
 
-        // J <- H = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2)
-        //        - G_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
+        // H = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2)
+        //   - G_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
         // cf. [BBL:1995A], p. 34, eq. (III.97)
         const double beta_0 = QCDBetaFunction<nf_>::beta_0;
         const double beta_1 = QCDBetaFunction<nf_>::beta_1;
 
+        std::array<std::array<double, dim_>, dim_> H;
         for (unsigned i = 0; i < dim_; ++i)
         {
             for (unsigned j = 0; j < dim_; ++j)
             {
-                double value = -1.0 * gsl_matrix_get(_G.get(), i, j) / (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
+                H[i][j] = -1.0 * G[i][j] / (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
                 if (i == j)
                 {
-                    value += gamma_0_ev[i] * beta_1 / (2.0 * beta_0 * beta_0);
+                    H[i][j] += gamma_0_ev[i] * beta_1 / (2.0 * beta_0 * beta_0);
                 }
-                gsl_matrix_set(_J.get(), i, j, value);
             }
         }
-        // tmp <- H . V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _J.get(), _Vinv.get(), 0.0, _tmp_matrix.get());
-        // J <- V . tmp
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _tmp_matrix.get(), 0.0, _J.get());
+
+        // J = V . H . V^-1
+        _J = this->_V * H * this->_Vinv;
     }
 
     template <unsigned nf_, unsigned dim_>
@@ -204,53 +148,16 @@ namespace eos
         //   H = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2) - G_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j),
         //   G = V^-1 . gamma_1^T . V
 
-        const double eta    = alpha_s_0 / alpha_s_mu;
-        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
+        const double a_s_mu = alpha_s_mu / (4.0 * M_PI);
+        const double a_s_0  = alpha_s_0 / (4.0 * M_PI);
 
-        gsl_matrix_set_identity(_U_0.get());
+        // c_0_0 + a_s_0 * (c_0_1 - J . c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
+        const std::array<double, dim_> c_0 = c_0_0 + a_s_0 * (c_0_1 - _J * c_0_0);
 
-        // U_0 <- diag[ eta^(gamma_0_ev / (2 * beta_0)) ]
-        // cf. [BBL:1995A], p. 34, eq. (III.94)
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
-        }
-        // tmp_matrix <- V . U_0
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
-        // U_0 <- tmp_matrix * V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
-
-        // tmp_vector := c_0_0 + alpha_s_0 / (4 pi) * (c_0_1 - J * c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- -1.0 * J * c_0_0 + 1.0 * tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        // tmp_vector <- c_0_0 + alpha_s(mu_0) / (4 pi) * tmp_vector
-        gsl_vector_axpby(1.0, _c_0_0.get(), alpha_s_0 / (4.0 * M_PI), _tmp_vector.get());
-
-        // tmp_matrix <- unit_matrix
-        gsl_matrix_set_zero(_tmp_matrix.get());
-        gsl_matrix_set_identity(_tmp_matrix.get());
-        // tmp_matrix2 <- alpha_s(mu) / (4 pi) * J
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu / (4.0 * M_PI));
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
-        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
+        // (1 + a_s_mu J) . U_0 . c_0
+        const std::array<double, dim_> u = this->_U_0(this->_eigenvalues_U_0(alpha_s_mu, alpha_s_0), c_0);
 
-        std::array<double, dim_> result;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
-
-        return result;
+        return u + a_s_mu * (_J * u);
     }
 
     template <unsigned nf_, unsigned dim_>
@@ -270,71 +177,16 @@ namespace eos
         //   H = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2) - G_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j),
         //   G = V^-1 . gamma_1^T . V
 
-        const double eta    = alpha_s_0 / alpha_s_mu;
-        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
+        const double a_s_mu = alpha_s_mu / (4.0 * M_PI);
+        const double a_s_0  = alpha_s_0 / (4.0 * M_PI);
 
-        gsl_matrix_set_identity(_U_0.get());
+        const std::array<double, dim_> u = this->_eigenvalues_U_0(alpha_s_mu, alpha_s_0);
 
-        // U_0 <- diag[ eta^(gamma_0_ev / (2 * beta_0)) ]
-        // cf. [BBL:1995A], p. 34, eq. (III.94)
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
-        }
-        // tmp_matrix <- V . U_0
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
-        // U_0 <- tmp_matrix * V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
-
-        // tmp_vector <- U_0 . c_0_0
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
-
-        std::array<double, dim_> result_LL;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result_LL[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
+        // U_0 . c_0_0
+        const std::array<double, dim_> result_LL = this->_U_0(u, c_0_0);
 
-        // tmp_vector := c_0_0 + alpha_s_0 / (4 pi) * (c_0_1 - J * c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- (-1.0 * J * c_0_0 + 1.0 * tmp_vector) * alpha_s(mu_0) / (4 pi)
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        gsl_vector_scale(_tmp_vector.get(), alpha_s_0 / (4.0 * M_PI));
-
-        // tmp_matrix <- unit_matrix
-        gsl_matrix_set_zero(_tmp_matrix.get());
-        gsl_matrix_set_identity(_tmp_matrix.get());
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
-        // tmp_vector_3 <- tmp_vector
-        gsl_vector_memcpy(_tmp_vector_3.get(), _tmp_vector.get());
-
-
-        // tmp_vector <- c_0_0
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_0.get());
-        // tmp_matrix2 <- alpha_s(mu) / (4 pi) * J
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu / (4.0 * M_PI));
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix_2 . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix_2.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
-        // tmp_vector <- tmp_vector + tmp_vector_3
-        gsl_vector_add(_tmp_vector.get(), _tmp_vector_3.get());
-        gsl_vector_scale(_tmp_vector.get(), (4.0 * M_PI) / alpha_s_mu);
-
-        std::array<double, dim_> result_NLL;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result_NLL[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
+        // (a_s_mu J . U_0 . c_0_0 + a_s_0 U_0 . (c_0_1 - J . c_0_0)) / a_s_mu, cf. [BBL:1995A], p. 34, eq. (III.99)
+        const std::array<double, dim_> result_NLL = (1.0 / a_s_mu) * (a_s_mu * (_J * result_LL) + this->_U_0(u, a_s_0 * (c_0_1 - _J * c_0_0)));
 
         return std::tuple(result_LL, result_NLL);
     }
@@ -343,113 +195,62 @@ namespace eos
     MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, nf_, dim_>::MultiplicativeRenormalizationGroupEvolution(
             const std::array<double, dim_> & gamma_0_ev, const std::array<std::array<double, dim_>, dim_> & V, const std::array<std::array<double, dim_>, dim_> & gamma_1,
             const std::array<std::array<double, dim_>, dim_> & gamma_2) :
-        _gamma_0_ev(gamma_0_ev),
-        _V(make_gsl_matrix(dim_, dim_)),
-        _Vinv(make_gsl_matrix(dim_, dim_)),
-        _G1(make_gsl_matrix(dim_, dim_)),
-        _G2(make_gsl_matrix(dim_, dim_)),
-        _U_0(make_gsl_matrix(dim_, dim_)),
-        _J1(make_gsl_matrix(dim_, dim_)),
-        _J2(make_gsl_matrix(dim_, dim_)),
-        _c_0_0(make_gsl_vector(dim_)),
-        _c_0_1(make_gsl_vector(dim_)),
-        _c_0_2(make_gsl_vector(dim_)),
-        _tmp_matrix(make_gsl_matrix(dim_, dim_)),
-        _tmp_matrix_2(make_gsl_matrix(dim_, dim_)),
-        _tmp_vector(make_gsl_vector(dim_)),
-        _tmp_vector_2(make_gsl_vector(dim_)),
-        _tmp_vector_3(make_gsl_vector(dim_))
+        MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>(gamma_0_ev, V)
     {
-        // V <- V
-        // G1 <- gamma_1
-        // G2 <- gamma_2
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            for (unsigned j = 0; j < dim_; ++j)
-            {
-                gsl_matrix_set(_V.get(), i, j, V[i][j]);
-                gsl_matrix_set(_G1.get(), i, j, gamma_1[i][j]);
-                gsl_matrix_set(_G2.get(), i, j, gamma_2[i][j]);
-            }
-        }
-
-        // tmp_matrix <- V
-        gsl_matrix_memcpy(_tmp_matrix.get(), _V.get());
-
-        gsl_permutation * p = gsl_permutation_alloc(dim_);
-        int               signum;
-        // tmp_matrix stores L, U from LU decomposition: P . V = L . U
-        gsl_linalg_LU_decomp(_tmp_matrix.get(), p, &signum);
-        // Vinv <- V^-1
-        gsl_linalg_LU_invert(_tmp_matrix.get(), p, _Vinv.get());
-
-        gsl_permutation_free(p);
-
         // G1 = V^-1 . gamma_1^T . V, cf. [BBL:1995A], p. 34, eq. (III.96) and [BFS:2001A], p. 31, eq. (94)
-        // tmp_matrix <- V^-1 . gamma_1^T
-        gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, _Vinv.get(), _G1.get(), 0.0, _tmp_matrix.get());
-        // G1 <- tmp_matrix . V
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _V.get(), 0.0, _G1.get());
+        const std::array<std::array<double, dim_>, dim_> G1 = this->_Vinv * transpose(gamma_1) * this->_V;
 
         // G2 = V^-1 . gamma_2^T . V, cf. [BFS:2001A], p. 31, eq. (94)
-        // tmp_matrix <- V^-1 . gamma_2^T
-        gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, _Vinv.get(), _G2.get(), 0.0, _tmp_matrix.get());
-        // G2 <- tmp_matrix . V
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _V.get(), 0.0, _G2.get());
+        const std::array<std::array<double, dim_>, dim_> G2 = this->_Vinv * transpose(gamma_2) * this->_V;
 
-        // J1 <- H1 = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2)
-        //          - G1_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
+        // H1 = delta_ij gamma_0_ev_i beta_1 / (2 beta_0^2)
+        //    - G1_ij / (2 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
         // cf. [BBL:1995A], p. 34, eq. (III.97)
         const double beta_0 = QCDBetaFunction<nf_>::beta_0;
         const double beta_1 = QCDBetaFunction<nf_>::beta_1;
         const double beta_2 = QCDBetaFunction<nf_>::beta_2;
 
+        std::array<std::array<double, dim_>, dim_> H1;
         for (unsigned i = 0; i < dim_; ++i)
         {
             for (unsigned j = 0; j < dim_; ++j)
             {
-                double value = -1.0 * gsl_matrix_get(_G1.get(), i, j) / (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
+                H1[i][j] = -1.0 * G1[i][j] / (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
                 if (i == j)
                 {
-                    value += gamma_0_ev[i] * beta_1 / (2.0 * beta_0 * beta_0);
+                    H1[i][j] += gamma_0_ev[i] * beta_1 / (2.0 * beta_0 * beta_0);
                 }
-                gsl_matrix_set(_J1.get(), i, j, value);
             }
         }
 
-        // J2 <- H2 = delta_ij gamma_0_ev_i beta_2 / (4 beta_0^2)
-        //          + sum_k ((2 beta_0 + gamma_0_ev_i - gamma_0_ev_k)/(4 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
-        //                   * ( H1[i,k]H1[k,j] - beta_1 / beta_0 H1[i,j] delta_jk ) )
-        //          - G2_ij / (4 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
+        // H2 = delta_ij gamma_0_ev_i beta_2 / (4 beta_0^2)
+        //    + sum_k ((2 beta_0 + gamma_0_ev_i - gamma_0_ev_k)/(4 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
+        //             * ( H1[i,k]H1[k,j] - beta_1 / beta_0 H1[i,j] delta_jk ) )
+        //    - G2_ij / (4 beta_0 + gamma_0_ev_i - gamma_0_ev_j)
         // cf. [BFS:2001A], p. 32, eq. (93)
-
+        std::array<std::array<double, dim_>, dim_> H2;
         for (unsigned i = 0; i < dim_; ++i)
         {
             for (unsigned j = 0; j < dim_; ++j)
             {
-                double value = -1.0 * gsl_matrix_get(_G2.get(), i, j) / (4.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
+                H2[i][j] = -1.0 * G2[i][j] / (4.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j]);
                 if (i == j)
                 {
-                    value += gamma_0_ev[i] * beta_2 / (4.0 * beta_0 * beta_0);
+                    H2[i][j] += gamma_0_ev[i] * beta_2 / (4.0 * beta_0 * beta_0);
                 }
                 for (unsigned k = 0; k < dim_; ++k)
                 {
-                    value += (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[k]) / (4.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j])
-                             * (gsl_matrix_get(_J1.get(), i, k) * gsl_matrix_get(_J1.get(), k, j) - beta_1 / beta_0 * gsl_matrix_get(_J1.get(), i, j) * (j == k ? 1.0 : 0.0));
+                    H2[i][j] += (2.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[k]) / (4.0 * beta_0 + gamma_0_ev[i] - gamma_0_ev[j])
+                                * (H1[i][k] * H1[k][j] - beta_1 / beta_0 * H1[i][j] * (j == k ? 1.0 : 0.0));
                 }
-                gsl_matrix_set(_J2.get(), i, j, value);
             }
         }
 
-        // tmp <- J1 . V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _J1.get(), _Vinv.get(), 0.0, _tmp_matrix.get());
-        // J1 <- V . tmp
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _tmp_matrix.get(), 0.0, _J1.get());
+        // J1 = V . H1 . V^-1, J2 = V . H2 . V^-1
+        _J1 = this->_V * H1 * this->_Vinv;
+        _J2 = this->_V * H2 * this->_Vinv;
 
-        // tmp <- J2 . V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _J2.get(), _Vinv.get(), 0.0, _tmp_matrix.get());
-        // J2 <- V . tmp
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _tmp_matrix.get(), 0.0, _J2.get());
+        _K = _J1 * _J1 - _J2;
     }
 
     template <unsigned nf_, unsigned dim_>
@@ -481,79 +282,17 @@ namespace eos
         //   G1 = V^-1 . gamma_1^T . V
         //   G2 = V^-1 . gamma_2^T . V
 
-        const double eta    = alpha_s_0 / alpha_s_mu;
-        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
+        const double a_s_mu = alpha_s_mu / (4.0 * M_PI);
+        const double a_s_0  = alpha_s_0 / (4.0 * M_PI);
 
-        gsl_matrix_set_identity(_U_0.get());
+        // c_0_0 + a_s_0 * (c_0_1 - J1 . c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
+        //       + a_s_0^2 * (c_0_2 + (J1^2 - J2) . c_0_0 - J1 . c_0_1)
+        const std::array<double, dim_> c_0 = c_0_0 + a_s_0 * (c_0_1 - _J1 * c_0_0) + (a_s_0 * a_s_0) * (c_0_2 + _K * c_0_0 - _J1 * c_0_1);
 
-        // U_0 <- diag[ eta^(gamma_0_ev / (2 * beta_0)) ]
-        // cf. [BBL:1995A], p. 34, eq. (III.94)
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
-            gsl_vector_set(_c_0_2.get(), i, c_0_2[i]);
-        }
-        // tmp_matrix <- V . U_0
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
-        // U_0 <- tmp_matrix * V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
-
-        // tmp_vector := c_0_0 + alpha_s_0 / (4 pi) * (c_0_1 - J1 * c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
-        //             + alpha_s_0^2 / (4 pi)^2 * ( - J2 * c_0_0 + J1^2 * c_0_0 - J1 * c_0_1 + c_0_2 )
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- -1.0 * J1 * c_0_0 + 1.0 * tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J1.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        // tmp_vector <- c_0_0 + alpha_s(mu_0) / (4 pi) * tmp_vector
-        gsl_vector_axpby(1.0, _c_0_0.get(), alpha_s_0 / (4.0 * M_PI), _tmp_vector.get());
-
-        // tmp_matrix_1 <- J1 . J1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _J1.get(), _J1.get(), 0.0, _tmp_matrix.get());
-        // tmp_matrix_2 <- -J2
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J2.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), -1.0);
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
-        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
-
-        // tmp_vector_2 <- c_0_2
-        gsl_vector_memcpy(_tmp_vector_2.get(), _c_0_2.get());
-        // tmp_vector_2 <- 1.0 * (J1^2-J2) * c_0_0 + 1.0 * tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _c_0_0.get(), 1.0, _tmp_vector_2.get());
-        // tmp_vector_2 <- -1.0 * J1 * c_0_1 + 1.0 * tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J1.get(), _c_0_1.get(), 1.0, _tmp_vector_2.get());
-        // tmp_vector_2 <- tmp_vector + alpha_s(mu_0)^2 / (4 pi)^2 * tmp_vector_2
-        gsl_vector_axpby(1.0, _tmp_vector.get(), alpha_s_0 * alpha_s_0 / (4.0 * M_PI * 4.0 * M_PI), _tmp_vector_2.get());
-
-        // tmp_matrix <- unit_matrix
-        gsl_matrix_set_zero(_tmp_matrix.get());
-        gsl_matrix_set_identity(_tmp_matrix.get());
-        // tmp_matrix2 <- alpha_s(mu) / (4 pi) * J1
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J1.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu / (4.0 * M_PI));
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
-        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
-        // tmp_matrix2 <- alpha_s(mu)^2 / (4 pi)^2 * J2
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J2.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu * alpha_s_mu / (4.0 * M_PI * 4.0 * M_PI));
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
-        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
-
-        // tmp_vector <- tmp_vector_2
-        gsl_vector_memcpy(_tmp_vector.get(), _tmp_vector_2.get());
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
+        // (1 + a_s_mu J1 + a_s_mu^2 J2) . U_0 . c_0
+        const std::array<double, dim_> u = this->_U_0(this->_eigenvalues_U_0(alpha_s_mu, alpha_s_0), c_0);
 
-        std::array<double, dim_> result;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
-
-        return result;
+        return u + a_s_mu * (_J1 * u) + (a_s_mu * a_s_mu) * (_J2 * u);
     }
 
     template <unsigned nf_, unsigned dim_>
@@ -586,131 +325,25 @@ namespace eos
         //   G1 = V^-1 . gamma_1^T . V
         //   G2 = V^-1 . gamma_2^T . V
 
-        const double eta    = alpha_s_0 / alpha_s_mu;
-        const double beta_0 = QCDBetaFunction<nf_>::beta_0;
+        const double a_s_mu = alpha_s_mu / (4.0 * M_PI);
+        const double a_s_0  = alpha_s_0 / (4.0 * M_PI);
 
-        gsl_matrix_set_identity(_U_0.get());
+        const std::array<double, dim_> u = this->_eigenvalues_U_0(alpha_s_mu, alpha_s_0);
 
-        // U_0 <- diag[ eta^(gamma_0_ev / (2 * beta_0)) ]
-        // cf. [BBL:1995A], p. 34, eq. (III.94)
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
-            gsl_vector_set(_c_0_2.get(), i, c_0_2[i]);
-        }
-        // tmp_matrix <- V . U_0
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
-        // U_0 <- tmp_matrix * V^-1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
+        // U_0 . c_0_0
+        const std::array<double, dim_> result_LL = this->_U_0(u, c_0_0);
 
-        // tmp_vector <- U_0 . c_0_0
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
+        // U_0 . a_s_0 (c_0_1 - J1 . c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
+        const std::array<double, dim_> u_1 = this->_U_0(u, a_s_0 * (c_0_1 - _J1 * c_0_0));
 
-        std::array<double, dim_> result_LL;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result_LL[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
+        // (a_s_mu J1 . U_0 . c_0_0 + U_0 . a_s_0 (c_0_1 - J1 . c_0_0)) / a_s_mu
+        const std::array<double, dim_> result_NLL = (1.0 / a_s_mu) * (a_s_mu * (_J1 * result_LL) + u_1);
 
-        // tmp_vector := c_0_0 + alpha_s_0 / (4 pi) * (c_0_1 - J * c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- (-1.0 * J * c_0_0 + 1.0 * tmp_vector) * alpha_s(mu_0) / (4 pi)
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J1.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        gsl_vector_scale(_tmp_vector.get(), alpha_s_0 / (4.0 * M_PI));
-
-        // tmp_matrix <- unit_matrix
-        gsl_matrix_set_zero(_tmp_matrix.get());
-        gsl_matrix_set_identity(_tmp_matrix.get());
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
-        // tmp_vector_3 <- tmp_vector
-        gsl_vector_memcpy(_tmp_vector_3.get(), _tmp_vector.get());
-
-
-        // tmp_vector <- c_0_0
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_0.get());
-        // tmp_matrix2 <- alpha_s(mu) / (4 pi) * J
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J1.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu / (4.0 * M_PI));
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix_2 . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix_2.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
-        // tmp_vector <- tmp_vector + tmp_vector_3
-        gsl_vector_add(_tmp_vector.get(), _tmp_vector_3.get());
-        gsl_vector_scale(_tmp_vector.get(), (4.0 * M_PI) / alpha_s_mu);
-
-        std::array<double, dim_> result_NLL;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result_NLL[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
+        // U_0 . a_s_0^2 (c_0_2 + (J1^2 - J2) . c_0_0 - J1 . c_0_1)
+        const std::array<double, dim_> u_2 = this->_U_0(u, (a_s_0 * a_s_0) * (c_0_2 + _K * c_0_0 - _J1 * c_0_1));
 
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- -1.0 * J * c_0_0 + 1.0 * tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J1.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        // tmp_vector <- alpha_s(mu_0) / (4 pi) * tmp_vector
-        gsl_vector_scale(_tmp_vector.get(), alpha_s_0 / (4.0 * M_PI));
-
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix_2 . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix_2.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
-
-        // tmp_matrix_1 <- J1 . J1
-        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _J1.get(), _J1.get(), 0.0, _tmp_matrix.get());
-        // tmp_matrix_2 <- -J2
-        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J2.get());
-        gsl_matrix_scale(_tmp_matrix_2.get(), -1.0);
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
-        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
-
-        // tmp_vector_2 <- c_0_2
-        gsl_vector_memcpy(_tmp_vector_2.get(), _c_0_2.get());
-        // tmp_vector_2 <- 1.0 * (J1^2-J2) * c_0_0 + 1.0 * tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _c_0_0.get(), 1.0, _tmp_vector_2.get());
-        // tmp_vector_2 <- -1.0 * J1 * c_0_1 + 1.0 * tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J1.get(), _c_0_1.get(), 1.0, _tmp_vector_2.get());
-        // tmp_vector_2 <- alpha_s(mu_0)^2 / (4 pi)^2 * tmp_vector_2
-        gsl_vector_scale(_tmp_vector_2.get(), alpha_s_0 * alpha_s_0 / (4.0 * M_PI * 4.0 * M_PI));
-
-        // tmp_vector_3 <- tmp_vector_2
-        gsl_vector_memcpy(_tmp_vector_3.get(), _tmp_vector_2.get());
-        // tmp_vector_2 <- U_0 . tmp_vector_3
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector_3.get(), 0.0, _tmp_vector_2.get());
-
-        // tmp_vector <- tmp_vector + tmp_vector_2
-        gsl_vector_add(_tmp_vector.get(), _tmp_vector_2.get());
-
-        // tmp_matrix2 <- alpha_s(mu)^2 / (4 pi)^2 * J2
-        gsl_matrix_memcpy(_tmp_matrix.get(), _J2.get());
-        gsl_matrix_scale(_tmp_matrix.get(), alpha_s_mu * alpha_s_mu / (4.0 * M_PI * 4.0 * M_PI));
-
-        // tmp_vector_2 <- c_0_0
-        gsl_vector_memcpy(_tmp_vector_2.get(), _c_0_0.get());
-        // tmp_vector_3 <- U_0 . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector_2.get(), 0.0, _tmp_vector_3.get());
-        // tmp_vector_2 <- tmp_matrix . tmp_vector_3
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_3.get(), 0.0, _tmp_vector_2.get());
-
-        // tmp_vector <- tmp_vector + tmp_vector_2
-        gsl_vector_add(_tmp_vector.get(), _tmp_vector_2.get());
-
-        gsl_vector_scale(_tmp_vector.get(), (4.0 * M_PI) * (4.0 * M_PI) / alpha_s_mu / alpha_s_mu);
-
-        std::array<double, dim_> result_NNLL;
-        for (unsigned i = 0; i < dim_; ++i)
-        {
-            result_NNLL[i] = gsl_vector_get(_tmp_vector.get(), i);
-        }
+        // (a_s_mu J1 . u_1 + u_2 + a_s_mu^2 J2 . U_0 . c_0_0) / a_s_mu^2
+        const std::array<double, dim_> result_NNLL = (1.0 / (a_s_mu * a_s_mu)) * (a_s_mu * (_J1 * u_1) + u_2 + (a_s_mu * a_s_mu) * (_J2 * result_LL));
 
         return std::tuple(result_LL, result_NLL, result_NNLL);
     }
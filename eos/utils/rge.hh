@@ -21,7 +21,8 @@
 #ifndef EOS_GUARD_EOS_UTILS_RGE_HH
 #define EOS_GUARD_EOS_UTILS_RGE_HH 1
 
-#include <eos/maths/gsl-interface.hh>
+#include <array>
+#include <tuple>
 
 namespace eos
 {
@@ -35,23 +36,30 @@ namespace eos
         struct NNLL;
     } // namespace accuracy
 
-    template <unsigned nf_, unsigned dim_> class MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>
+    /*
+     * Common part of the evolution at all accuracies, based on the eigenvalues of the LO anomalous
+     * dimension matrix. All members are fixed at construction, and no temporary storage is kept, such
+     * that a single object can be used concurrently from several threads.
+     */
+    template <unsigned nf_, unsigned dim_> class MultiplicativeRenormalizationGroupEvolutionBase
     {
-        private:
+        protected:
             // gamma_0 = V^-1,T . diag(gamma_0_ev) . V^T, see [BBL:1995A], p. 34, eq. (III.95)
-            std::array<double, dim_> _gamma_0_ev;
-            GSLMatrixPtr             _V, _Vinv;
+            std::array<double, dim_>                  _gamma_0_ev;
+            std::array<std::array<double, dim_>, dim_> _V, _Vinv;
 
-            // evolution matrix
-            GSLMatrixPtr _U_0;
+            MultiplicativeRenormalizationGroupEvolutionBase(const std::array<double, dim_> & gamma_0_ev, const std::array<std::array<double, dim_>, dim_> & V);
 
-            // initial conditions
-            GSLVectorPtr _c_0_0;
+            // The eigenvalues eta^(gamma_0_ev / (2 * beta_0)) of the LL evolution matrix U_0, with eta = alpha_s(mu_0) / alpha_s(mu)
+            std::array<double, dim_> _eigenvalues_U_0(const double & alpha_s_mu, const double & alpha_s_0) const;
 
-            // temporary storage objects
-            GSLMatrixPtr _tmp_matrix;
-            GSLVectorPtr _tmp_vector;
+            // U_0 . c = V . diag(u) . V^-1 . c, where u are the eigenvalues of U_0
+            std::array<double, dim_> _U_0(const std::array<double, dim_> & u, const std::array<double, dim_> & c) const;
+    };
 
+    template <unsigned nf_, unsigned dim_>
+    class MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_> : protected MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>
+    {
         public:
             /*!
              * Constructor.
@@ -85,27 +93,12 @@ namespace eos
     };
 
     // Next-to-leading logarithmic accuracy, see [BBL:1995A], p. 34, eq. (III.93)
-    template <unsigned nf_, unsigned dim_> class MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>
+    template <unsigned nf_, unsigned dim_>
+    class MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_> : protected MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>
     {
         private:
-            // gamma_0 = V^-1,T . diag(gamma_0_ev) . V^T, see [BBL:1995A], p. 34, eq. (III.95)
-            std::array<double, dim_> _gamma_0_ev;
-            GSLMatrixPtr             _V, _Vinv;
-
-            // gamma_1 = V^-1,T . G . V^T, see [BBL:1995A], p. 34, eq. (III.96)
-            GSLMatrixPtr _G;
-
-            // evolution matrices
-            GSLMatrixPtr _U_0;
-            GSLMatrixPtr _J;
-
-            // initial conditions
-            GSLVectorPtr _c_0_0;
-            GSLVectorPtr _c_0_1;
-
-            // temporary storage objects
-            GSLMatrixPtr _tmp_matrix, _tmp_matrix_2;
-            GSLVectorPtr _tmp_vector, _tmp_vector_2, _tmp_vector_3;
+            // evolution matrix J = V . H . V^-1, see [BBL:1995A], p. 34, eq. (III.97)
+            std::array<std::array<double, dim_>, dim_> _J;
 
         public:
             /*!
@@ -162,30 +155,16 @@ namespace eos
     };
 
     // Next-to-next-to-leading logarithmic accuracy, see [BFS:2001A], p. 31, eq. (90)
-    template <unsigned nf_, unsigned dim_> class MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, nf_, dim_>
+    template <unsigned nf_, unsigned dim_>
+    class MultiplicativeRenormalizationGroupEvolution<accuracy::NNLL, nf_, dim_> : protected MultiplicativeRenormalizationGroupEvolutionBase<nf_, dim_>
     {
         private:
-            // gamma_0 = V^-1,T . diag(gamma_0_ev) . V^T, see [BBL:1995A], p. 34, eq. (III.95)
-            std::array<double, dim_> _gamma_0_ev;
-            GSLMatrixPtr             _V, _Vinv;
-
-            // gamma_1 = V^-1,T . G . V^T, see [BBL:1995A], p. 34, eq. (III.96)
-            GSLMatrixPtr _G1;
-            GSLMatrixPtr _G2;
-
-            // evolution matrices
-            GSLMatrixPtr _U_0;
-            GSLMatrixPtr _J1;
-            GSLMatrixPtr _J2;
-
-            // initial conditions
-            GSLVectorPtr _c_0_0;
-            GSLVectorPtr _c_0_1;
-            GSLVectorPtr _c_0_2;
-
-            // temporary storage objects
-            GSLMatrixPtr _tmp_matrix, _tmp_matrix_2;
-            GSLVectorPtr _tmp_vector, _tmp_vector_2, _tmp_vector_3;
+            // evolution matrices J1 = V . H1 . V^-1 and J2 = V . H2 . V^-1, see [BFS:2001A], p. 32, eq. (93)
+            std::array<std::array<double, dim_>, dim_> _J1;
+            std::array<std::array<double, dim_>, dim_> _J2;
+
+            // K = J1 . J1 - J2, which enters the initial conditions at order alpha_s^2
+            std::array<std::array<double, dim_>, dim_> _K;
 
         public:
             /*!
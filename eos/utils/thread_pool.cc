@@ -27,13 +27,56 @@
 #include <eos/utils/thread_pool.hh>
 
 #include <atomic>
-#include <list>
+#include <deque>
+#include <memory>
 #include <unistd.h>
+#include <vector>
 
 namespace eos
 {
     template <> struct Implementation<ThreadPool>
     {
+            // A range of jobs, shared among all workers that pick it up
+            struct Range
+            {
+                    std::function<void(const unsigned &)> function;
+
+                    unsigned size;
+
+                    // the next index to be processed
+                    std::atomic<unsigned> next;
+
+                    // the number of indices that have not yet been processed
+                    std::atomic<unsigned> remaining;
+
+                    Ticket ticket;
+
+                    Range(const std::function<void(const unsigned &)> & function, const unsigned & size) :
+                        function(function),
+                        size(size),
+                        next(0),
+                        remaining(size)
+                    {
+                    }
+            };
+
+            // Either a single job or a share of a range of jobs
+            struct Job
+            {
+                    std::function<void(void)> function;
+
+                    Ticket ticket;
+
+                    std::shared_ptr<Range> range;
+            };
+
+            struct Worker
+            {
+                    Mutex mutex;
+
+                    std::deque<Job> queue;
+            };
+
             unsigned      number_of_threads;
             unsigned long nominal_capacity;
             unsigned long stop_capacity;
@@ -47,80 +90,161 @@ namespace eos
             ConditionVariable * const job_arrival;
             ConditionVariable * const job_capacity;
 
-            unsigned long waiting_for_jobs;
-            unsigned long pending_jobs;
+            std::atomic<unsigned long> waiting_for_jobs;
+            std::atomic<unsigned long> pending_jobs;
+            std::atomic<unsigned long> queued_jobs;
 
-            std::list<std::pair<Ticket, std::function<void(void)>>> queue;
+            // Round-robin assignment of new jobs to the workers
+            std::atomic<unsigned> next_worker;
 
-            std::list<Thread *> threads;
+            std::vector<std::unique_ptr<Worker>> workers;
 
-            void
-            thread_function()
+            std::vector<Thread *> threads;
+
+            // the pool whose worker is the current thread, if any
+            static thread_local const Implementation<ThreadPool> * current_pool;
+
+            bool
+            take(const unsigned & index, Job & job)
             {
-                std::function<void(void)> job;
-                Ticket                    ticket;
-                bool                      have_job;
+                // first, try to take the most recent job from our own queue ...
+                {
+                    Worker & worker = *workers[index];
+                    Lock     l(worker.mutex);
 
-                do
+                    if (! worker.queue.empty())
+                    {
+                        job = std::move(worker.queue.back());
+                        worker.queue.pop_back();
+                        queued_jobs -= 1;
+
+                        return true;
+                    }
+                }
+
+                // ... then try to steal the oldest job from another worker's queue
+                for (unsigned i = 1; i < number_of_threads; ++i)
                 {
-                    have_job = false;
+                    Worker & victim = *workers[(index + i) % number_of_threads];
+                    Lock     l(victim.mutex);
 
+                    if (! victim.queue.empty())
                     {
-                        Lock l(*job_mutex);
+                        job = std::move(victim.queue.front());
+                        victim.queue.pop_front();
+                        queued_jobs -= 1;
 
-                        // Before we check the queue: have we been asked to terminate?
-                        if (terminate)
-                        {
-                            break;
-                        }
+                        return true;
+                    }
+                }
 
-                        if (queue.empty())
-                        {
-                            waiting_for_jobs += 1;
-                            job_arrival->wait(*job_mutex);
-                            waiting_for_jobs -= 1;
+                return false;
+            }
 
-                            // We have been woken up and there is no job: have we been asked to terminate?
-                            if (queue.empty() && terminate)
-                            {
-                                break;
-                            }
-                        }
+            static void
+            run(Job & job)
+            {
+                if (job.range)
+                {
+                    Range & range = *job.range;
 
-                        if (queue.empty())
+                    for (unsigned i = range.next.fetch_add(1); i < range.size; i = range.next.fetch_add(1))
+                    {
+                        range.function(i);
+
+                        if (1 == range.remaining.fetch_sub(1))
                         {
-                            continue;
+                            range.ticket.mark();
                         }
+                    }
+                }
+                else
+                {
+                    job.function();
+                    job.ticket.mark();
+                }
+            }
 
-                        ticket   = queue.front().first;
-                        job      = std::move(queue.front().second);
-                        have_job = true;
-                        queue.pop_front();
+            void
+            thread_function(const unsigned & index)
+            {
+                Job job;
+
+                current_pool = this;
+
+                do
+                {
+                    // Before we check the queues: have we been asked to terminate?
+                    if (terminate)
+                    {
+                        break;
                     }
 
-                    // Execute the job outside the critical section
-                    if (have_job)
+                    if (take(index, job))
                     {
-                        job();
-                        ticket.mark();
+                        // Execute the job outside of any critical section
+                        run(job);
 
                         // Release the job (and any state it captured) promptly.
-                        job = nullptr;
+                        job.function = nullptr;
+                        job.range.reset();
+
+                        if (pending_jobs.fetch_sub(1) - 1 == nominal_capacity)
+                        {
+                            Lock l(*job_mutex);
+                            job_capacity->signal();
+                        }
+
+                        continue;
                     }
 
                     {
                         Lock l(*job_mutex);
-                        pending_jobs -= 1;
 
-                        if (pending_jobs == nominal_capacity)
+                        // Announce that we are waiting before checking for new jobs, so that
+                        // no job arrival can be missed.
+                        waiting_for_jobs += 1;
+
+                        if ((0 == queued_jobs) && (! terminate))
                         {
-                            job_capacity->signal();
+                            job_arrival->wait(*job_mutex);
                         }
+
+                        waiting_for_jobs -= 1;
                     }
                 }
                 while (true);
             }
 
+            void
+            push(const unsigned & index, Job && job)
+            {
+                Worker & worker = *workers[index % number_of_threads];
+                Lock     l(worker.mutex);
+
+                worker.queue.push_back(std::move(job));
+            }
+
+            void
+            notify(const unsigned long & number_of_jobs)
+            {
+                if (0 == waiting_for_jobs)
+                {
+                    return;
+                }
+
+                Lock l(*job_mutex);
+
+                if (number_of_jobs > 1)
+                {
+                    job_arrival->broadcast();
+                }
+                else
+                {
+                    job_arrival->signal();
+                }
+            }
+
             static unsigned
             _number_of_threads()
             {
@@ -135,7 +259,7 @@ namespace eos
                     result               = std::min(result, max_threads);
                 }
 
-                return result;
+                return std::max(result, 1u);
             }
 
             Implementation() :
@@ -147,11 +271,19 @@ namespace eos
                 job_arrival(new ConditionVariable),
                 job_capacity(new ConditionVariable),
                 waiting_for_jobs(0),
-                pending_jobs(0)
+                pending_jobs(0),
+                queued_jobs(0),
+                next_worker(0)
             {
+                // all queues must exist before the first thread starts stealing
+                for (unsigned i(0); i < number_of_threads; ++i)
+                {
+                    workers.push_back(std::make_unique<Worker>());
+                }
+
                 for (unsigned i(0); i < number_of_threads; ++i)
                 {
-                    threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this)));
+                    threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this, i)));
                 }
             }
 
@@ -171,6 +303,8 @@ namespace eos
             }
     };
 
+    thread_local const Implementation<ThreadPool> * Implementation<ThreadPool>::current_pool = nullptr;
+
     ThreadPool::ThreadPool() :
         InstantiationPolicy<ThreadPool, Singleton>(),
         PrivateImplementationPattern<ThreadPool>(new Implementation<ThreadPool>)
@@ -184,18 +318,39 @@ namespace eos
     {
         Ticket ticket;
 
+        _imp->pending_jobs += 1;
+        _imp->queued_jobs  += 1;
+        _imp->push(_imp->next_worker.fetch_add(1), Implementation<ThreadPool>::Job{ job, ticket, nullptr });
+        _imp->notify(1);
+
+        return ticket;
+    }
+
+    Ticket
+    ThreadPool::enqueue_range(const unsigned & size, const std::function<void(const unsigned &)> & job)
+    {
+        auto range = std::make_shared<Implementation<ThreadPool>::Range>(job, size);
+
+        if (0 == size)
         {
-            Lock l(*_imp->job_mutex);
-            _imp->queue.push_back(std::make_pair(ticket, job));
-            _imp->pending_jobs += 1;
+            range->ticket.mark();
 
-            if (_imp->waiting_for_jobs > 0)
-            {
-                _imp->job_arrival->signal();
-            }
+            return range->ticket;
         }
 
-        return ticket;
+        // hand one share of the range to as many workers as can make use of it
+        const unsigned number_of_shares = std::min(size, _imp->number_of_threads);
+        const unsigned first            = _imp->next_worker.fetch_add(number_of_shares);
+
+        _imp->pending_jobs += number_of_shares;
+        _imp->queued_jobs  += number_of_shares;
+        for (unsigned i = 0; i < number_of_shares; ++i)
+        {
+            _imp->push(first + i, Implementation<ThreadPool>::Job{ nullptr, range->ticket, range });
+        }
+        _imp->notify(number_of_shares);
+
+        return range->ticket;
     }
 
     ThreadPool *
@@ -222,4 +377,10 @@ namespace eos
     {
         return _imp->number_of_threads;
     }
+
+    bool
+    ThreadPool::is_worker_thread() const
+    {
+        return _imp.get() == Implementation<ThreadPool>::current_pool;
+    }
 } // namespace eos
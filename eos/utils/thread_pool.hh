@@ -28,6 +28,13 @@
 
 namespace eos
 {
+    /**
+     * ThreadPool executes jobs asynchronously on a fixed number of worker threads.
+     *
+     * Each worker owns a double-ended queue of jobs. Workers process their own queue
+     * last-in-first-out, and steal jobs from the front of other workers' queues once their
+     * own queue has run dry.
+     */
     class ThreadPool : public InstantiationPolicy<ThreadPool, Singleton>, public PrivateImplementationPattern<ThreadPool>
     {
         public:
@@ -35,13 +42,40 @@ namespace eos
 
             ~ThreadPool();
 
+            /*!
+             * Enqueue a single job.
+             *
+             * @param work  The job to be executed.
+             *
+             * Returns a ticket that is marked once the job has completed.
+             */
             Ticket enqueue(const std::function<void(void)> & work);
 
+            /*!
+             * Enqueue a range of jobs, i.e., call a function once for each index in [0, size).
+             *
+             * The indices are distributed among all workers without further allocations or locking.
+             *
+             * @param size  The number of indices.
+             * @param work  The function to be called for each index.
+             *
+             * Returns a single ticket that is marked once all jobs in the range have completed.
+             */
+            Ticket enqueue_range(const unsigned & size, const std::function<void(const unsigned &)> & work);
+
             static ThreadPool * instance();
 
             void wait_for_free_capacity();
 
             unsigned number_of_threads() const;
+
+            /*!
+             * Determine if the calling thread is one of the workers of this pool.
+             *
+             * Jobs that wait on the tickets of further jobs must not do so from a worker thread,
+             * since all workers might end up waiting for jobs that are never scheduled.
+             */
+            bool is_worker_thread() const;
     };
 } // namespace eos
 
@@ -0,0 +1,96 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/thread_pool.hh>
+
+#include <test/test.hh>
+
+#include <atomic>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ThreadPoolTest : public TestCase
+{
+    public:
+        ThreadPoolTest() :
+            TestCase("thread_pool_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            /* Test single jobs */
+            {
+                std::atomic<unsigned> counter(0);
+                std::vector<Ticket>   tickets;
+
+                for (unsigned i = 0; i < 100; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&counter]() { counter += 1; }));
+                }
+
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                TEST_CHECK_EQUAL(100u, counter.load());
+            }
+
+            /* Test ranges of jobs */
+            {
+                std::vector<double> values(1000, 0.0);
+
+                Ticket ticket = ThreadPool::instance()->enqueue_range(values.size(), [&values](const unsigned & i) { values[i] += 2.0 * i; });
+                ticket.wait();
+
+                for (unsigned i = 0; i < values.size(); ++i)
+                {
+                    TEST_CHECK_EQUAL(2.0 * i, values[i]);
+                }
+            }
+
+            /* Test an empty range of jobs */
+            {
+                Ticket ticket = ThreadPool::instance()->enqueue_range(0, [](const unsigned &) {});
+                ticket.wait();
+            }
+
+            /* Test the identification of worker threads */
+            {
+                TEST_CHECK(! ThreadPool::instance()->is_worker_thread());
+
+                std::atomic<unsigned> workers(0);
+                Ticket                ticket = ThreadPool::instance()->enqueue_range(100,
+                                                                      [&workers](const unsigned &)
+                                                                      {
+                                                                          if (ThreadPool::instance()->is_worker_thread())
+                                                                          {
+                                                                              workers += 1;
+                                                                          }
+                                                                      });
+                ticket.wait();
+
+                TEST_CHECK_EQUAL(100u, workers.load());
+            }
+        }
+} thread_pool_test;
@@ -835,6 +835,8 @@ BOOST_PYTHON_MODULE(_eos)
             .def("value", &ObservableCache::ObservableId::value, return_value_policy<return_by_value>());
 
     // ObservableCache
+    ::impl::iterable_to_std_vector_converter<Parameter>                     iterable_to_std_vector_converter_Parameter;
+    ::impl::iterable_to_std_vector_converter<ObservableCache::ObservableId> iterable_to_std_vector_converter_ObservableId;
     class_<ObservableCache>("ObservableCache", R"(
         Provides a cache for the efficient evaluation of observables.
     )",
@@ -866,7 +868,13 @@ BOOST_PYTHON_MODULE(_eos)
 
             :rtype: eos.Parameters
         )",
-                 args("self"));
+                 args("self"))
+            .def("_predict", &::impl::ObservableCache_predict, R"(
+            Internal binding for the batch prediction of observables; use :py:meth:`eos.ObservableCache.predict` instead.
+
+            Both the samples and the predictions must be C-contiguous buffers of 64-bit floating point numbers.
+        )",
+                 args("self", "parameters", "samples", "ids", "predictions"));
 
     // ReferenceName
     class_<ReferenceName>("ReferenceName", init<std::string>())
@@ -926,9 +934,25 @@ BOOST_PYTHON_MODULE(_eos)
             order and converts it before calling this binding.
         )",
                  args("cache", "pdf_name", "kinematics", "options", "resolution", "observations"))
-            .staticmethod("_Unbinned1D");
+            .staticmethod("_Unbinned1D")
+            .def("_UnbinnedFactorized", &::impl::LogLikelihoodBlock_UnbinnedFactorized, R"(
+            Internal binding for the factorised unbinned log-likelihood block; use :py:meth:`eos.LogLikelihoodBlock.UnbinnedFactorized` instead.
+
+            The events must be a C-contiguous buffer of 64-bit floating point numbers.
+        )",
+                 args("cache", "pdf_name", "options", "q2_grid", "events"))
+            .staticmethod("_UnbinnedFactorized")
+            .def("_BinnedPoisson", &::impl::LogLikelihoodBlock_BinnedPoisson, R"(
+            Internal binding for the binned Poisson log-likelihood block; use :py:meth:`eos.LogLikelihoodBlock.BinnedPoisson` instead.
+
+            This binding expects the workspace as a file name or a JSON string, and the parameter map as a
+            dictionary from pyhf parameter names to qualified names.
+        )",
+                 args("cache", "workspace", "parameter_map"))
+            .staticmethod("_BinnedPoisson");
 
     // LogLikelihood
+    ::impl::std_pair_to_python_converter<double, double> converter_bootstrap_p_value;
     class_<LogLikelihood>("LogLikelihood", R"(
             Represents the log(likelihood) of a Bayesian analysis undertaken with the :class:`Analysis <eos.Analysis>` class.
         )",
@@ -959,7 +983,23 @@ BOOST_PYTHON_MODULE(_eos)
 
             :rtype: float
         )",
-                 args("self"));
+                 args("self"))
+            .def("bootstrap_p_value", &::impl::LogLikelihood_bootstrap_p_value, R"(
+            Computes the p-value of the observed data for the current parameter point, using the log(likelihood) as the test statistic.
+
+            :param datasets: The number of simulated data sets.
+            :type datasets: int
+
+            :return: The p-value and its uncertainty.
+            :rtype: tuple of float
+        )",
+                 args("self", "datasets"))
+            .def("_simulate", &::impl::LogLikelihood_simulate, R"(
+            Internal binding for the simulation of pseudo experiments; use :py:meth:`eos.LogLikelihood.simulate` instead.
+
+            The test statistics must be a C-contiguous buffer of 64-bit floating point numbers.
+        )",
+                 args("self", "seed", "test_statistics"));
 
     // Constraint
     class_<Constraint>("Constraint", R"(
@@ -1293,7 +1333,38 @@ BOOST_PYTHON_MODULE(_eos)
 
             :rtype: float
         )",
-                 args("self"));
+                 args("self"))
+            .def("_evaluate_batch", &::impl::LogPosterior_evaluate_batch, R"(
+            Internal binding for the batch evaluation of the posterior; use :py:meth:`eos.LogPosterior.evaluate_batch` instead.
+
+            Both the points and the results must be C-contiguous buffers of 64-bit floating point numbers.
+        )",
+                 args("self", "u_points", "results"))
+            .def("_evaluate_log_likelihood_batch", &::impl::LogPosterior_evaluate_log_likelihood_batch, R"(
+            Internal binding for the batch evaluation of the likelihood; use :py:meth:`eos.LogPosterior.evaluate_log_likelihood_batch` instead.
+
+            Both the points and the results must be C-contiguous buffers of 64-bit floating point numbers.
+        )",
+                 args("self", "points", "results"))
+            .def("_gradient", &::impl::LogPosterior_gradient, R"(
+            Internal binding for the gradient of the posterior; use :py:meth:`eos.LogPosterior.gradient` instead.
+
+            The gradient must be a C-contiguous buffer of 64-bit floating point numbers.
+        )",
+                 args("self", "gradient"))
+            .def("_inverse_cdf_jacobian", &::impl::LogPosterior_inverse_cdf_jacobian, R"(
+            Internal binding for the Jacobian of the inverse prior transform; use :py:meth:`eos.LogPosterior.inverse_cdf_jacobian` instead.
+
+            The Jacobian must be a C-contiguous buffer of 64-bit floating point numbers.
+        )",
+                 args("self", "jacobian"))
+            .def("_sample_mcmc", &::impl::LogPosterior_sample_mcmc, R"(
+            Internal binding for the native adaptive Markov chain sampler; use :py:meth:`eos.Analysis.sample_chains` instead.
+
+            All buffers must be C-contiguous buffers of 64-bit floating point numbers. The number of samples per chain
+            is inferred from the size of the samples buffer. Returns the acceptance rate of each chain's main run.
+        )",
+                 args("self", "chains", "preruns", "prerun_samples", "stride", "cov_scale", "seed", "start_points", "samples", "u_samples", "log_posterior"));
 
     // test_statistics::ChiSquare
     class_<test_statistics::ChiSquare>("test_statisticsChiSquare", no_init)
@@ -1413,6 +1484,12 @@ BOOST_PYTHON_MODULE(_eos)
             :rtype: float
         )",
                  args("self"))
+            .def("_evaluate_batch", &::impl::Observable_evaluate_batch, R"(
+            Internal binding for the batch evaluation of the observable; use :py:meth:`eos.Observable.evaluate_batch` instead.
+
+            Both the points and the results must be C-contiguous buffers of 64-bit floating point numbers.
+        )",
+                 args("self", "variables", "points", "results"))
             .def("name", &Observable::name, return_value_policy<copy_const_reference>(), R"(
             Returns the name of the observable.
 
@@ -1612,7 +1689,24 @@ BOOST_PYTHON_MODULE(_eos)
 
             :rtype: eos.Kinematics
         )",
-                 args("self"));
+                 args("self"))
+            .def("_sampling_variables", &::impl::SignalPDF_sampling_variables, R"(
+            Internal binding; returns the names of the sampling variables in the order of the columns of generated events.
+        )",
+                 args("self"))
+            .def("_generate", &::impl::SignalPDF_generate, R"(
+            Internal binding for the native event generator; use :py:meth:`eos.SignalPDF.generate` instead.
+
+            The events buffer must be a C-contiguous buffer of 64-bit floating point numbers. The number of events is
+            inferred from its size. Returns the expected fraction of accepted proposal points.
+        )",
+                 args("self", "bins", "adaptation_steps", "adaptation_samples", "envelope_samples", "safety_factor", "seed", "events"))
+            .def("_write_events", &::impl::SignalPDF_write_events, R"(
+            Internal binding for the native event generator; use :py:meth:`eos.SignalPDF.write_events` instead.
+
+            Returns the expected fraction of accepted proposal points.
+        )",
+                 args("self", "bins", "adaptation_steps", "adaptation_samples", "envelope_samples", "safety_factor", "seed", "path", "events"));
 
     // SignalPDFEntry
     register_ptr_to_python<std::shared_ptr<const SignalPDFEntry>>();
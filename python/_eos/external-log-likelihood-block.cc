@@ -26,6 +26,25 @@ using boost::python::object;
 
 namespace eos
 {
+    namespace
+    {
+        // Holds the GIL for its lifetime, since the block might be used from threads other than Python's main thread
+        struct GILGuard
+        {
+            PyGILState_STATE state;
+
+            GILGuard() :
+                state(PyGILState_Ensure())
+            {
+            }
+
+            ~GILGuard()
+            {
+                PyGILState_Release(state);
+            }
+        };
+    }
+
     ExternalLogLikelihoodBlock::ExternalLogLikelihoodBlock(const ObservableCache & cache, object factory) :
         _cache(cache),
         _factory(factory),
@@ -62,6 +81,8 @@ namespace eos
     double
     ExternalLogLikelihoodBlock::evaluate() const
     {
+        GILGuard guard;
+
         return extract<double>(_evaluate());
     }
 
@@ -72,10 +93,17 @@ namespace eos
     }
 
     double
-    ExternalLogLikelihoodBlock::sample(gsl_rng *) const
+    ExternalLogLikelihoodBlock::sample(gsl_rng * rng) const
     {
-        throw InternalError("Not implemented");
-        return 0.0;
+        GILGuard guard;
+
+        if (! PyObject_HasAttrString(_python_llh_block.ptr(), "sample"))
+        {
+            throw InternalError("ExternalLogLikelihoodBlock::sample: the external likelihood does not provide a 'sample(seed)' method");
+        }
+
+        // the external likelihood draws its pseudo data from its own generator, seeded from ours
+        return extract<double>(_python_llh_block.attr("sample")(gsl_rng_get(rng)));
     }
 
     double
@@ -20,12 +20,21 @@
 
 #include "python/_eos/wrappers.hh"
 
+#include "eos/statistics/event-generator.hh"
+#include "eos/statistics/markov-chain-sampler.hh"
 #include "eos/utils/wilson-polynomial.hh"
 
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
 #include <vector>
 
 using boost::python::_;
 using boost::python::dict;
+using boost::python::extract;
 using boost::python::len;
 using boost::python::list;
 using boost::python::object;
@@ -137,6 +146,346 @@ namespace impl
         PyErr_SetString(PyExc_RuntimeError, e.what());
     }
 
+    // view of a contiguous buffer of doubles, released on destruction
+    class DoubleBuffer
+    {
+        private:
+            Py_buffer _buffer;
+
+        public:
+            DoubleBuffer(object o, bool writable)
+            {
+                int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+                if (0 != PyObject_GetBuffer(o.ptr(), &_buffer, flags))
+                {
+                    boost::python::throw_error_already_set();
+                }
+
+                if ((nullptr == _buffer.format) || (std::string(_buffer.format) != "d"))
+                {
+                    PyBuffer_Release(&_buffer);
+                    PyErr_SetString(PyExc_TypeError, "expected a buffer of type float64");
+                    boost::python::throw_error_already_set();
+                }
+            }
+
+            ~DoubleBuffer() { PyBuffer_Release(&_buffer); }
+
+            double *
+            data() const
+            {
+                return static_cast<double *>(_buffer.buf);
+            }
+
+            std::size_t
+            size() const
+            {
+                return _buffer.len / sizeof(double);
+            }
+    };
+
+    // export helper for Observable::evaluate_batch, operating on objects that support the buffer protocol
+    void
+    Observable_evaluate_batch(eos::Observable & o, const std::vector<std::string> & variables, object points, object results)
+    {
+        DoubleBuffer points_buffer(points, false);
+        DoubleBuffer results_buffer(results, true);
+
+        o.evaluate_batch(variables, std::span<const double>(points_buffer.data(), points_buffer.size()), std::span<double>(results_buffer.data(), results_buffer.size()));
+    }
+
+    // export helper for ObservableCache::predict, operating on objects that support the buffer protocol
+    void
+    ObservableCache_predict(const eos::ObservableCache & c, const std::vector<eos::Parameter> & parameters, object samples,
+                            const std::vector<eos::ObservableCache::ObservableId> & ids, object predictions)
+    {
+        DoubleBuffer samples_buffer(samples, false);
+        DoubleBuffer predictions_buffer(predictions, true);
+
+        c.predict(parameters,
+                  std::span<const double>(samples_buffer.data(), samples_buffer.size()),
+                  ids,
+                  std::span<double>(predictions_buffer.data(), predictions_buffer.size()));
+    }
+
+    // export helper for LogLikelihoodBlock::UnbinnedFactorized, operating on objects that support the buffer protocol
+    eos::LogLikelihoodBlockPtr
+    LogLikelihoodBlock_UnbinnedFactorized(const eos::ObservableCache & cache, const eos::QualifiedName & pdf_name, const eos::Options & options,
+                                          const std::vector<double> & q2_grid, object events)
+    {
+        DoubleBuffer events_buffer(events, false);
+
+        return eos::LogLikelihoodBlock::UnbinnedFactorized(cache, pdf_name, options, q2_grid, std::span<const double>(events_buffer.data(), events_buffer.size()));
+    }
+
+    // export helper for LogLikelihoodBlock::BinnedPoisson, converting the parameter map from a dictionary
+    eos::LogLikelihoodBlockPtr
+    LogLikelihoodBlock_BinnedPoisson(const eos::ObservableCache & cache, const std::string & workspace, dict parameter_map)
+    {
+        std::map<std::string, eos::QualifiedName> map;
+
+        list items = parameter_map.items();
+        for (long i = 0, i_end = len(items); i < i_end; ++i)
+        {
+            map.emplace(extract<std::string>(items[i][0])(), eos::QualifiedName(extract<std::string>(items[i][1])()));
+        }
+
+        return eos::LogLikelihoodBlock::BinnedPoisson(cache, workspace, map);
+    }
+
+    // export helper for LogLikelihood::simulate, operating on objects that support the buffer protocol
+    void
+    LogLikelihood_simulate(const eos::LogLikelihood & log_likelihood, const unsigned long & seed, object test_statistics)
+    {
+        DoubleBuffer test_statistics_buffer(test_statistics, true);
+
+        std::exception_ptr error;
+
+        // external blocks reacquire the GIL when needed, so other Python threads may run in the meantime
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            log_likelihood.simulate(seed, std::span<double>(test_statistics_buffer.data(), test_statistics_buffer.size()));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // export helper for LogLikelihood::bootstrap_p_value, releasing the GIL while the pseudo experiments are simulated
+    std::pair<double, double>
+    LogLikelihood_bootstrap_p_value(eos::LogLikelihood & log_likelihood, const unsigned & datasets)
+    {
+        std::pair<double, double> result;
+        std::exception_ptr        error;
+
+        // external blocks reacquire the GIL from the workers of the thread pool when sampling
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            result = log_likelihood.bootstrap_p_value(datasets);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        return result;
+    }
+
+    // export helper for LogPosterior::evaluate_batch, operating on objects that support the buffer protocol
+    void
+    LogPosterior_evaluate_batch(const eos::LogPosterior & log_posterior, object u_points, object results)
+    {
+        DoubleBuffer u_points_buffer(u_points, false);
+        DoubleBuffer results_buffer(results, true);
+
+        std::exception_ptr error;
+
+        // the clones do not call into Python, so other Python threads may run in the meantime
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            log_posterior.evaluate_batch(std::span<const double>(u_points_buffer.data(), u_points_buffer.size()), std::span<double>(results_buffer.data(), results_buffer.size()));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // export helper for LogPosterior::evaluate_log_likelihood_batch, operating on objects that support the buffer protocol
+    void
+    LogPosterior_evaluate_log_likelihood_batch(const eos::LogPosterior & log_posterior, object points, object results)
+    {
+        DoubleBuffer points_buffer(points, false);
+        DoubleBuffer results_buffer(results, true);
+
+        std::exception_ptr error;
+
+        // the clones do not call into Python, so other Python threads may run in the meantime
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            log_posterior.evaluate_log_likelihood_batch(std::span<const double>(points_buffer.data(), points_buffer.size()), std::span<double>(results_buffer.data(), results_buffer.size()));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // export helper for LogPosterior::gradient, operating on objects that support the buffer protocol
+    void
+    LogPosterior_gradient(const eos::LogPosterior & log_posterior, object gradient)
+    {
+        DoubleBuffer gradient_buffer(gradient, true);
+
+        std::exception_ptr error;
+
+        // the observables do not call into Python, so other Python threads may run in the meantime
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            log_posterior.gradient(std::span<double>(gradient_buffer.data(), gradient_buffer.size()));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // export helper for LogPosterior::inverse_cdf_jacobian, operating on objects that support the buffer protocol
+    void
+    LogPosterior_inverse_cdf_jacobian(const eos::LogPosterior & log_posterior, object jacobian)
+    {
+        DoubleBuffer jacobian_buffer(jacobian, true);
+
+        // the priors might be implemented in Python, so we keep the GIL
+        log_posterior.inverse_cdf_jacobian(std::span<double>(jacobian_buffer.data(), jacobian_buffer.size()));
+    }
+
+    // export helper for MarkovChainSampler, operating on objects that support the buffer protocol
+    std::vector<double>
+    LogPosterior_sample_mcmc(const eos::LogPosterior & log_posterior, const unsigned & chains, const unsigned & preruns, const unsigned & prerun_samples,
+                             const unsigned & stride, const double & cov_scale, const unsigned long & seed, object start_points,
+                             object samples, object u_samples, object log_posterior_values)
+    {
+        std::unique_ptr<DoubleBuffer> start_points_buffer(start_points.is_none() ? nullptr : new DoubleBuffer(start_points, false));
+        DoubleBuffer                  samples_buffer(samples, true);
+        DoubleBuffer                  u_samples_buffer(u_samples, true);
+        DoubleBuffer                  log_posterior_buffer(log_posterior_values, true);
+
+        const unsigned dim = log_posterior.varied_parameters().size();
+        const unsigned N   = (0 == chains * dim) ? 0 : samples_buffer.size() / (chains * dim);
+
+        auto config = eos::MarkovChainSampler::Config().chains(chains).preruns(preruns).prerun_samples(prerun_samples).samples(N).stride(stride).cov_scale(cov_scale).seed(seed);
+        eos::MarkovChainSampler sampler(log_posterior, config);
+
+        std::vector<double> result;
+        std::exception_ptr  error;
+
+        // the chains do not call into Python, so other Python threads may run in the meantime
+        PyThreadState * state = PyEval_SaveThread();
+        try
+        {
+            result = sampler.run(start_points_buffer ? std::span<const double>(start_points_buffer->data(), start_points_buffer->size()) : std::span<const double>(),
+                                 std::span<double>(samples_buffer.data(), samples_buffer.size()),
+                                 std::span<double>(u_samples_buffer.data(), u_samples_buffer.size()),
+                                 std::span<double>(log_posterior_buffer.data(), log_posterior_buffer.size()));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        PyEval_RestoreThread(state);
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        return result;
+    }
+
+    // export helpers for EventGenerator, operating on objects that support the buffer protocol
+    std::vector<std::string>
+    SignalPDF_sampling_variables(const eos::SignalPDF & pdf)
+    {
+        std::vector<std::string> result;
+        for (const auto & d : pdf)
+        {
+            result.push_back(d.parameter->name());
+        }
+
+        return result;
+    }
+
+    namespace
+    {
+        // run f on a new event generator without holding the GIL; the PDF does not call into Python
+        double
+        run_event_generator(const eos::SignalPDF & pdf, const eos::EventGenerator::Config & config, const std::function<void(eos::EventGenerator &)> & f)
+        {
+            double             result = 0.0;
+            std::exception_ptr error;
+
+            PyThreadState * state = PyEval_SaveThread();
+            try
+            {
+                eos::EventGenerator generator(pdf, config);
+                f(generator);
+                result = generator.efficiency();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            PyEval_RestoreThread(state);
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+
+            return result;
+        }
+    } // namespace
+
+    double
+    SignalPDF_generate(const eos::SignalPDF & pdf, const unsigned & bins, const unsigned & adaptation_steps, const unsigned & adaptation_samples,
+                       const unsigned & envelope_samples, const double & safety_factor, const unsigned long & seed, object events)
+    {
+        DoubleBuffer events_buffer(events, true);
+
+        auto config = eos::EventGenerator::Config().bins(bins).adaptation_steps(adaptation_steps).adaptation_samples(adaptation_samples)
+                .envelope_samples(envelope_samples).safety_factor(safety_factor).seed(seed);
+
+        return run_event_generator(pdf, config, [&](eos::EventGenerator & generator) { generator.generate(std::span<double>(events_buffer.data(), events_buffer.size())); });
+    }
+
+    double
+    SignalPDF_write_events(const eos::SignalPDF & pdf, const unsigned & bins, const unsigned & adaptation_steps, const unsigned & adaptation_samples,
+                           const unsigned & envelope_samples, const double & safety_factor, const unsigned long & seed, const std::string & path,
+                           const unsigned long & events)
+    {
+        auto config = eos::EventGenerator::Config().bins(bins).adaptation_steps(adaptation_steps).adaptation_samples(adaptation_samples)
+                .envelope_samples(envelope_samples).safety_factor(safety_factor).seed(seed);
+
+        return run_event_generator(pdf, config, [&](eos::EventGenerator & generator) { generator.write(path, events); });
+    }
+
     // export helper for Wilson polynomial observables
     std::tuple<double, std::vector<double>, std::vector<double>>
     compute_wilson_polynomial_coefficients(const eos::ObservablePtr & o, const std::vector<eos::QualifiedName> & _coefficients)
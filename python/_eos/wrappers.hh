@@ -20,7 +20,10 @@
 
 #include "eos/models/model.hh"
 #include "eos/observable.hh"
+#include "eos/signal-pdf.hh"
+#include "eos/statistics/log-posterior.hh"
 #include "eos/utils/exception.hh"
+#include "eos/utils/observable_cache.hh"
 #include "eos/utils/options.hh"
 #include "eos/utils/qualified-name.hh"
 
@@ -53,6 +56,51 @@ namespace impl
         return m.m_b_pole();
     }
 
+    // export helper for Observable::evaluate_batch, operating on objects that support the buffer protocol
+    void Observable_evaluate_batch(eos::Observable & o, const std::vector<std::string> & variables, boost::python::object points, boost::python::object results);
+
+    // export helper for ObservableCache::predict, operating on objects that support the buffer protocol
+    void ObservableCache_predict(const eos::ObservableCache & c, const std::vector<eos::Parameter> & parameters, boost::python::object samples,
+                                 const std::vector<eos::ObservableCache::ObservableId> & ids, boost::python::object predictions);
+
+    // export helper for LogLikelihoodBlock::UnbinnedFactorized, operating on objects that support the buffer protocol
+    eos::LogLikelihoodBlockPtr LogLikelihoodBlock_UnbinnedFactorized(const eos::ObservableCache & cache, const eos::QualifiedName & pdf_name, const eos::Options & options,
+                                                                     const std::vector<double> & q2_grid, boost::python::object events);
+
+    // export helper for LogLikelihoodBlock::BinnedPoisson, converting the parameter map from a dictionary
+    eos::LogLikelihoodBlockPtr LogLikelihoodBlock_BinnedPoisson(const eos::ObservableCache & cache, const std::string & workspace, boost::python::dict parameter_map);
+
+    // export helper for LogLikelihood::simulate, operating on objects that support the buffer protocol
+    void LogLikelihood_simulate(const eos::LogLikelihood & log_likelihood, const unsigned long & seed, boost::python::object test_statistics);
+
+    // export helper for LogLikelihood::bootstrap_p_value, releasing the GIL while the pseudo experiments are simulated
+    std::pair<double, double> LogLikelihood_bootstrap_p_value(eos::LogLikelihood & log_likelihood, const unsigned & datasets);
+
+    // export helper for LogPosterior::evaluate_batch, operating on objects that support the buffer protocol
+    void LogPosterior_evaluate_batch(const eos::LogPosterior & log_posterior, boost::python::object u_points, boost::python::object results);
+
+    // export helper for LogPosterior::evaluate_log_likelihood_batch, operating on objects that support the buffer protocol
+    void LogPosterior_evaluate_log_likelihood_batch(const eos::LogPosterior & log_posterior, boost::python::object points, boost::python::object results);
+
+    // export helper for LogPosterior::gradient, operating on objects that support the buffer protocol
+    void LogPosterior_gradient(const eos::LogPosterior & log_posterior, boost::python::object gradient);
+
+    // export helper for LogPosterior::inverse_cdf_jacobian, operating on objects that support the buffer protocol
+    void LogPosterior_inverse_cdf_jacobian(const eos::LogPosterior & log_posterior, boost::python::object jacobian);
+
+    // export helper for MarkovChainSampler, operating on objects that support the buffer protocol
+    std::vector<double> LogPosterior_sample_mcmc(const eos::LogPosterior & log_posterior, const unsigned & chains, const unsigned & preruns, const unsigned & prerun_samples,
+                                                 const unsigned & stride, const double & cov_scale, const unsigned long & seed, boost::python::object start_points,
+                                                 boost::python::object samples, boost::python::object u_samples, boost::python::object log_posterior_values);
+
+    // export helpers for EventGenerator, operating on objects that support the buffer protocol
+    std::vector<std::string> SignalPDF_sampling_variables(const eos::SignalPDF & pdf);
+    double SignalPDF_generate(const eos::SignalPDF & pdf, const unsigned & bins, const unsigned & adaptation_steps, const unsigned & adaptation_samples,
+                              const unsigned & envelope_samples, const double & safety_factor, const unsigned long & seed, boost::python::object events);
+    double SignalPDF_write_events(const eos::SignalPDF & pdf, const unsigned & bins, const unsigned & adaptation_steps, const unsigned & adaptation_samples,
+                                  const unsigned & envelope_samples, const double & safety_factor, const unsigned long & seed, const std::string & path,
+                                  const unsigned long & events);
+
     // export helper for Wilson polynomial observables
     std::tuple<double, std::vector<double>, std::vector<double>> compute_wilson_polynomial_coefficients(const eos::ObservablePtr &, const std::vector<eos::QualifiedName> &);
 } // namespace impl
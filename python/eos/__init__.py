@@ -39,6 +39,7 @@ else:
     _pkg_data_dir = __pkg_data_dir__
 
 from . import log_likelihood # patches LogLikelihoodBlock.Unbinned1D to accept the resolution in natural order
+from . import log_posterior # patches LogPosterior.evaluate_batch to return a NumPy array
 from .data import *
 from .plot import *
 from .datasets import DataSets
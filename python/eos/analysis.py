@@ -20,7 +20,9 @@
 
 import eos
 import numpy as np
+import os
 import scipy
+import threading
 
 class BestFitPoint:
     """
@@ -56,6 +58,129 @@ class BestFitPoint:
         return(result)
 
 
+class _LogLikelihoodBatchPool:
+    """
+    Pool for use with dynesty that evaluates the log(likelihood) in batches of points.
+
+    dynesty maps its functions, e.g. the evolution of proposed live points, over the points in its queue.
+    Each mapped call runs in a thread of its own. Whenever all running calls wait for a value of the log(likelihood),
+    the pending points are evaluated in one call to :meth:`eos.LogPosterior.evaluate_log_likelihood_batch`, which
+    distributes them among several clones of the posterior. Calls to :meth:`log_likelihood` outside of :meth:`map`
+    are evaluated immediately.
+
+    :param log_posterior: The log(posterior) whose log(likelihood) is evaluated.
+    :type log_posterior: eos.LogPosterior
+    :param prior_transform: The transformation from the unit hypercube to the parameter space, which might modify shared parameters.
+    :type prior_transform: callable
+    :param size: The number of points in dynesty's queue.
+    :type size: int
+    """
+    def __init__(self, log_posterior, prior_transform, size):
+        self.size = size
+        self._log_posterior = log_posterior
+        self._prior_transform = prior_transform
+        self._prior_transform_lock = threading.Lock()
+        self._condition = threading.Condition()
+        self._local = threading.local()
+        self._running = 0
+        self._pending = []
+
+
+    def log_likelihood(self, p):
+        """
+        Adapter for use with dynesty, returning the log(likelihood) in a parameter point.
+
+        :param p: Parameter point, with the elements in the same order as the varied parameters.
+        :type p: iterable
+        """
+        if not getattr(self._local, 'batched', False):
+            return self._log_posterior.evaluate_log_likelihood_batch(p)[0]
+
+        request = [np.asarray(p, dtype=np.float64), None]
+        with self._condition:
+            self._pending.append(request)
+            self._flush()
+            while request[1] is None:
+                self._condition.wait()
+
+        if isinstance(request[1], Exception):
+            raise request[1]
+
+        return request[1]
+
+
+    def prior_transform(self, u):
+        """
+        Adapter for use with dynesty, transforming a point from the unit hypercube to the parameter space.
+
+        The transformations are serialized, since they modify the parameters of the analysis.
+
+        :param u: The input probability point on the hypercube [0, 1)^D
+        :type u: iterable
+        """
+        with self._prior_transform_lock:
+            return self._prior_transform(u)
+
+
+    def _flush(self):
+        # only evaluate once all running calls wait for a value of the log(likelihood)
+        if not self._pending or len(self._pending) < self._running:
+            return
+
+        try:
+            values = self._log_posterior.evaluate_log_likelihood_batch(np.array([point for point, _ in self._pending]))
+        except Exception as e:
+            values = [e] * len(self._pending)
+
+        for request, value in zip(self._pending, values):
+            request[1] = value
+        self._pending = []
+        self._condition.notify_all()
+
+
+    def _run(self, function, arg, results, errors, index):
+        self._local.batched = True
+        try:
+            results[index] = function(arg)
+        except Exception as e:
+            errors.append(e)
+        finally:
+            with self._condition:
+                self._running -= 1
+                self._flush()
+
+
+    def map(self, function, iterable):
+        """
+        Apply a function to each element of an iterable, evaluating the log(likelihood) of all calls in batches.
+
+        :param function: The function to apply.
+        :type function: callable
+        :param iterable: The arguments, one per call of the function.
+        :type iterable: iterable
+
+        :return: The results of the calls, in the order of the arguments.
+        :rtype: list
+        """
+        args = list(iterable)
+        results = [None] * len(args)
+        errors = []
+
+        with self._condition:
+            self._running = len(args)
+
+        threads = [threading.Thread(target=self._run, args=(function, arg, results, errors, i)) for i, arg in enumerate(args)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        if errors:
+            raise errors[0]
+
+        return results
+
+
 class Analysis:
     """Represents a statistical analysis.
 
@@ -395,7 +520,8 @@ class Analysis:
                             If not specified, optimization starts at the current parameter point.
         :type start_point: iterable, optional
         :param rng: Optional random number generator
-        :param \**kwargs: Are passed to `scipy.optimize.minimize`
+        :param \**kwargs: Are passed to `scipy.optimize.minimize`. Pass ``jac=analysis.negative_log_pdf_gradient``
+                         to use the native gradient of the log(posterior) instead of finite differences in scipy.
 
         """
         if rng is None:
@@ -469,6 +595,23 @@ class Analysis:
             return(-np.inf)
 
 
+    def log_pdf_batch(self, u):
+        """
+        Adapter for use with external sampling software that proposes several points at once, evaluating the log(posterior) for all of them.
+
+        The points are evaluated concurrently on several copies of the posterior. In contrast to :meth:`log_pdf`,
+        the parameters of the analysis remain unchanged. Since the result includes the log(prior), this adapter is
+        not suited for nested samplers; use :meth:`log_likelihood_batch` instead.
+
+        :param u: Parameter points in u space, with one row per point and the columns in the same order as in eos.Analysis.varied_parameters.
+        :type u: array_like
+
+        :return: The log(posterior) at each point; -inf for points outside the unit hypercube and for points that raise an error.
+        :rtype: numpy.ndarray
+        """
+        return self._log_posterior.evaluate_batch(u)
+
+
     def negative_log_pdf(self, u, *args):
         """
         Adapter for use with external optimization software (e.g. scipy.optimize.minimize) to aid when optimizing the log(posterior).
@@ -481,6 +624,42 @@ class Analysis:
         return -self.log_pdf(u, *args)
 
 
+    def log_pdf_gradient(self, u, *args):
+        """
+        Adapter for use with external gradient-based optimization or sampling software, returning the gradient of the log(posterior) in u space.
+
+        Both the gradient with respect to the parameters, cf. :meth:`eos.LogPosterior.gradient`, and the Jacobian of
+        the inverse prior transform, cf. :meth:`eos.LogPosterior.inverse_cdf_jacobian`, are computed natively.
+
+        :param u: Parameter point in u space, with the elements in the same order as in eos.Analysis.varied_parameters.
+        :type u: iterable
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        """
+        self._u_to_par(u)
+
+        try:
+            return self._log_posterior.inverse_cdf_jacobian().T @ self._log_posterior.gradient()
+        except RuntimeError as e:
+            eos.error(f'encountered run time error ({e}) when evaluating the gradient of the log(posterior) in parameter point:')
+            for p in self.varied_parameters:
+                eos.error(f' - {p.name()}: {p.evaluate()}')
+            return np.full(len(u), np.nan)
+
+
+    def negative_log_pdf_gradient(self, u, *args):
+        """
+        Adapter for use with external optimization software (e.g. as the jac argument of scipy.optimize.minimize),
+        returning the gradient of the negative log(posterior) in u space.
+
+        :param u: Parameter point in u space, with the elements in the same order as in eos.Analysis.varied_parameters.
+        :type u: iterable
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        """
+        return -self.log_pdf_gradient(u, *args)
+
+
     def sample_prior(self, N=1000, rng=None):
         """
         Return prior samples of the parameters.
@@ -603,6 +782,52 @@ class Analysis:
             return(parameter_samples, weights, np.array(observable_samples))
 
 
+    def sample_chains(self, N=1000, chains=4, stride=5, pre_N=150, preruns=3, cov_scale=0.1, start_points=None, seed=1701,
+                      return_uspace=False):
+        """
+        Return samples of the parameters and log(weights) from several independent Markov chains.
+
+        Obtains random samples of the log(posterior) using adaptive Markov chains that run natively and concurrently,
+        each on its own copy of the posterior. The chains use the same u space, proposal, and prerun adaptation scheme
+        as :meth:`eos.Analysis.sample`, but do not require PyPMC and avoid a Python round trip per step.
+
+        :param N: Number of samples per chain that shall be returned
+        :param chains: Number of independent chains.
+        :param stride: Stride, i.e., the number by which the actual amount of samples shall be thinned to return N samples.
+        :param pre_N: Number of samples in each prerun.
+        :param preruns: Number of preruns.
+        :param cov_scale: Scale factor for the initial guess of the covariance matrix.
+        :param start_points: Optional starting points for the chains, one per chain
+        :type start_points: list-like, optional
+        :param seed: Seed of the random number generator of the first chain; chain i uses seed + i.
+        :type seed: int, optional
+
+        :return: A tuple of the parameters as array of shape chains x N x D, and the logarithmic weights as array of shape chains x N.
+            If return_uspace is True, the samples in u space are returned as array of shape chains x N x D in between.
+        """
+        dim = len(self.varied_parameters)
+        parameter_samples = np.empty((chains, N, dim))
+        u_samples         = np.empty((chains, N, dim))
+        weights           = np.empty((chains, N))
+
+        if start_points is not None:
+            if len(start_points) != chains:
+                raise ValueError(f'Expected {chains} start points, got {len(start_points)}')
+            start_points = np.ascontiguousarray([self._par_to_u(point) for point in start_points], dtype=np.float64)
+
+        eos.inprogress(f'Beginning to sample {chains} chain(s) ...')
+        accept_rates = self._log_posterior._sample_mcmc(chains, preruns, pre_N, stride, cov_scale, seed, start_points,
+                                                        parameter_samples, u_samples, weights)
+        for i, accept_rate in enumerate(accept_rates):
+            eos.info(f'Chain {i}: acceptance rate is {100 * accept_rate:3.0f}%')
+        eos.completed(f'... completed {chains} chain(s) with {N} samples each')
+
+        if return_uspace:
+            return(parameter_samples, u_samples, weights)
+        else:
+            return(parameter_samples, weights)
+
+
     def sample_pmc(self, log_proposal, step_N=1000, steps=10, final_N=5000, rng=None,
                     return_final_only=True, final_perplexity_threshold=1.0, weight_threshold=1e-10,
                     pmc_iterations=1, pmc_rel_tol=1e-10, pmc_abs_tol=1e-05, pmc_lookback=1):
@@ -773,6 +998,22 @@ class Analysis:
             return(-np.inf)
 
 
+    def log_likelihood_batch(self, p):
+        """
+        Adapter for use with external sampling software that proposes several points at once, evaluating the log(likelihood) for all of them.
+
+        The points are evaluated concurrently on several copies of the posterior. In contrast to :meth:`log_likelihood`,
+        the parameters of the analysis remain unchanged.
+
+        :param p: Parameter points, with one row per point and the columns in the same order as in eos.Analysis.varied_parameters.
+        :type p: array_like
+
+        :return: The log(likelihood) at each point; -inf for points that raise an error.
+        :rtype: numpy.ndarray
+        """
+        return self._log_posterior.evaluate_log_likelihood_batch(p)
+
+
     def _prior_transform(self, u):
         """
         Adapter for use with external sampling software to aid when sampling from the log(prior).
@@ -783,7 +1024,7 @@ class Analysis:
         return self._u_to_par(u)
 
 
-    def sample_nested(self, bound='multi', nlive=250, dlogz=1.0, maxiter=None, miniter=0, min_ess=0, print_progress=True, print_function=None, seed=10, sample='auto'):
+    def sample_nested(self, bound='multi', nlive=250, dlogz=1.0, maxiter=None, miniter=0, min_ess=0, print_progress=True, print_function=None, seed=10, sample='auto', queue_size=None):
         """
         Return samples of the parameters.
 
@@ -809,6 +1050,9 @@ class Analysis:
         :type seed: {None, int, array_like[ints], SeedSequence}, optional
         :param sample: The method used for sampling within the likelihood constraints. For valid values, see dynesty documentation. Defaults to 'auto'.
         :type sample: str, optional
+        :param queue_size: The number of live points that are proposed at once. Their log(likelihood) is evaluated in batches,
+            concurrently on several copies of the posterior. Defaults to the number of processors, limited by the environment variable EOS_MAX_THREADS.
+        :type queue_size: int, optional
 
         .. note::
            This method requires the dynesty python module, which can be installed from PyPI.
@@ -822,7 +1066,15 @@ class Analysis:
         if print_function is None:
             print_function = partial(dynesty.results.print_fn, pbar=tqdm.tqdm())
 
-        sampler = dynesty.DynamicNestedSampler(self.log_likelihood, self._prior_transform, len(self.varied_parameters), bound=bound, nlive=nlive, rstate = np.random.Generator(np.random.MT19937(seed)), sample=sample)
+        if queue_size is None:
+            queue_size = min(os.cpu_count() or 1, int(os.environ.get('EOS_MAX_THREADS', os.cpu_count() or 1)))
+
+        if queue_size < 1:
+            raise ValueError('queue_size must be positive')
+
+        pool = _LogLikelihoodBatchPool(self._log_posterior, self._prior_transform, queue_size)
+        sampler = dynesty.DynamicNestedSampler(pool.log_likelihood, pool.prior_transform, len(self.varied_parameters), bound=bound, nlive=nlive, rstate = np.random.Generator(np.random.MT19937(seed)), sample=sample,
+                                               pool=pool, queue_size=queue_size)
         # a min_ess of 0 defers to dynesty's default ESS target (max(10000, ndim^2))
         sampler.run_nested(dlogz_init=dlogz, maxiter=maxiter, n_effective=(min_ess if min_ess > 0 else None), print_progress=print_progress, print_func=print_function)
         # only recompute the ESS when an explicit minimum was requested (min_ess > 0)
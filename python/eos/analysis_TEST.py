@@ -307,6 +307,189 @@ class ClassMethodTests(unittest.TestCase):
         chi2_2 = (results['logz'][-1] - logz_analytic)**2 / results['logzerr'][-1]**2 # Assuming 2% error on the log(Z) value
         self.assertLess(chi2_2, 4.5494e-1, 'chi^2 for log(Z) exceeds 50% integrated probability for 1 degree of freedom')
 
+    def test_sample_chains(self):
+
+        analysis_args = {
+            'global_options': { },
+            'manual_constraints': {
+                'test::test': {
+                    'type': 'MultivariateGaussian(Covariance)',
+                    'observables': ['mass::c', 'mass::b(MSbar)'],
+                    'kinematics': [{}, {}],
+                    'options': [{}, {}],
+                    'means': [1.28, 4.17],
+                    'covariance': [[0.03**2, 0.0], [0.0, 0.02**2]],
+                }
+            },
+            'priors': [
+                { 'parameter': 'mass::c',        'min': 1.0, 'max': 1.6, 'type': 'uniform' },
+                { 'parameter': 'mass::b(MSbar)', 'min': 4.0, 'max': 4.4, 'type': 'uniform' },
+            ],
+            'likelihood': [ ]
+        }
+
+        analysis = eos.Analysis(**analysis_args)
+
+        samples, usamples, weights = analysis.sample_chains(N=2000, chains=4, stride=5, seed=1701, return_uspace=True)
+        self.assertEqual(samples.shape, (4, 2000, 2))
+        self.assertEqual(usamples.shape, (4, 2000, 2))
+        self.assertEqual(weights.shape, (4, 2000))
+
+        # the chains are reproducible
+        samples_again, weights_again = analysis.sample_chains(N=2000, chains=4, stride=5, seed=1701)
+        self.assertTrue(np.array_equal(samples, samples_again))
+        self.assertTrue(np.array_equal(weights, weights_again))
+
+        # the samples follow the posterior
+        avg = np.mean(samples.reshape(-1, 2), axis=0)
+        std = np.std(samples.reshape(-1, 2), axis=0)
+        self.assertAlmostEqual(avg[0], 1.28, delta=0.005)
+        self.assertAlmostEqual(avg[1], 4.17, delta=0.004)
+        self.assertAlmostEqual(std[0], 0.03, delta=0.004)
+        self.assertAlmostEqual(std[1], 0.02, delta=0.003)
+
+    def test_log_pdf_batch(self):
+
+        analysis_args = {
+            'global_options': { },
+            'manual_constraints': {
+                'test::test': {
+                    'type': 'MultivariateGaussian(Covariance)',
+                    'observables': ['mass::c', 'mass::b(MSbar)'],
+                    'kinematics': [{}, {}],
+                    'options': [{}, {}],
+                    'means': [1.28, 4.17],
+                    'covariance': [[0.03**2, 0.0], [0.0, 0.02**2]],
+                }
+            },
+            'priors': [
+                { 'parameter': 'mass::c',        'min': 1.0, 'max': 1.6, 'type': 'uniform' },
+                { 'parameter': 'mass::b(MSbar)', 'min': 4.0, 'max': 4.4, 'central': 4.2, 'sigma': 0.1, 'type': 'gaussian' },
+            ],
+            'likelihood': [ ]
+        }
+
+        analysis = eos.Analysis(**analysis_args)
+
+        u = np.random.default_rng(1701).uniform(0.0, 1.0, (100, 2))
+        u[0] = [1.5, 0.5]
+
+        batch = analysis.log_pdf_batch(u)
+        self.assertEqual(batch.shape, (100,))
+        self.assertEqual(batch[0], -np.inf)
+        for i in range(1, 100):
+            self.assertAlmostEqual(batch[i], analysis.log_pdf(u[i]), places=10)
+
+
+    def test_log_likelihood_batch(self):
+
+        analysis_args = {
+            'global_options': { },
+            'manual_constraints': {
+                'test::test': {
+                    'type': 'MultivariateGaussian(Covariance)',
+                    'observables': ['mass::c', 'mass::b(MSbar)'],
+                    'kinematics': [{}, {}],
+                    'options': [{}, {}],
+                    'means': [1.28, 4.17],
+                    'covariance': [[0.03**2, 0.0], [0.0, 0.02**2]],
+                }
+            },
+            'priors': [
+                { 'parameter': 'mass::c',        'min': 1.0, 'max': 1.6, 'type': 'uniform' },
+                { 'parameter': 'mass::b(MSbar)', 'min': 4.0, 'max': 4.4, 'central': 4.2, 'sigma': 0.1, 'type': 'gaussian' },
+            ],
+            'likelihood': [ ]
+        }
+
+        analysis = eos.Analysis(**analysis_args)
+
+        rng = np.random.default_rng(1701)
+        points = np.column_stack((rng.uniform(1.0, 1.6, 100), rng.uniform(4.0, 4.4, 100)))
+
+        # the log(likelihood) does not include the log(prior)
+        batch = analysis.log_likelihood_batch(points)
+        self.assertEqual(batch.shape, (100,))
+        for i in range(100):
+            self.assertAlmostEqual(batch[i], analysis.log_likelihood(points[i]), places=10)
+
+        # the pool used by sample_nested evaluates the log(likelihood) of all mapped calls in batches
+        pool = eos.analysis._LogLikelihoodBatchPool(analysis._log_posterior, analysis._prior_transform, 10)
+        calls = []
+        def evolve(i):
+            # several sequential evaluations per call, as in dynesty's random walks
+            return [pool.log_likelihood(points[i + 10 * k]) for k in range(3)]
+
+        original = analysis._log_posterior.evaluate_log_likelihood_batch
+        def spy(p):
+            calls.append(len(np.atleast_2d(p)))
+            return original(p)
+        analysis._log_posterior.evaluate_log_likelihood_batch = spy
+        try:
+            results = pool.map(evolve, range(10))
+        finally:
+            analysis._log_posterior.evaluate_log_likelihood_batch = original
+
+        self.assertEqual(calls, [10, 10, 10])
+        for i in range(10):
+            for k in range(3):
+                self.assertAlmostEqual(results[i][k], batch[i + 10 * k], places=10)
+
+        # errors in the mapped function reach the caller
+        def fail(i):
+            if i == 3:
+                raise ValueError('failure')
+            return pool.log_likelihood(points[i])
+        with self.assertRaises(ValueError):
+            pool.map(fail, range(10))
+
+
+    def test_log_pdf_gradient(self):
+
+        analysis_args = {
+            'global_options': { },
+            'manual_constraints': {
+                'test::test': {
+                    'type': 'MultivariateGaussian(Covariance)',
+                    'observables': ['mass::c', 'mass::b(MSbar)'],
+                    'kinematics': [{}, {}],
+                    'options': [{}, {}],
+                    'means': [1.28, 4.17],
+                    'covariance': [[0.03**2, 0.0002], [0.0002, 0.02**2]],
+                }
+            },
+            'priors': [
+                { 'parameter': 'mass::c',        'min': 1.0, 'max': 1.6, 'type': 'uniform' },
+                { 'parameter': 'mass::b(MSbar)', 'min': 4.0, 'max': 4.4, 'central': 4.2, 'sigma': 0.1, 'type': 'gaussian' },
+            ],
+            'likelihood': [ ]
+        }
+
+        analysis = eos.Analysis(**analysis_args)
+
+        # compare against a central difference quotient of the log(posterior) in u space
+        u, h = np.array([0.45, 0.6]), 1.0e-6
+        gradient = analysis.log_pdf_gradient(u)
+        for i in range(2):
+            u_hi, u_lo = u.copy(), u.copy()
+            u_hi[i] += h
+            u_lo[i] -= h
+            expected = (analysis.log_pdf(u_hi) - analysis.log_pdf(u_lo)) / (2.0 * h)
+            self.assertAlmostEqual(gradient[i] / expected, 1.0, places=4)
+
+        # the parameter point is restored
+        self.assertTrue(np.allclose([p.evaluate() for p in analysis.varied_parameters], analysis._u_to_par(u)))
+
+        # the Jacobian of the inverse prior transform is the inverse of the prior densities, also at the edges of the hypercube
+        for u in [np.array([0.0, 0.0]), np.array([0.45, 0.6]), np.array([1.0 - 1.0e-12, 1.0 - 1.0e-12])]:
+            analysis._u_to_par(u)
+            jacobian = analysis._log_posterior.inverse_cdf_jacobian()
+            self.assertEqual(jacobian.shape, (2, 2))
+            self.assertEqual(jacobian[0, 1], 0.0)
+            self.assertEqual(jacobian[1, 0], 0.0)
+            for i, prior in enumerate(analysis._log_posterior.log_priors()):
+                self.assertAlmostEqual(jacobian[i, i] * np.exp(prior.evaluate()), 1.0, places=10)
+
     def test_pyhf_likelihood(self):
 
         try:
@@ -172,11 +172,14 @@ class AnalysisFile:
                         eos.info(f'pyhf workspace parameter {pyhf_prior["parameter"]} added to prior; manually specify this prior to overwrite settings')
                         prior.append(PriorDescription.from_dict(**pyhf_prior))
 
-                # create likelihood block
-                llh_block = eos.LogLikelihoodBlock.External(
-                                cache,
-                                lambda cache: eos.PyhfLogLikelihood.factory(cache, workspace, parameter_map)
-                                )
+                # create likelihood block; use the native implementation unless observables with kinematics are needed
+                if any(isinstance(v, dict) and v.get('kinematics') for v in (parameter_map or {}).values()):
+                    llh_block = eos.LogLikelihoodBlock.External(
+                                    cache,
+                                    lambda cache: eos.PyhfLogLikelihood.factory(cache, workspace, parameter_map)
+                                    )
+                else:
+                    llh_block = eos.LogLikelihoodBlock.BinnedPoisson(cache, workspace, parameter_map)
 
                 external_likelihood.extend([llh_block])
 
@@ -15,8 +15,10 @@
 # this program; if not, write to the Free Software Foundation, Inc., 59 Temple
 # Place, Suite 330, Boston, MA  02111-1307  USA
 
-from _eos import LogLikelihoodBlock
+from _eos import LogLikelihood, LogLikelihoodBlock
+import json
 import numpy as np
+import os
 
 
 def _unbinned_1d(cache, pdf_name, kinematics, options, resolution, observations):
@@ -60,5 +62,106 @@ def _unbinned_1d(cache, pdf_name, kinematics, options, resolution, observations)
     return LogLikelihoodBlock._Unbinned1D(cache, pdf_name, kinematics, options, resolution.tolist(), observations)
 
 
-# Expose the wrapper as the public factory method on the native LogLikelihoodBlock class.
+def _binned_poisson(cache, workspace, parameter_map=None):
+    """
+    Create a new binned log-likelihood block for Poisson-distributed event counts from a pyhf workspace.
+
+    This block evaluates the main term of the HistFactory likelihood natively, i.e., without calling
+    into Python or requiring the ``pyhf`` module. The pyhf parameters are mapped onto EOS observables or
+    parameters in the same way as in :class:`eos.PyhfLogLikelihood`. The constraint terms are not part of
+    the block, and must be accounted for through priors.
+
+    :param cache: The observable cache used by the total log-likelihood.
+    :type cache: eos.ObservableCache
+    :param workspace: A pyhf workspace or its JSON specification as a dictionary, or the path to a JSON file specifying one.
+    :type workspace: pyhf.workspace.Workspace | dict | str
+    :param parameter_map: An optional mapping from pyhf parameter names to EOS observables or parameters.
+        Each value is either the qualified name of an EOS observable/parameter, or a dictionary with a
+        ``name`` key and an optional ``options`` key. Parameters not listed default to an EOS parameter
+        named ``pyhf::<name>``.
+    :type parameter_map: dict | None
+
+    :returns: The new block.
+    :rtype: eos.LogLikelihoodBlock
+
+    :raises ValueError: If a ``parameter_map`` value is neither a string nor a dictionary, or if it
+        specifies kinematics, which are only supported by :class:`eos.PyhfLogLikelihood`.
+    """
+    if isinstance(workspace, os.PathLike):
+        workspace = os.fspath(workspace)
+    elif not isinstance(workspace, str):
+        workspace = json.dumps(dict(workspace))
+
+    qualified_names = {}
+    for name, value in (parameter_map or {}).items():
+        if isinstance(value, str):
+            qualified_names[name] = value
+        elif isinstance(value, dict):
+            if value.get('kinematics'):
+                raise ValueError(f'parameter_map entry \'{name}\' specifies kinematics, which are not supported by the native block; use eos.PyhfLogLikelihood instead.')
+            options = value.get('options', {})
+            qualified_names[name] = value['name'] + (';' + ','.join(f'{k}={v}' for k, v in options.items()) if options else '')
+        else:
+            raise ValueError('parameter_map values must be either strings or dictionaries.')
+
+    return LogLikelihoodBlock._BinnedPoisson(cache, workspace, qualified_names)
+
+
+def _unbinned_factorized(cache, pdf_name, options, q2_grid, events):
+    """
+    Create a new unbinned log-likelihood block for a signal PDF that factorises in q2 and the angles.
+
+    The PDF must be of the form :math:`\\sum_i J_i(q^2) f_i(\\Omega)`, as is the case for
+    ``B->K^*ll::P(q2,cos(theta_l),cos(theta_K),phi)``. The angular basis functions :math:`f_i` are computed
+    once per event, while the coefficients :math:`J_i` are evaluated on the q2 grid once per parameter point and
+    interpolated linearly to the events. The PDF is normalised on the q2 range of the grid.
+
+    :param cache: The observable cache used by the total log-likelihood.
+    :type cache: eos.ObservableCache
+    :param pdf_name: The name of the SignalPDF.
+    :type pdf_name: eos.QualifiedName
+    :param options: Options forwarded to the observables providing the coefficients.
+    :type options: eos.Options
+    :param q2_grid: The strictly increasing q2 grid.
+    :type q2_grid: list of float
+    :param events: The observed events, with one row per event and one column per kinematic variable of the SignalPDF.
+    :type events: array_like
+
+    :returns: The new block.
+    :rtype: eos.LogLikelihoodBlock
+    """
+    events = np.ascontiguousarray(events, dtype=np.float64)
+
+    return LogLikelihoodBlock._UnbinnedFactorized(cache, pdf_name, options, [float(q2) for q2 in q2_grid], events)
+
+
+# Expose the wrappers as the public factory methods on the native LogLikelihoodBlock class.
 LogLikelihoodBlock.Unbinned1D = staticmethod(_unbinned_1d)
+LogLikelihoodBlock.BinnedPoisson = staticmethod(_binned_poisson)
+LogLikelihoodBlock.UnbinnedFactorized = staticmethod(_unbinned_factorized)
+
+
+def _simulate(self, toys, seed):
+    """
+    Simulates pseudo experiments for the current parameter point.
+
+    For each pseudo experiment, every block with observations draws a pseudo data set from its distribution,
+    and the sum of the blocks' log(likelihood) values for these data sets is returned. The pseudo experiments are
+    simulated concurrently, and the results depend only on the seed, not on the number of threads.
+
+    :param toys: The number of pseudo experiments.
+    :type toys: int
+    :param seed: The seed of the random number generators.
+    :type seed: int
+
+    :return: The log(likelihood) of each pseudo experiment.
+    :rtype: numpy.ndarray
+    """
+    test_statistics = np.empty(toys, dtype=np.float64)
+    self._simulate(seed, test_statistics)
+
+    return test_statistics
+
+
+# Expose the wrapper as the public simulation method on the native LogLikelihood class.
+LogLikelihood.simulate = _simulate
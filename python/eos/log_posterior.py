@@ -0,0 +1,112 @@
+# vim: set sw=4 sts=4 et tw=120 :
+
+# Copyright (c) 2026 Danny van Dyk
+#
+# This file is part of the EOS project. EOS is free software;
+# you can redistribute it and/or modify it under the terms of the GNU General
+# Public License version 2, as published by the Free Software Foundation.
+#
+# EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+# Place, Suite 330, Boston, MA  02111-1307  USA
+
+from _eos import LogPosterior
+import numpy as np
+
+
+def _evaluate_batch(self, u_points):
+    """
+    Evaluates the log(posterior) for a batch of points in the generator space [0, 1)^D in a single call.
+
+    The points are mapped onto the parameter space through the priors' inverse CDFs, and are distributed
+    among several clones of the posterior that evaluate them concurrently. The parameters of the posterior
+    remain unchanged.
+
+    :param u_points: The points, with one row per point and one column per varied parameter.
+    :type u_points: array_like
+
+    :return: The log(posterior) at each point; -inf for points outside the unit hypercube and for points
+        that raise an error.
+    :rtype: numpy.ndarray
+    """
+    u_points = np.ascontiguousarray(u_points, dtype=np.float64)
+    if u_points.ndim == 1:
+        u_points = u_points.reshape(1, -1)
+
+    results = np.empty(u_points.shape[0], dtype=np.float64)
+    self._evaluate_batch(u_points, results)
+
+    return results
+
+
+def _evaluate_log_likelihood_batch(self, points):
+    """
+    Evaluates the log(likelihood) for a batch of points in the parameter space in a single call.
+
+    As for :meth:`evaluate_batch`, the points are distributed among several clones of the posterior, and
+    the parameters of the posterior remain unchanged. The log(prior) is omitted, as required by nested
+    samplers, which account for the prior through their transformation from the unit hypercube.
+
+    :param points: The points, with one row per point and one column per varied parameter.
+    :type points: array_like
+
+    :return: The log(likelihood) at each point; -inf for points that raise an error.
+    :rtype: numpy.ndarray
+    """
+    points = np.ascontiguousarray(points, dtype=np.float64)
+    if points.ndim == 1:
+        points = points.reshape(1, -1)
+
+    results = np.empty(points.shape[0], dtype=np.float64)
+    self._evaluate_log_likelihood_batch(points, results)
+
+    return results
+
+
+def _gradient(self):
+    """
+    Computes the gradient of the log(posterior) with respect to the varied parameters at their current values.
+
+    The derivatives of the priors and of the Gaussian, LogGamma, and multivariate Gaussian likelihood blocks
+    are computed analytically, while the derivatives of the observables are computed by finite differences.
+    Only the observables that use a parameter are re-evaluated when differentiating with respect to it.
+
+    :return: The derivatives, in the same order as the varied parameters.
+    :rtype: numpy.ndarray
+    """
+    dim = sum(len(list(prior.varied_parameters())) for prior in self.log_priors())
+    gradient = np.empty(dim, dtype=np.float64)
+    self._gradient(gradient)
+
+    return gradient
+
+
+def _inverse_cdf_jacobian(self):
+    """
+    Computes the Jacobian of the mapping from the generator space [0, 1)^D onto the varied parameters
+    at the current generator values.
+
+    The derivatives are provided by the priors' inverse CDFs, i.e., by the inverse of the density for
+    one-dimensional priors. Priors that are implemented in Python fall back to finite differences.
+
+    :return: The derivatives, with the element [i, j] holding the derivative of the i-th varied parameter
+        with respect to the j-th generator value.
+    :rtype: numpy.ndarray
+    """
+    dim = sum(len(list(prior.varied_parameters())) for prior in self.log_priors())
+    jacobian = np.empty((dim, dim), dtype=np.float64)
+    self._inverse_cdf_jacobian(jacobian)
+
+    return jacobian
+
+
+# Expose the wrappers as the public batch evaluation, gradient, and Jacobian methods on the native LogPosterior class.
+LogPosterior.evaluate_batch = _evaluate_batch
+LogPosterior.evaluate_log_likelihood_batch = _evaluate_log_likelihood_batch
+LogPosterior.gradient = _gradient
+LogPosterior.inverse_cdf_jacobian = _inverse_cdf_jacobian
@@ -16,7 +16,8 @@
 # this program; if not, write to the Free Software Foundation, Inc., 59 Temple
 # Place, Suite 330, Boston, MA  02111-1307  USA
 
-from _eos import _Observables
+from _eos import _Observables, Observable, ObservableCache
+import numpy as np
 
 class Observables(_Observables):
     """
@@ -223,3 +224,73 @@ class Observables(_Observables):
         result += r'</table>'
 
         return(result)
+
+
+def _evaluate_batch(self, variables, points):
+    """
+    Evaluates the observable for a batch of kinematic points in a single call.
+
+    The kinematic variables bound to the observable are restored to their previous values afterwards.
+
+    :param variables: The name of the kinematic variable to be varied, or a list of such names.
+    :type variables: str or list of str
+    :param points: The values of the kinematic variables, with one row per point and one column per variable.
+        For a single variable, a one-dimensional array is accepted.
+    :type points: array_like
+
+    :return: The values of the observable, one per point.
+    :rtype: numpy.ndarray
+    """
+    if isinstance(variables, str):
+        variables = [variables]
+
+    points = np.ascontiguousarray(points, dtype=np.float64)
+    if points.ndim == 1 and len(variables) == 1:
+        points = points.reshape(-1, 1)
+
+    if points.ndim != 2 or points.shape[1] != len(variables):
+        raise ValueError('points must have shape (N, {}), not {}'.format(len(variables), points.shape))
+
+    results = np.empty(points.shape[0], dtype=np.float64)
+    self._evaluate_batch(variables, points, results)
+
+    return results
+
+
+# Expose the wrapper as the public batch evaluation method on the native Observable class.
+Observable.evaluate_batch = _evaluate_batch
+
+
+def _predict(self, parameters, samples, ids):
+    """
+    Predicts a subset of the cached observables for a batch of parameter samples in a single call.
+
+    The samples are distributed among all worker threads, each of which evaluates its own clone of the cache.
+    The cache and its parameters remain unchanged.
+
+    :param parameters: The varied parameters, in the order of the columns of ``samples``.
+    :type parameters: list of eos.Parameter
+    :param samples: The parameter samples, with one row per sample and one column per varied parameter.
+    :type samples: array_like
+    :param ids: The handles of the observables to predict, as returned by :meth:`add <eos.ObservableCache.add>`.
+    :type ids: list of eos.ObservableId
+
+    :return: The predictions, with one row per sample and one column per observable. Predictions for samples
+        that raise an error are set to NaN.
+    :rtype: numpy.ndarray
+    """
+    parameters = list(parameters)
+    ids = list(ids)
+    samples = np.ascontiguousarray(samples, dtype=np.float64)
+
+    if samples.ndim != 2 or samples.shape[1] != len(parameters):
+        raise ValueError('samples must have shape (N, {}), not {}'.format(len(parameters), samples.shape))
+
+    predictions = np.empty((samples.shape[0], len(ids)), dtype=np.float64)
+    self._predict(parameters, samples, ids, predictions)
+
+    return predictions
+
+
+# Expose the wrapper as the public batch prediction method on the native ObservableCache class.
+ObservableCache.predict = _predict
@@ -1,5 +1,6 @@
 import unittest
 import eos
+import numpy as np
 
 class ClassOperatorTests(unittest.TestCase):
 
@@ -18,5 +19,25 @@ class ClassOperatorTests(unittest.TestCase):
             eos.Observables()[invalid_name]
 
 
+class BatchEvaluationTests(unittest.TestCase):
+
+    def test_evaluate_batch(self):
+        "batch evaluation agrees with repeated evaluation"
+
+        parameters = eos.Parameters()
+        kinematics = eos.Kinematics(q2=1.0)
+        observable = eos.Observable.make('B->Dlnu::dBR/dq2;l=e,q=d', parameters, kinematics, eos.Options())
+
+        q2_values = np.linspace(1.0, 10.0, 100)
+        results = observable.evaluate_batch('q2', q2_values)
+
+        self.assertEqual(results.shape, q2_values.shape)
+        self.assertEqual(float(kinematics['q2']), 1.0)
+
+        for q2, result in zip(q2_values, results):
+            kinematics['q2'].set(q2)
+            self.assertAlmostEqual(result, observable.evaluate(), delta=1.0e-12 * abs(result))
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=5)
@@ -139,6 +139,21 @@ class PyhfLogLikelihood:
         # only main term in pyhf - constraints are handled in EOS
         return self.model.mainlogpdf(self.data, parameter_values).item()
 
+    def sample(self, seed):
+        """Evaluate the main term of the pyhf log-likelihood for a pseudo data set at the current parameter values.
+
+        The pseudo data set is drawn from the Poisson distributions of the expected event counts in each bin.
+
+        :param seed: The seed of the random number generator used to draw the pseudo data set.
+        :type seed: int
+        :returns: The value of the main log-likelihood term for the pseudo data set.
+        :rtype: float
+        """
+        parameter_values = np.array([p.evaluate() for p in self._pyhf_parameters])
+        expected = self.model.expected_actualdata(parameter_values)
+        pseudo_data = np.random.default_rng(seed).poisson(expected).astype(float)
+        return self.model.mainlogpdf(pseudo_data, parameter_values).item()
+
     @staticmethod
     def factory(cache, workspace, parameter_map=None):
         """Construct a :class:`PyhfLogLikelihood`.
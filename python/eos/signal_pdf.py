@@ -52,6 +52,7 @@ class SignalPDF(_SignalPDF):
 
         .. note::
            This method requires the PyPMC python module, which can be installed from PyPI.
+           To obtain independent events, use :meth:`generate` instead.
         """
         if rng is None:
             rng = np.random.mtrand
@@ -107,6 +108,45 @@ class SignalPDF(_SignalPDF):
 
         return(parameter_samples, weights)
 
+    def generate(self, N, seed=1701, bins=50, adaptation_steps=5, adaptation_samples=20000, envelope_samples=100000, safety_factor=1.2):
+        """
+        Return independent pseudo events drawn from the PDF.
+
+        The events are generated natively and concurrently by accept-reject sampling within the bounds ``v_min`` and ``v_max``
+        of each sampling variable ``v``. The proposal density is adapted to the PDF on a grid in the manner of VEGAS.
+        Unlike :meth:`sample_mcmc`, the events are uncorrelated and do not require PyPMC.
+
+        :param N: Number of events that shall be returned.
+        :param seed: Seed from which the seeds of the random number generators are derived.
+        :param bins: Number of bins of the adaptive grid per sampling variable.
+        :param adaptation_steps: Number of adaptation steps of the grid.
+        :param adaptation_samples: Number of proposal points per adaptation step.
+        :param envelope_samples: Number of proposal points used to determine the envelope of the accept-reject step.
+        :param safety_factor: Factor by which the envelope exceeds the largest observed ratio of the PDF to the proposal density.
+
+        :return: The events as array of shape N x D, with one column per sampling variable; see ``self.sampling_variables``.
+        """
+        events = np.empty((N, len(self.sampling_variables)))
+        efficiency = self._generate(bins, adaptation_steps, adaptation_samples, envelope_samples, safety_factor, seed, events)
+        eos.info(f'Generated {N} events; the expected acceptance rate is {100 * efficiency:3.0f}%')
+
+        return events
+
+    def write_events(self, path, N, seed=1701, bins=50, adaptation_steps=5, adaptation_samples=20000, envelope_samples=100000, safety_factor=1.2):
+        """
+        Generate independent pseudo events from the PDF and write them to a file.
+
+        The events are generated as in :meth:`generate`, but are written to disk while they are generated, such that they need not
+        fit into memory at once. The file uses the NumPy .npy format and can be read with :func:`numpy.load`, optionally memory mapped.
+
+        :param path: Path of the file.
+        :param N: Number of events that shall be written.
+
+        See :meth:`generate` for the remaining parameters.
+        """
+        efficiency = self._write_events(bins, adaptation_steps, adaptation_samples, envelope_samples, safety_factor, seed, path, N)
+        eos.info(f'Wrote {N} events to {path}; the expected acceptance rate is {100 * efficiency:3.0f}%')
+
     @staticmethod
     def make(name, parameters, kinematics, options):
         """
@@ -134,6 +174,7 @@ class SignalPDF(_SignalPDF):
             filter(lambda n: not(n.endswith('_min') or n.endswith('_max')), [kv.name() for kv in kinematics])
         ))
         pdf.bounds = [(kinematics[v.name() + '_min'], kinematics[v.name() + '_max']) for v in pdf.variables]
+        pdf.sampling_variables = pdf._sampling_variables()
 
         return pdf
 
@@ -332,6 +332,7 @@ def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str=
     :param posterior: The name of the posterior PDF from which to draw the samples.
     :type posterior: str
     :param chain: The index assigned to the Markov chain. This value is used to seed the RNG for a reproducible analysis.
+        The chain is sampled natively, see :meth:`eos.Analysis.sample_chains`.
     :type chain: int >= 0
     :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
     :type base_directory: str, optional
@@ -352,10 +353,11 @@ def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str=
     eos.inprogress('Beginning sampling...')
 
     analysis = analysis_file.analysis(posterior)
-    rng = _np.random.mtrand.RandomState(int(chain) + 1701)
+    start_points = None if start_point is None else [start_point]
     try:
-        samples, usamples, weights = analysis.sample(N=N, stride=stride, pre_N=pre_N, preruns=preruns, rng=rng, cov_scale=cov_scale, start_point=start_point, return_uspace=True)
-        eos.data.MarkovChain.create(os.path.join(base_directory, 'data', posterior, f'mcmc-{chain:04}'), analysis.varied_parameters, samples, usamples, weights)
+        samples, usamples, weights = analysis.sample_chains(N=N, chains=1, stride=stride, pre_N=pre_N, preruns=preruns, cov_scale=cov_scale, start_points=start_points,
+                                                            seed=int(chain) + 1701, return_uspace=True)
+        eos.data.MarkovChain.create(os.path.join(base_directory, 'data', posterior, f'mcmc-{chain:04}'), analysis.varied_parameters, samples[0], usamples[0], weights[0])
     except RuntimeError as e:
         eos.error(f'encountered run time error ({e}) in parameter point:')
         for p in analysis.varied_parameters:
@@ -571,19 +573,14 @@ def predict_observables(analysis_file:str, posterior:str, prediction:str, base_d
         progressbar = lambda x: x
 
     parameters = [_parameters[p['name']] for p in data.varied_parameters]
-    observable_samples = []
-    nsamples = len(data.samples[begin:end])
+    samples = data.samples[begin:end]
+    nsamples = len(samples)
     eos.inprogress(f'Predicting observables from set \'{prediction}\' for {nsamples} samples')
-    for i, sample in enumerate(progressbar(data.samples[begin:end])):
-        for p, v in zip(parameters, sample):
-            p.set(v)
-        try:
-            cache.update()
-            observable_samples.append([cache[id] for id in observable_ids])
-        except RuntimeError as e:
-            eos.error(f'skipping prediction for sample {i} due to runtime error ({e}): {sample}')
-            observable_samples.append([_np.nan for _ in observable_ids])
-    observable_samples = _np.array(observable_samples)
+    # predict in batches, distributing the samples of each batch across all worker threads
+    batch_size = 10000
+    observable_samples = _np.empty((nsamples, len(observable_ids)))
+    for i in progressbar(range(0, nsamples, batch_size)):
+        observable_samples[i:i + batch_size] = cache.predict(parameters, samples[i:i + batch_size], observable_ids)
     if mask_name is not None:
         eos.info(f'Applying mask {mask_name} to the observables')
         observable_samples = observable_samples[mask]
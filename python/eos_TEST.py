@@ -449,5 +449,32 @@ class ExternalLogPriorTests(unittest.TestCase):
             eos.LogPrior.External(parameters, _IncompleteProvider)
 
 
+class ExternalLogLikelihoodBlockTests(unittest.TestCase):
+
+    def test_bootstrap_p_value(self):
+        "Check that the p-value can be bootstrapped for a likelihood with an external block."
+        import eos
+        from math import sqrt
+
+        class _ConstantBlock:
+            def __init__(self, cache):
+                self.number_of_observations = 1
+
+            def evaluate(self):
+                return -1.0
+
+            # every pseudo experiment is less likely than the observed data
+            def sample(self, seed):
+                return -2.0
+
+        llh = eos.LogLikelihood(eos.Parameters.Defaults())
+        llh.add(eos.LogLikelihoodBlock.External(llh.observable_cache(), _ConstantBlock))
+
+        # the external block is sampled from the workers of the thread pool, which must be able to acquire the GIL
+        p, uncertainty = llh.bootstrap_p_value(100)
+        self.assertEqual(p, 1.0)
+        self.assertAlmostEqual(uncertainty, sqrt(101.0 / 102.0 * (1.0 / 102.0) / 103.0), places=13)
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=5)
@@ -29,6 +29,8 @@
 #include <iostream>
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace test
 {
@@ -279,5 +281,51 @@ namespace test
     }                                                                                                                                                                 \
     while (false)
 
+    /*!
+     * Check that a batch evaluation agrees with the scalar interface, e.g. for form factors.
+     *
+     * The requested fields of the batch are resized to the number of points and filled through
+     * object.evaluate(points, batch). Vanishing scalar values are compared with an absolute
+     * rather than a relative tolerance.
+     *
+     * @param object The object providing both interfaces; pass the interface as template argument.
+     * @param points The points at which the fields are evaluated.
+     * @param fields Pairs of a field in the batch and the corresponding scalar member function.
+     * @param eps    The tolerance.
+     * @return The filled batch.
+     */
+    template <typename Object_, typename Batch_ = typename Object_::Batch>
+    Batch_
+    check_batch_evaluation(const Object_ & object, const std::vector<double> & points,
+                           const std::vector<std::pair<std::vector<double> Batch_::*, double (Object_::*)(const double &) const>> & fields, const double & eps = 1e-12)
+    {
+        using eos::stringify;
+
+        Batch_ batch;
+        for (const auto & [field, scalar] : fields)
+        {
+            (batch.*field).resize(points.size());
+        }
+
+        object.evaluate(points, batch);
+
+        for (const auto & [field, scalar] : fields)
+        {
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                const double value = (object.*scalar)(points[i]);
+                if (0.0 == value)
+                {
+                    TEST_CHECK_NEARLY_EQUAL((batch.*field)[i], value, eps);
+                }
+                else
+                {
+                    TEST_CHECK_RELATIVE_ERROR((batch.*field)[i], value, eps);
+                }
+            }
+        }
+
+        return batch;
+    }
 } // namespace test
 #endif